@@ -29,6 +29,7 @@
 
 #include "Graph.hh"
 #include "Liberty.hh"
+#include "Machine.hh"
 #include "Network.hh"
 #include "StringUtil.hh"
 #include "TimingArc.hh"
@@ -41,6 +42,46 @@ ArcDelayCalc::ArcDelayCalc(StaState *sta):
 {
 }
 
+ArcDelayCalc::ArcDelayCalc(const ArcDelayCalc &dcalc) :
+  StaState(dcalc)
+{
+}
+
+void
+ArcDelayCalc::parasiticsInvalid(const Pin *)
+{
+}
+
+void
+ArcDelayCalc::addCounts(ArcDcalcCountsMap &counts) const
+{
+  counts[std::string(name())].add(counts_);
+}
+
+void
+ArcDelayCalc::clearCounts()
+{
+  counts_ = ArcDcalcCounts();
+}
+
+void
+ArcDelayCalc::incrReduction(double begin_time)
+{
+  counts_.reduction_count++;
+  counts_.reduction_time += elapsedRunTime() - begin_time;
+}
+
+void
+ArcDcalcCounts::add(const ArcDcalcCounts &counts)
+{
+  call_count += counts.call_count;
+  time += counts.time;
+  newton_iteration_count += counts.newton_iteration_count;
+  fallback_count += counts.fallback_count;
+  reduction_count += counts.reduction_count;
+  reduction_time += counts.reduction_time;
+}
+
 void
 ArcDelayCalc::gateDelay(const TimingArc *arc,
                         const Slew &in_slew,
@@ -61,6 +102,20 @@ ArcDelayCalc::gateDelay(const TimingArc *arc,
   drvr_slew = dcalc_result.drvrSlew();
 }
 
+ArcDcalcResultSeq
+ArcDelayCalc::sceneGateDelays(ArcDcalcArgSeq &args,
+                              const LoadPinIndexMap &load_pin_index_map)
+{
+  ArcDcalcResultSeq dcalc_results;
+  dcalc_results.reserve(args.size());
+  for (const ArcDcalcArg &arg : args)
+    dcalc_results.push_back(gateDelay(arg.drvrPin(), arg.arc(), arg.inSlew(),
+                                      arg.loadCap(), arg.parasitic(),
+                                      load_pin_index_map,
+                                      arg.scene(), arg.minMax()));
+  return dcalc_results;
+}
+
 ////////////////////////////////////////////////////////////////
 
 // For TCL %typemap(in) ArcDcalcArg.
@@ -127,7 +182,9 @@ ArcDcalcArg::ArcDcalcArg() :
   in_slew_(0.0),
   load_cap_(0.0),
   parasitic_(nullptr),
-  input_delay_(0.0)
+  input_delay_(0.0),
+  scene_(nullptr),
+  min_max_(nullptr)
 {
 }
 
@@ -145,7 +202,9 @@ ArcDcalcArg::ArcDcalcArg(const Pin *in_pin,
   in_slew_(in_slew),
   load_cap_(load_cap),
   parasitic_(parasitic),
-  input_delay_(0.0)
+  input_delay_(0.0),
+  scene_(nullptr),
+  min_max_(nullptr)
 {
 }
 
@@ -161,7 +220,9 @@ ArcDcalcArg::ArcDcalcArg(const Pin *in_pin,
   in_slew_(0.0),
   load_cap_(0.0),
   parasitic_(nullptr),
-  input_delay_(input_delay)
+  input_delay_(input_delay),
+  scene_(nullptr),
+  min_max_(nullptr)
 {
 }
 
@@ -241,6 +302,14 @@ ArcDcalcArg::setInputDelay(float input_delay)
   input_delay_ = input_delay;
 }
 
+void
+ArcDcalcArg::setAnalysisPt(const Scene *scene,
+                           const MinMax *min_max)
+{
+  scene_ = scene;
+  min_max_ = min_max;
+}
+
 ////////////////////////////////////////////////////////////////
 
 ArcDcalcResult::ArcDcalcResult() :
@@ -33,16 +33,19 @@
 #include <cstddef>
 #include <cstdio>
 #include <numbers>
+#include <vector>
 
 #include "ArcDelayCalc.hh"
 #include "Arnoldi.hh"
 #include "ArnoldiReduce.hh"
+#include "ContainerHelpers.hh"
 #include "Debug.hh"
 #include "DelayCalc.hh"
 #include "Graph.hh"
 #include "GraphDelayCalc.hh"
 #include "Liberty.hh"
 #include "LumpedCapDelayCalc.hh"
+#include "Machine.hh"
 #include "Network.hh"
 #include "Parasitics.hh"
 #include "PortDirection.hh"
@@ -135,6 +138,8 @@ public:
                            const RiseFall *rf,
                            const Scene *scene,
                            const MinMax *min_max) override;
+  // Reduced arnoldi rcmodels are not saved in the parasitics db.
+  bool reduceSupported() const override { return false; }
   Parasitic *reduceParasitic(const Parasitic *parasitic_network,
                              const Pin *drvr_pin,
                              const RiseFall *rf,
@@ -166,6 +171,7 @@ public:
                               const MinMax *min_max,
                               int digits) override;
   void finishDrvrPin() override;
+  void parasiticsInvalid(const Pin *drvr_pin) override;
   void delay_work_set_thresholds(delay_work *D,
                                  double lo,
                                  double hi,
@@ -173,6 +179,20 @@ public:
                                  double derate);
 
 private:
+  rcmodel *reduce(Parasitic *parasitic_network,
+                  const Pin *drvr_pin,
+                  float coupling_cap_factor,
+                  const RiseFall *rf,
+                  const Scene *scene,
+                  const MinMax *min_max);
+  void pinCaps(const rcmodel *model,
+               const RiseFall *rf,
+               const Scene *scene,
+               const MinMax *min_max,
+               // Return value.
+               std::vector<float> &pin_caps);
+  void deleteReductions();
+  bool lumpedCapGateDelay(const ArcDcalcArg &arg) const override;
   ArcDcalcResult gateDelaySlew(const LibertyCell *drvr_cell,
                                const TimingArc *arc,
                                const GateTableModel *table_model,
@@ -238,7 +258,26 @@ private:
                  double *c_x1,
                  double *c_y1);
 
+  // Reduced rcmodel of a parasitic network rooted at a driver pin. The
+  // reduction only depends on the network, driver, coupling cap factor and
+  // pin capacitances so it is shared by the scenes and min/max with the
+  // same values.
+  struct ArnoldiReduction
+  {
+    const Parasitic *parasitic_network;
+    const Pin *drvr_pin;
+    float coupling_cap_factor;
+    // Capacitances of the rcmodel pins.
+    std::vector<float> pin_caps;
+    rcmodel *model;
+  };
+
   rcmodel *rcmodel_{nullptr};
+  // Reductions for the driver pins deleted by finishDrvrPin.
+  // Parallel gate drivers of a net use their reductions together.
+  std::vector<ArnoldiReduction> reductions_;
+  size_t reduce_count_{0};
+  size_t reduce_reuse_count_{0};
   int _pinNmax;
   double *_delayV;
   double *_slewV;
@@ -281,11 +320,15 @@ ArnoldiDelayCalc::copy()
 
 ArnoldiDelayCalc::~ArnoldiDelayCalc()
 {
+  // Report reduction reuse with "set_debug stats 2".
+  if (debug_->statsLevel() > 1 && reduce_count_ > 0)
+    report_->report("stats: arnoldi reductions {} reuses {}",
+                    reduce_count_, reduce_reuse_count_);
   delay_work_destroy(delay_work_);
   free(_delayV);
   free(_slewV);
   delete reduce_;
-  delete rcmodel_;
+  deleteReductions();
 }
 
 Parasitic *
@@ -303,7 +346,11 @@ ArnoldiDelayCalc::findParasitic(const Pin *drvr_pin,
     return nullptr;
   Parasitic *parasitic_network =
     parasitics->findParasiticNetwork(drvr_pin);
-  if (parasitic_network == nullptr) {
+  if (parasitic_network)
+    rcmodel_ = reduce(parasitic_network, drvr_pin,
+                      parasitics->couplingCapFactor(),
+                      drvr_rf, scene, min_max);
+  else {
     Wireload *wireload = sdc->wireload(min_max);
     if (wireload) {
       float pin_cap, wire_cap, fanout;
@@ -312,19 +359,92 @@ ArnoldiDelayCalc::findParasitic(const Pin *drvr_pin,
                                  pin_cap, wire_cap, fanout, has_wire_cap);
       parasitic_network = parasitics->makeWireloadNetwork(drvr_pin, wireload,
                                                           fanout, scene, min_max);
+      if (parasitic_network) {
+        // Wireload networks are rebuilt for each call so they are not shared.
+        double begin_time = elapsedRunTime();
+        rcmodel_ = reduce_->reduceToArnoldi(parasitic_network, drvr_pin,
+                                            parasitics->couplingCapFactor(),
+                                            drvr_rf, scene, min_max);
+        incrReduction(begin_time);
+        reduce_count_++;
+        if (rcmodel_)
+          reductions_.push_back({nullptr, drvr_pin, 0.0, {}, rcmodel_});
+      }
     }
   }
-    
-  if (parasitic_network) {
-    rcmodel_ = reduce_->reduceToArnoldi(parasitic_network, drvr_pin,
-                                        parasitics->couplingCapFactor(),
-                                        drvr_rf, scene, min_max);
-    // Arnoldi parasitics are their own class that are not saved in the parasitic db.
+  // Arnoldi parasitics are their own class that are not saved in the parasitic db.
+  if (parasitic_network)
     parasitic = rcmodel_;
-  }
   return parasitic;
 }
 
+rcmodel *
+ArnoldiDelayCalc::reduce(Parasitic *parasitic_network,
+                         const Pin *drvr_pin,
+                         float coupling_cap_factor,
+                         const RiseFall *rf,
+                         const Scene *scene,
+                         const MinMax *min_max)
+{
+  std::vector<float> pin_caps;
+  for (const ArnoldiReduction &reduction : reductions_) {
+    if (reduction.parasitic_network == parasitic_network
+        && reduction.drvr_pin == drvr_pin
+        && reduction.coupling_cap_factor == coupling_cap_factor) {
+      // The pin order of reductions of the same network and driver
+      // is the same.
+      if (pin_caps.empty())
+        pinCaps(reduction.model, rf, scene, min_max, pin_caps);
+      if (pin_caps == reduction.pin_caps) {
+        reduce_reuse_count_++;
+        return reduction.model;
+      }
+    }
+  }
+  double begin_time = elapsedRunTime();
+  rcmodel *model = reduce_->reduceToArnoldi(parasitic_network, drvr_pin,
+                                            coupling_cap_factor,
+                                            rf, scene, min_max);
+  incrReduction(begin_time);
+  reduce_count_++;
+  if (model) {
+    if (pin_caps.empty())
+      pinCaps(model, rf, scene, min_max, pin_caps);
+    reductions_.push_back({parasitic_network, drvr_pin, coupling_cap_factor,
+                           std::move(pin_caps), model});
+  }
+  return model;
+}
+
+void
+ArnoldiDelayCalc::pinCaps(const rcmodel *model,
+                          const RiseFall *rf,
+                          const Scene *scene,
+                          const MinMax *min_max,
+                          // Return value.
+                          std::vector<float> &pin_caps)
+{
+  pin_caps.reserve(model->n);
+  for (int i = 0; i < model->n; i++)
+    pin_caps.push_back(reduce_->pinCapacitance(model->pinV[i], rf,
+                                               scene, min_max));
+}
+
+void
+ArnoldiDelayCalc::deleteReductions()
+{
+  for (ArnoldiReduction &reduction : reductions_)
+    delete reduction.model;
+  reductions_.clear();
+}
+
+void
+ArnoldiDelayCalc::parasiticsInvalid(const Pin *)
+{
+  deleteReductions();
+  rcmodel_ = nullptr;
+}
+
 Parasitic *
 ArnoldiDelayCalc::reduceParasitic(const Parasitic *,
                                   const Pin *,
@@ -336,13 +456,22 @@ ArnoldiDelayCalc::reduceParasitic(const Parasitic *,
   return nullptr;
 }
 
+// Reductions are kept until the driver is finished so the arcs, scenes
+// and min/max of the driver can share them.
 void
 ArnoldiDelayCalc::finishDrvrPin()
 {
-  delete rcmodel_;
+  deleteReductions();
   rcmodel_ = nullptr;
 }
 
+// Without a parasitic gateDelay uses the lumped cap table lookup.
+bool
+ArnoldiDelayCalc::lumpedCapGateDelay(const ArcDcalcArg &arg) const
+{
+  return arg.parasitic() == nullptr;
+}
+
 ArcDcalcResult
 ArnoldiDelayCalc::inputPortDelay(const Pin *,
                                  float in_slew,
@@ -418,9 +547,12 @@ ArnoldiDelayCalc::gateDelay(const Pin *drvr_pin,
     const Pvt *pvt = pinPvt(drvr_pin, scene, min_max);
     return gateDelaySlew(drvr_cell, arc, table_model, in_slew, load_pin_index_map, pvt);
   }
-  else
+  else {
+    if (parasitic)
+      incrFallbackCount();
     return LumpedCapDelayCalc::gateDelay(drvr_pin, arc, in_slew, load_cap,
                                          parasitic, load_pin_index_map, scene, min_max);
+  }
 }
 
 ArcDcalcResult
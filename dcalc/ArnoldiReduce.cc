@@ -166,7 +166,7 @@ ArnoldiReduce::reduceToArnoldi(Parasitic *parasitic,
 void
 ArnoldiReduce::loadWork()
 {
-  pt_map_.clear();
+  pt_index_.assign(parasitics_->nodeCount(parasitic_network_), 0);
 
   const ParasiticResistorSeq &resistors = parasitics_->resistors(parasitic_network_);
   int resistor_count = resistors.size();
@@ -210,7 +210,7 @@ ArnoldiReduce::loadWork()
       const Pin *pin = parasitics_->pin(node);
       if (pin) {
         p = pend++;
-        pt_map_[node] = p - p0;
+        pt_index_[parasitics_->nodeIndex(node)] = p - p0;
         p->node_ = node;
         p->eN = 0;
         p->is_term = true;
@@ -219,7 +219,7 @@ ArnoldiReduce::loadWork()
         pinV[tindex] = pin;
       }
       else {
-        pt_map_[node] = index;
+        pt_index_[parasitics_->nodeIndex(node)] = index;
         p = p0 + index;
         p->node_ = node;
         p->eN = 0;
@@ -316,7 +316,7 @@ ArnoldiReduce::allocTerms(int nterms)
 ts_point *
 ArnoldiReduce::findPt(ParasiticNode *node)
 {
-  return &ts_pointV[pt_map_[reinterpret_cast<ConcreteParasiticNode *>(node)]];
+  return &ts_pointV[pt_index_[parasitics_->nodeIndex(node)]];
 }
 
 rcmodel *
@@ -466,16 +466,25 @@ float
 ArnoldiReduce::pinCapacitance(ParasiticNode *node)
 {
   const Pin *pin = parasitics_->pin(node);
+  if (pin)
+    return pinCapacitance(pin, rf_, scene_, min_max_);
+  return 0.0;
+}
+
+float
+ArnoldiReduce::pinCapacitance(const Pin *pin,
+                              const RiseFall *rf,
+                              const Scene *scene,
+                              const MinMax *min_max) const
+{
   float pin_cap = 0.0;
-  if (pin) {
-    Port *port = network_->port(pin);
-    LibertyPort *lib_port = network_->libertyPort(port);
-    const Sdc *sdc = scene_->sdc();
-    if (lib_port)
-      pin_cap = sdc->pinCapacitance(pin, rf_, scene_, min_max_);
-    else if (network_->isTopLevelPort(pin))
-      pin_cap = sdc->portExtCap(port, rf_, min_max_);
-  }
+  Port *port = network_->port(pin);
+  LibertyPort *lib_port = network_->libertyPort(port);
+  const Sdc *sdc = scene->sdc();
+  if (lib_port)
+    pin_cap = sdc->pinCapacitance(pin, rf, scene, min_max);
+  else if (network_->isTopLevelPort(pin))
+    pin_cap = sdc->portExtCap(port, rf, min_max);
   return pin_cap;
 }
 
@@ -28,7 +28,7 @@
 
 #pragma once
 
-#include <map>
+#include <vector>
 
 #include "Transition.hh"
 #include "NetworkClass.hh"
@@ -46,8 +46,6 @@ class rcmodel;
 struct ts_edge;
 struct ts_point;
 
-using ArnolidPtMap = std::map<ParasiticNode*, int>;
-
 class ArnoldiReduce : public StaState
 {
 public:
@@ -59,6 +57,10 @@ public:
                            const RiseFall *rf,
                            const Scene *scene,
                            const MinMax *min_max);
+  float pinCapacitance(const Pin *pin,
+                       const RiseFall *rf,
+                       const Scene *scene,
+                       const MinMax *min_max) const;
 
 protected:
   void loadWork();
@@ -80,8 +82,8 @@ protected:
   const RiseFall *rf_;
   const Scene *scene_;
   const MinMax *min_max_;
-  // ParasiticNode -> ts_point index.
-  ArnolidPtMap pt_map_;
+  // Parasitics::nodeIndex -> ts_point index.
+  std::vector<int> pt_index_;
 
   // rcWork
   ts_point *ts_pointV;
@@ -79,6 +79,20 @@ CcsCeffDelayCalc::copy()
   return new CcsCeffDelayCalc(*this);
 }
 
+void
+CcsCeffDelayCalc::addCounts(ArcDcalcCountsMap &counts) const
+{
+  ArcDelayCalc::addCounts(counts);
+  table_dcalc_->addCounts(counts);
+}
+
+void
+CcsCeffDelayCalc::clearCounts()
+{
+  ArcDelayCalc::clearCounts();
+  table_dcalc_->clearCounts();
+}
+
 ArcDcalcResult
 CcsCeffDelayCalc::gateDelay(const Pin *drvr_pin,
                             const TimingArc *arc,
@@ -152,6 +166,8 @@ CcsCeffDelayCalc::gateDelay(const Pin *drvr_pin,
       return dcalc_result;
     }
   }
+  if (parasitic)
+    incrFallbackCount();
   return table_dcalc_->gateDelay(drvr_pin, arc, in_slew, load_cap, parasitic,
                                  load_pin_index_map, scene, min_max);
 }
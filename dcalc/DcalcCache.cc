@@ -0,0 +1,102 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#include "DcalcCache.hh"
+
+#include <bit>
+
+#include "Hash.hh"
+
+namespace sta {
+
+void
+DcalcCacheKey::addPointer(const void *ptr)
+{
+  words_.push_back(reinterpret_cast<uintptr_t>(ptr));
+}
+
+void
+DcalcCacheKey::addFloat(float value)
+{
+  words_.push_back(std::bit_cast<uint32_t>(value));
+}
+
+void
+DcalcCacheKey::addInt(int64_t value)
+{
+  words_.push_back(static_cast<uint64_t>(value));
+}
+
+void
+DcalcCacheKey::clear()
+{
+  words_.clear();
+}
+
+size_t
+DcalcCacheKey::hash() const
+{
+  size_t hash = hash_init_value;
+  for (uint64_t word : words_)
+    hashIncr(hash, word);
+  return hash;
+}
+
+////////////////////////////////////////////////////////////////
+
+const ArcDcalcResult *
+DcalcCache::find(const DcalcCacheKey &key)
+{
+  auto itr = results_.find(key);
+  if (itr == results_.end()) {
+    miss_count_++;
+    return nullptr;
+  }
+  hit_count_++;
+  return &itr->second;
+}
+
+void
+DcalcCache::insert(const DcalcCacheKey &key,
+                   const ArcDcalcResult &result)
+{
+  if (results_.size() >= max_size_)
+    results_.clear();
+  results_[key] = result;
+}
+
+void
+DcalcCache::clear()
+{
+  results_.clear();
+}
+
+void
+DcalcCache::clearCounts()
+{
+  hit_count_ = 0;
+  miss_count_ = 0;
+}
+
+} // namespace sta
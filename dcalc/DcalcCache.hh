@@ -0,0 +1,79 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "ArcDelayCalc.hh"
+
+namespace sta {
+
+// Driver arc delay calculation cache key.
+// The words are the arc, gate model, pvt, quantized input slew and a
+// signature of the reduced load seen by the driver.
+class DcalcCacheKey
+{
+public:
+  void addPointer(const void *ptr);
+  void addFloat(float value);
+  void addInt(int64_t value);
+  void clear();
+  size_t hash() const;
+  bool operator==(const DcalcCacheKey &key) const { return words_ == key.words_; }
+
+private:
+  std::vector<uint64_t> words_;
+};
+
+class DcalcCacheKeyHash
+{
+public:
+  size_t operator()(const DcalcCacheKey &key) const { return key.hash(); }
+};
+
+// Per thread cache of driver arc delay calculation results.
+class DcalcCache
+{
+public:
+  // Return the cached result for key or nullptr.
+  const ArcDcalcResult *find(const DcalcCacheKey &key);
+  void insert(const DcalcCacheKey &key,
+              const ArcDcalcResult &result);
+  void clear();
+  size_t hitCount() const { return hit_count_; }
+  size_t missCount() const { return miss_count_; }
+  void clearCounts();
+
+private:
+  std::unordered_map<DcalcCacheKey, ArcDcalcResult, DcalcCacheKeyHash> results_;
+  size_t hit_count_{0};
+  size_t miss_count_{0};
+  // Results are discarded when the cache grows past this size.
+  static constexpr size_t max_size_ = 1 << 18;
+};
+
+} // namespace sta
@@ -0,0 +1,83 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#include "DcalcProfile.hh"
+
+#include <algorithm>
+
+namespace sta {
+
+static bool
+drvrTimeGreater(const DcalcProfileDrvr &drvr1,
+                const DcalcProfileDrvr &drvr2)
+{
+  return drvr1.time > drvr2.time;
+}
+
+void
+DcalcProfile::addCounts(const ArcDelayCalc *arc_delay_calc)
+{
+  arc_delay_calc->addCounts(counts_);
+}
+
+void
+DcalcProfile::addDrvr(const Vertex *drvr_vertex,
+                      double time)
+{
+  if (drvrs_.size() < drvr_count_max) {
+    drvrs_.push_back({drvr_vertex, time});
+    std::push_heap(drvrs_.begin(), drvrs_.end(), drvrTimeGreater);
+  }
+  else if (time > drvrs_.front().time) {
+    // Replace the fastest driver.
+    std::pop_heap(drvrs_.begin(), drvrs_.end(), drvrTimeGreater);
+    drvrs_.back() = {drvr_vertex, time};
+    std::push_heap(drvrs_.begin(), drvrs_.end(), drvrTimeGreater);
+  }
+}
+
+void
+DcalcProfile::deleteDrvr(const Vertex *drvr_vertex)
+{
+  size_t erase_count = std::erase_if(drvrs_, [=] (const DcalcProfileDrvr &drvr) {
+    return drvr.vertex == drvr_vertex;
+  });
+  if (erase_count > 0)
+    std::make_heap(drvrs_.begin(), drvrs_.end(), drvrTimeGreater);
+}
+
+void
+DcalcProfile::clearDrvrs()
+{
+  drvrs_.clear();
+}
+
+void
+DcalcProfile::clear()
+{
+  counts_.clear();
+  drvrs_.clear();
+}
+
+} // namespace sta
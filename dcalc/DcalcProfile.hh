@@ -0,0 +1,63 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <vector>
+
+#include "ArcDelayCalc.hh"
+#include "GraphClass.hh"
+
+namespace sta {
+
+struct DcalcProfileDrvr
+{
+  const Vertex *vertex{nullptr};
+  double time{0.0};
+};
+
+// Per thread delay calculation profile. The delay calculator counts are
+// added when a thread's delay calculator copy is deleted. The driver
+// evaluations that take the most time are kept in a bounded min heap
+// so profiling is cheap enough to leave on.
+class DcalcProfile
+{
+public:
+  void addCounts(const ArcDelayCalc *arc_delay_calc);
+  void addDrvr(const Vertex *drvr_vertex,
+               double time);
+  const ArcDcalcCountsMap &counts() const { return counts_; }
+  const std::vector<DcalcProfileDrvr> &drvrs() const { return drvrs_; }
+  void deleteDrvr(const Vertex *drvr_vertex);
+  void clearDrvrs();
+  void clear();
+
+  static constexpr size_t drvr_count_max = 1000;
+
+private:
+  ArcDcalcCountsMap counts_;
+  std::vector<DcalcProfileDrvr> drvrs_;
+};
+
+} // namespace sta
@@ -31,6 +31,7 @@
 #include "CcsCeffDelayCalc.hh"
 #include "ContainerHelpers.hh"
 #include "DmpDelayCalc.hh"
+#include "HybridDelayCalc.hh"
 #include "LumpedCapDelayCalc.hh"
 #include "PrimaDelayCalc.hh"
 #include "StringUtil.hh"
@@ -52,6 +53,7 @@ registerDelayCalcs()
   registerDelayCalc("arnoldi", makeArnoldiDelayCalc);
   registerDelayCalc("ccs_ceff", makeCcsCeffDelayCalc);
   registerDelayCalc("prima", makePrimaDelayCalc);
+  registerDelayCalc("hybrid", makeHybridDelayCalc);
 }
 
 void
@@ -29,7 +29,9 @@
 #include "ArcDelayCalc.hh"
 #include "DelayCalc.hh"
 #include "Sta.hh"
+#include "Graph.hh"
 #include "dcalc/ArcDcalcWaveforms.hh"
+#include "dcalc/HybridDelayCalc.hh"
 #include "dcalc/PrimaDelayCalc.hh"
 
 %}
@@ -60,6 +62,12 @@ set_delay_calc_incremental_tolerance(float tol)
   Sta::sta()->setIncrementalDelayTolerance(tol);
 }
 
+void
+set_delay_calc_cache_tolerance(float tol)
+{
+  Sta::sta()->setDelayCalcCacheTolerance(tol);
+}
+
 std::string
 report_delay_calc_cmd(Edge *edge,
                       TimingArc *arc,
@@ -71,6 +79,18 @@ report_delay_calc_cmd(Edge *edge,
   return sta->reportDelayCalc(edge, arc, scene, min_max, digits);
 }
 
+void
+report_dcalc_profile_cmd(int top_count)
+{
+  Sta::sta()->reportDelayCalcProfile(top_count);
+}
+
+void
+clear_dcalc_profile_cmd()
+{
+  Sta::sta()->clearDelayCalcProfile();
+}
+
 void
 set_prima_reduce_order(size_t order)
 {
@@ -82,6 +102,57 @@ set_prima_reduce_order(size_t order)
   }
 }
 
+bool
+is_hybrid_delay_calc()
+{
+  return dynamic_cast<HybridDelayCalc*>(Sta::sta()->arcDelayCalc()) != nullptr;
+}
+
+void
+set_hybrid_dcalc_lumped_ratio(float ratio)
+{
+  Sta *sta = Sta::sta();
+  HybridDelayCalc *dcalc = dynamic_cast<HybridDelayCalc*>(sta->arcDelayCalc());
+  if (dcalc) {
+    dcalc->setLumpedRatio(ratio);
+    sta->delaysInvalid();
+  }
+}
+
+void
+set_hybrid_dcalc_resistive_ratio(float ratio)
+{
+  Sta *sta = Sta::sta();
+  HybridDelayCalc *dcalc = dynamic_cast<HybridDelayCalc*>(sta->arcDelayCalc());
+  if (dcalc) {
+    dcalc->setResistiveRatio(ratio);
+    sta->delaysInvalid();
+  }
+}
+
+// Drivers with max slack less than slack in the current timing are
+// timed with prima.
+void
+set_hybrid_dcalc_critical_slack(float slack)
+{
+  Sta *sta = Sta::sta();
+  HybridDelayCalc *dcalc = dynamic_cast<HybridDelayCalc*>(sta->arcDelayCalc());
+  if (dcalc) {
+    sta->ensureGraph();
+    Network *network = sta->network();
+    PinSet critical_drvrs(network);
+    VertexIterator vertex_iter(sta->graph());
+    while (vertex_iter.hasNext()) {
+      Vertex *vertex = vertex_iter.next();
+      if (vertex->isDriver(network)
+          && delayLess(sta->slack(vertex, MinMax::max()), slack, sta))
+        critical_drvrs.insert(vertex->pin());
+    }
+    dcalc->setCriticalDrvrs(std::move(critical_drvrs));
+    sta->delaysInvalid();
+  }
+}
+
 void
 find_delays()
 {
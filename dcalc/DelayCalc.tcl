@@ -137,6 +137,36 @@ proc set_delay_calculator { alg } {
 
 ################################################################
 
+define_cmd_args "set_hybrid_delay_calc" \
+  {[-lumped_ratio ratio] [-resistive_ratio ratio] [-critical_slack slack]}
+
+proc set_hybrid_delay_calc { args } {
+  parse_key_args "set_hybrid_delay_calc" args \
+    keys {-lumped_ratio -resistive_ratio -critical_slack} flags {}
+  check_argc_eq0 "set_hybrid_delay_calc" $args
+
+  if { ![is_hybrid_delay_calc] } {
+    sta_error 2519 "set_hybrid_delay_calc requires set_delay_calculator hybrid."
+  }
+  if [info exists keys(-lumped_ratio)] {
+    set ratio $keys(-lumped_ratio)
+    check_positive_float "-lumped_ratio" $ratio
+    set_hybrid_dcalc_lumped_ratio $ratio
+  }
+  if [info exists keys(-resistive_ratio)] {
+    set ratio $keys(-resistive_ratio)
+    check_positive_float "-resistive_ratio" $ratio
+    set_hybrid_dcalc_resistive_ratio $ratio
+  }
+  if [info exists keys(-critical_slack)] {
+    set slack $keys(-critical_slack)
+    check_float "-critical_slack" $slack
+    set_hybrid_dcalc_critical_slack [time_ui_sta $slack]
+  }
+}
+
+################################################################
+
 define_cmd_args "set_assigned_delay" \
   {-cell|-net [-rise] [-fall] [-scene scene] [-min] [-max]\
      [-from from_pins] [-to to_pins] delay}
@@ -409,5 +439,24 @@ proc report_slews { args } {
   }
 }
 
+################################################################
+
+define_cmd_args "report_dcalc_profile" {[-top count] [-clear]}
+
+proc_redirect report_dcalc_profile {
+  parse_key_args "report_dcalc_profile" args keys {-top} flags {-clear}
+  check_argc_eq0 "report_dcalc_profile" $args
+
+  set top 10
+  if [info exists keys(-top)] {
+    set top $keys(-top)
+    check_positive_integer "-top" $top
+  }
+  report_dcalc_profile_cmd $top
+  if [info exists flags(-clear)] {
+    clear_dcalc_profile_cmd
+  }
+}
+
 # sta namespace end
 }
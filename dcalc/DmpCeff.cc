@@ -98,6 +98,18 @@ DmpError::DmpError(std::string_view what) :
 
 ////////////////////////////////////////////////////////////////
 
+void
+DmpSolverStats::add(const DmpSolverStats &stats)
+{
+  solve_count += stats.solve_count;
+  iteration_count += stats.iteration_count;
+  failure_count += stats.failure_count;
+  warm_start_count += stats.warm_start_count;
+  warm_start_retry_count += stats.warm_start_retry_count;
+}
+
+////////////////////////////////////////////////////////////////
+
 DmpAlg::DmpAlg(int nr_order,
                StaState *sta) :
   StaState(sta),
@@ -454,6 +466,7 @@ DmpAlg::showVl()
 void
 DmpAlg::fail(std::string_view reason)
 {
+  solver_stats_.failure_count++;
   // Report failures with a unique debug flag.
   if (debug_->check("dmp_ceff", 1) || debug_->check("dcalc_error", 1))
     report_->report("delay_calc: DMP failed - {} c2={} rpi={} c1={} rd={}", reason,
@@ -607,6 +620,7 @@ DmpPi::gateDelaySlew()
     }
   } catch (DmpError &error) {
     fail(error.what());
+    ceff_ratio_ = 0.0;
     // Driver calculation failed - use Ceff=c1+c2.
     ceff_ = c1_ + c2_;
     std::tie(delay, slew) = gateCapDelaySlew(ceff_);
@@ -615,14 +629,34 @@ DmpPi::gateDelaySlew()
   return {delay, slew};
 }
 
+void
+DmpPi::setWarmStart(bool warm_start)
+{
+  warm_start_ = warm_start;
+}
+
 void
 DmpPi::findDriverParamsPi()
 {
-  try {
-    findDriverParams(c2_ + c1_);
-  } catch (DmpError &) {
-    findDriverParams(c2_);
+  double c_total = c2_ + c1_;
+  bool solved = false;
+  if (warm_start_ && ceff_ratio_ > 0.0) {
+    solver_stats_.warm_start_count++;
+    try {
+      findDriverParams(ceff_ratio_ * c_total);
+      solved = true;
+    } catch (DmpError &) {
+      solver_stats_.warm_start_retry_count++;
+    }
+  }
+  if (!solved) {
+    try {
+      findDriverParams(c_total);
+    } catch (DmpError &) {
+      findDriverParams(c2_);
+    }
   }
+  ceff_ratio_ = ceff_ / c_total;
 }
 
 // Given x_ as a vector of input parameters, fill fvec_ with the
@@ -908,7 +942,9 @@ DmpAlg::newtonRaphson(Eigen::Vector3d &x)
   Eigen::Matrix3d fjac = Eigen::Matrix3d::Zero();
   Eigen::Vector3d p = Eigen::Vector3d::Zero();
 
+  solver_stats_.solve_count++;
   for (int k = 0; k < newton_raphson_max_iter_; k++) {
+    solver_stats_.iteration_count++;
     evalDmpEqns(x, fvec, fjac);
 
     p = solveNewtonStep(fjac, fvec);
@@ -922,6 +958,7 @@ DmpAlg::newtonRaphson(Eigen::Vector3d &x)
     x.head(nr_order_) += p.head(nr_order_);
 
     if (all_under_x_tol) {
+      debugPrint(debug_, "dmp_ceff", 2, "    newton iterations {}", k + 1);
       return;
     }
   }
@@ -996,6 +1033,61 @@ DmpCeffDelayCalc::DmpCeffDelayCalc(StaState *sta) :
 {
 }
 
+// Copies used by delay calc threads start with empty solver state.
+DmpCeffDelayCalc::DmpCeffDelayCalc(const DmpCeffDelayCalc &dcalc) :
+  LumpedCapDelayCalc(dcalc),
+  dmp_cap_(this),
+  dmp_pi_(this),
+  dmp_zero_c2_(this)
+{
+}
+
+// Report solver statistics with "set_debug stats 2".
+DmpCeffDelayCalc::~DmpCeffDelayCalc()
+{
+  if (debug_->statsLevel() > 1) {
+    DmpSolverStats stats = solverStats();
+    if (stats.solve_count > 0)
+      report_->report("stats: dmp solves {} newton iterations {} failures {} "
+                      "warm starts {} retries {}",
+                      stats.solve_count,
+                      stats.iteration_count,
+                      stats.failure_count,
+                      stats.warm_start_count,
+                      stats.warm_start_retry_count);
+  }
+}
+
+// DMP solver failures fall back to the lumped capacitance delay.
+void
+DmpCeffDelayCalc::addCounts(ArcDcalcCountsMap &counts) const
+{
+  DmpSolverStats stats = solverStats();
+  ArcDcalcCounts &dcalc_counts = counts[std::string(name())];
+  dcalc_counts.add(counts_);
+  dcalc_counts.newton_iteration_count += stats.iteration_count;
+  dcalc_counts.fallback_count += stats.failure_count;
+}
+
+void
+DmpCeffDelayCalc::clearCounts()
+{
+  ArcDelayCalc::clearCounts();
+  dmp_cap_.clearSolverStats();
+  dmp_pi_.clearSolverStats();
+  dmp_zero_c2_.clearSolverStats();
+}
+
+DmpSolverStats
+DmpCeffDelayCalc::solverStats() const
+{
+  DmpSolverStats stats;
+  stats.add(dmp_cap_.solverStats());
+  stats.add(dmp_pi_.solverStats());
+  stats.add(dmp_zero_c2_.solverStats());
+  return stats;
+}
+
 ArcDcalcResult
 DmpCeffDelayCalc::gateDelay(const Pin *drvr_pin,
                             const TimingArc *arc,
@@ -1021,6 +1113,8 @@ DmpCeffDelayCalc::gateDelay(const Pin *drvr_pin,
     const Pvt *pvt = pinPvt(drvr_pin, scene, min_max);
     setCeffAlgorithm(drvr_library, drvr_cell, pvt,
                      table_model, rf, in_slew1, c2, rpi, c1);
+    dmp_pi_.setWarmStart(drvr_pin == warm_drvr_pin_);
+    warm_drvr_pin_ = drvr_pin;
     auto [gate_delay, drvr_slew] = gateDelaySlew();
 
     // Fill in pocv parameters.
@@ -1054,6 +1148,8 @@ DmpCeffDelayCalc::gateDelay(const Pin *drvr_pin,
     ArcDcalcResult dcalc_result =
         LumpedCapDelayCalc::gateDelay(drvr_pin, arc, in_slew, load_cap, parasitic,
                                       load_pin_index_map, scene, min_max);
+    if (parasitic)
+      incrFallbackCount();
     if (parasitic && !unsuppored_model_warned_) {
       unsuppored_model_warned_ = true;
       report_->warn(1041,
@@ -1065,6 +1161,13 @@ DmpCeffDelayCalc::gateDelay(const Pin *drvr_pin,
   }
 }
 
+// Without a parasitic gateDelay uses the lumped cap table lookup.
+bool
+DmpCeffDelayCalc::lumpedCapGateDelay(const ArcDcalcArg &arg) const
+{
+  return arg.parasitic() == nullptr;
+}
+
 void
 DmpCeffDelayCalc::setCeffAlgorithm(const LibertyLibrary *drvr_library,
                                    const LibertyCell *drvr_cell,
@@ -1191,6 +1294,14 @@ DmpCeffDelayCalc::loadDelaySlewElmore(const Pin *load_pin,
   return std::nullopt;
 }
 
+// Only the arcs of one driver warm start from each other.
+void
+DmpCeffDelayCalc::finishDrvrPin()
+{
+  LumpedCapDelayCalc::finishDrvrPin();
+  warm_drvr_pin_ = nullptr;
+}
+
 // Notify algorithm components.
 void
 DmpCeffDelayCalc::copyState(const StaState *sta)
@@ -37,6 +37,20 @@ namespace sta {
 
 class GateTableModel;
 
+// Newton-Raphson driver parameter solver statistics.
+struct DmpSolverStats
+{
+  void add(const DmpSolverStats &stats);
+
+  size_t solve_count{0};
+  size_t iteration_count{0};
+  size_t failure_count{0};
+  size_t warm_start_count{0};
+  // Warm starts that did not converge and were solved from the
+  // generic initial guess.
+  size_t warm_start_retry_count{0};
+};
+
 // Base class for Dartu/Menezes/Pileggi algorithm.
 // Derived classes handle different cases of zero values in the Pi model.
 class DmpAlg : public StaState
@@ -61,6 +75,8 @@ public:
   virtual std::pair<double, double> loadDelaySlew(const Pin *load_pin,
                                                   double elmore);
   double ceff() { return ceff_; }
+  const DmpSolverStats &solverStats() const { return solver_stats_; }
+  void clearSolverStats() { solver_stats_ = DmpSolverStats(); }
 
   virtual void
   evalDmpEqns(Eigen::Vector3d &x,
@@ -151,6 +167,7 @@ protected:
 
   // Driver parameter Newton-Raphson state.
   int nr_order_;
+  DmpSolverStats solver_stats_;
 
   static constexpr int max_nr_order_ = 3;
 
@@ -227,6 +244,9 @@ public:
   evalDmpEqns(Eigen::Vector3d &x,
               Eigen::Vector3d &fvec,
               Eigen::Matrix3d &fjac) override;
+  // Start the next solve from the Ceff/(C1+C2) ratio of the last
+  // solution (the other rise/fall or scene of the same driver).
+  void setWarmStart(bool warm_start);
 
 protected:
   double voCrossingUpperBound() override;
@@ -254,6 +274,9 @@ private:
   double A_{0.0};
   double B_{0.0};
   double D_{0.0};
+  // Ceff/(C1+C2) of the last solution, zero if there is none.
+  double ceff_ratio_{0.0};
+  bool warm_start_{false};
 };
 
 // Capacitive load, so Ceff is known.
@@ -311,6 +334,8 @@ class DmpCeffDelayCalc : public LumpedCapDelayCalc
 {
 public:
   DmpCeffDelayCalc(StaState *sta);
+  DmpCeffDelayCalc(const DmpCeffDelayCalc &dcalc);
+  ~DmpCeffDelayCalc() override;
   bool reduceSupported() const override { return true; }
   ArcDcalcResult gateDelay(const Pin *drvr_pin,
                            const TimingArc *arc,
@@ -329,9 +354,14 @@ public:
                               const Scene *scene,
                               const MinMax *min_max,
                               int digits) override;
+  void finishDrvrPin() override;
   void copyState(const StaState *sta) override;
+  void addCounts(ArcDcalcCountsMap &counts) const override;
+  void clearCounts() override;
+  DmpSolverStats solverStats() const;
 
 protected:
+  bool lumpedCapGateDelay(const ArcDcalcArg &arg) const override;
   virtual void loadDelaySlew(const Pin *load_pin,
                              double drvr_slew,
                              const RiseFall *rf,
@@ -364,6 +394,8 @@ private:
   DmpPi dmp_pi_;
   DmpZeroC2 dmp_zero_c2_;
   DmpAlg *dmp_alg_{nullptr};
+  // Driver of the last pi model solution used to warm start the next.
+  const Pin *warm_drvr_pin_{nullptr};
 };
 
 } // namespace sta
@@ -27,6 +27,7 @@
 #include "DmpCeff.hh"
 #include "GraphDelayCalc.hh"
 #include "Liberty.hh"
+#include "Machine.hh"
 #include "Network.hh"
 #include "Parasitics.hh"
 #include "PortDirection.hh"
@@ -239,8 +240,10 @@ DmpCeffTwoPoleDelayCalc::findParasitic(const Pin *drvr_pin,
   Parasitic *parasitic_network =
     parasitics->findParasiticNetwork(drvr_pin);
   if (parasitic_network) {
+    double begin_time = elapsedRunTime();
     parasitic = parasitics->reduceToPiPoleResidue2(parasitic_network, drvr_pin, rf,
                                                    scene, min_max);
+    incrReduction(begin_time);
     if (parasitic)
       return parasitic;
   }
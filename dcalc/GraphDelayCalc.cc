@@ -26,17 +26,25 @@
 
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
 #include <set>
 #include <string_view>
+#include <vector>
 
 #include "ArcDelayCalc.hh"
 #include "Bfs.hh"
 #include "ClkNetwork.hh"
 #include "ContainerHelpers.hh"
+#include "DcalcCache.hh"
+#include "DcalcProfile.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Graph.hh"
 #include "InputDrive.hh"
 #include "Liberty.hh"
+#include "Machine.hh"
 #include "MinMax.hh"
 #include "Mode.hh"
 #include "Mutex.hh"
@@ -158,6 +166,8 @@ GraphDelayCalc::~GraphDelayCalc()
   delete search_non_latch_pred_;
   delete iter_;
   deleteMultiDrvrNets();
+  deleteCaches();
+  deleteContents(profiles_);
   delete observer_;
 }
 
@@ -189,6 +199,7 @@ GraphDelayCalc::clear()
 {
   delaysInvalid();
   deleteMultiDrvrNets();
+  clearProfileDrvrs();
 }
 
 float
@@ -221,6 +232,9 @@ GraphDelayCalc::delaysInvalid()
   invalid_delays_.clear();
   invalid_check_edges_.clear();
   invalid_latch_edges_.clear();
+  clearCaches();
+  if (arc_delay_calc_)
+    arc_delay_calc_->parasiticsInvalid(nullptr);
 }
 
 void
@@ -250,6 +264,8 @@ GraphDelayCalc::delayInvalid(Vertex *vertex)
 {
   debugPrint(debug_, "delay_calc", 2, "delay invalid {}",
              vertex->to_string(this));
+  if (arc_delay_calc_ && vertex->isDriver(network_))
+    arc_delay_calc_->parasiticsInvalid(vertex->pin());
   if (delays_exist_) {
     invalid_delays_.insert(vertex);
     // Invalidate driver that triggers dcalc for multi-driver nets.
@@ -278,11 +294,16 @@ GraphDelayCalc::deleteVertexBefore(Vertex *vertex)
   iter_->deleteVertexBefore(vertex);
   if (delays_exist_)
     invalid_delays_.erase(vertex);
+  deleteProfileDrvr(vertex);
   MultiDrvrNet *multi_drvr = multiDrvrNet(vertex);
   if (multi_drvr) {
     // Don't bother incrementally updating MultiDrvrNet.
-    for (Vertex *drvr_vertex : multi_drvr->drvrs())
+    // The remaining drivers find their delays without the deleted one.
+    for (Vertex *drvr_vertex : multi_drvr->drvrs()) {
       multi_drvr_net_map_.erase(drvr_vertex);
+      if (delays_exist_ && drvr_vertex != vertex)
+        invalid_delays_.insert(drvr_vertex);
+    }
     delete multi_drvr;
   }
 }
@@ -296,17 +317,26 @@ public:
   FindVertexDelays(const FindVertexDelays &find_vertex_delays);
   ~FindVertexDelays() override;
   void visit(Vertex *vertex) override;
+  void levelFinished() override;
   VertexVisitor *copy() const override;
 
 protected:
   GraphDelayCalc *graph_delay_calc_;
   ArcDelayCalc *arc_delay_calc_;
+  DcalcCache *cache_;
+  DcalcProfile *profile_;
+  // Per thread delay calculators for multi-driver net tasks.
+  std::vector<ArcDelayCalc*> multi_drvr_calcs_;
+  std::vector<DcalcCache*> multi_drvr_caches_;
+  std::vector<DcalcProfile*> multi_drvr_profiles_;
 };
 
 FindVertexDelays::FindVertexDelays(GraphDelayCalc *graph_delay_calc) :
   VertexVisitor(),
   graph_delay_calc_(graph_delay_calc),
-  arc_delay_calc_(graph_delay_calc_->arc_delay_calc_->copy())
+  arc_delay_calc_(graph_delay_calc_->arc_delay_calc_->copy()),
+  cache_(graph_delay_calc_->acquireCache()),
+  profile_(graph_delay_calc_->acquireProfile())
 {
 }
 
@@ -317,7 +347,17 @@ FindVertexDelays::FindVertexDelays(const FindVertexDelays &find_vertex_delays) :
 
 FindVertexDelays::~FindVertexDelays()
 {
+  profile_->addCounts(arc_delay_calc_);
   delete arc_delay_calc_;
+  graph_delay_calc_->releaseCache(cache_);
+  graph_delay_calc_->releaseProfile(profile_);
+  for (size_t i = 0; i < multi_drvr_calcs_.size(); i++) {
+    DcalcProfile *profile = multi_drvr_profiles_[i];
+    profile->addCounts(multi_drvr_calcs_[i]);
+    graph_delay_calc_->releaseCache(multi_drvr_caches_[i]);
+    graph_delay_calc_->releaseProfile(profile);
+  }
+  deleteContents(multi_drvr_calcs_);
 }
 
 VertexVisitor *
@@ -331,7 +371,25 @@ FindVertexDelays::copy() const
 void
 FindVertexDelays::visit(Vertex *vertex)
 {
-  graph_delay_calc_->findVertexDelay(vertex, arc_delay_calc_);
+  graph_delay_calc_->findVertexDelay(vertex, arc_delay_calc_, cache_, profile_);
+}
+
+void
+FindVertexDelays::levelFinished()
+{
+  if (!graph_delay_calc_->multi_drvr_pending_.empty()) {
+    if (multi_drvr_calcs_.empty()) {
+      size_t thread_count = graph_delay_calc_->threadCount();
+      for (size_t i = 0; i < thread_count; i++) {
+        multi_drvr_calcs_.push_back(graph_delay_calc_->arc_delay_calc_->copy());
+        multi_drvr_caches_.push_back(graph_delay_calc_->acquireCache());
+        multi_drvr_profiles_.push_back(graph_delay_calc_->acquireProfile());
+      }
+    }
+    graph_delay_calc_->findMultiDrvrDelays(multi_drvr_calcs_,
+                                           multi_drvr_caches_,
+                                           multi_drvr_profiles_);
+  }
 }
 
 // The logical structure of incremental delay calculation closely
@@ -343,6 +401,7 @@ GraphDelayCalc::findDelays(Level level)
   Stats stats(debug_, report_);
   int dcalc_count = 0;
   debugPrint(debug_, "delay_calc", 1, "find delays to level {}", level);
+  findMultiDrvrNets();
   if (!delays_seeded_) {
     iter_->clear();
     seedRootSlews();
@@ -353,10 +412,16 @@ GraphDelayCalc::findDelays(Level level)
   if (delays_exist_)
     seedInvalidDelays();
 
+  for (DcalcCache *cache : caches_)
+    cache->clearCounts();
+  size_t call_count = profileCallCount();
   if (!iter_->empty()) {
     FindVertexDelays visitor(this);
+    multi_drvr_tasks_ = thread_count_ > 1;
     dcalc_count += iter_->visitParallel(level, &visitor);
+    multi_drvr_tasks_ = false;
   }
+  call_count = profileCallCount() - call_count;
 
   // Timing checks require slews at both ends of the arc,
   // so find their delays after all slews are known.
@@ -371,6 +436,19 @@ GraphDelayCalc::findDelays(Level level)
   delays_exist_ = true;
   debugPrint(debug_, "delay_calc", 1, "found {} delays", dcalc_count);
   stats.report("Delay calc");
+  stats.reportCount("Delay calc gate delays", call_count);
+  if (!caches_.empty()) {
+    size_t hit_count = 0;
+    size_t miss_count = 0;
+    for (DcalcCache *cache : caches_) {
+      hit_count += cache->hitCount();
+      miss_count += cache->missCount();
+    }
+    debugPrint(debug_, "delay_calc", 1, "cache hits {} misses {}",
+               hit_count, miss_count);
+    stats.reportCount("Delay calc cache hits", hit_count);
+    stats.reportCount("Delay calc cache misses", miss_count);
+  }
 }
 
 void
@@ -675,12 +753,14 @@ GraphDelayCalc::findInputArcDelay(const Pin *drvr_pin,
 void
 GraphDelayCalc::findDelays(Vertex *drvr_vertex)
 {
-  findVertexDelay(drvr_vertex, arc_delay_calc_);
+  findVertexDelay(drvr_vertex, arc_delay_calc_, nullptr, nullptr);
 }
 
 void
 GraphDelayCalc::findVertexDelay(Vertex *vertex,
-                                ArcDelayCalc *arc_delay_calc)
+                                ArcDelayCalc *arc_delay_calc,
+                                DcalcCache *cache,
+                                DcalcProfile *profile)
 {
   const Pin *pin = vertex->pin();
   debugPrint(debug_, "delay_calc", 2, "find delays {} ({})",
@@ -694,26 +774,22 @@ GraphDelayCalc::findVertexDelay(Vertex *vertex,
     seedRootSlew(vertex, arc_delay_calc);
   else if (network_->isLeaf(pin)
            && vertex->isDriver(network_)) {
+    MultiDrvrNet *multi_drvr = multiDrvrNet(vertex);
+    if (multi_drvr_tasks_
+        && multi_drvr
+        && vertex == multi_drvr->dcalcDrvr()) {
+      // Found by findMultiDrvrDelays when the level is finished.
+      LockGuard lock(multi_drvr_lock_);
+      multi_drvr_pending_.push_back(multi_drvr);
+      return;
+    }
     LoadPinIndexMap load_pin_index_map = makeLoadPinIndexMap(vertex);
     DrvrLoadSlews load_slews_prev;
     if (delays_exist_)
       load_slews_prev = loadSlews(load_pin_index_map);
-    findDriverDelays(vertex, arc_delay_calc, load_pin_index_map);
-    if (network_->direction(pin)->isInternal())
-      enqueueCheckEdges(vertex);
-    graph_->visitFanouts(vertex, search_non_latch_pred_,
-                         [this, &load_slews_prev, &load_pin_index_map]
-                         (Vertex *fanout) {
-                           // Enqueue adjacent vertices even if the load slew
-                           // did not change when non-incremental to stride
-                           // past annotations.
-                           if (!delays_exist_
-                               || loadSlewChanged(fanout, load_slews_prev,
-                                                  load_pin_index_map)) {
-                             iter_->enqueue(fanout);
-                             fanout->setBfsPredecessorChanged(true);
-                           }
-                         });
+    findDriverDelays(vertex, multi_drvr, arc_delay_calc, cache, profile,
+                     load_pin_index_map);
+    enqueueDrvrFanouts(vertex, load_slews_prev, load_pin_index_map);
   }
   else if (vertex->isLoad(network_)) {
     // Load vertex.
@@ -727,6 +803,28 @@ GraphDelayCalc::findVertexDelay(Vertex *vertex,
   }
 }
 
+void
+GraphDelayCalc::enqueueDrvrFanouts(Vertex *drvr_vertex,
+                                   DrvrLoadSlews &load_slews_prev,
+                                   LoadPinIndexMap &load_pin_index_map)
+{
+  if (network_->direction(drvr_vertex->pin())->isInternal())
+    enqueueCheckEdges(drvr_vertex);
+  graph_->visitFanouts(drvr_vertex, search_non_latch_pred_,
+                       [this, &load_slews_prev, &load_pin_index_map]
+                       (Vertex *fanout) {
+                         // Enqueue adjacent vertices even if the load slew
+                         // did not change when non-incremental to stride
+                         // past annotations.
+                         if (!delays_exist_
+                             || loadSlewChanged(fanout, load_slews_prev,
+                                                load_pin_index_map)) {
+                           iter_->enqueue(fanout);
+                           fanout->setBfsPredecessorChanged(true);
+                         }
+                       });
+}
+
 DrvrLoadSlews
 GraphDelayCalc::loadSlews(LoadPinIndexMap &load_pin_index_map)
 {
@@ -796,35 +894,126 @@ GraphDelayCalc::enqueueCheckEdges(Vertex *vertex)
 
 void
 GraphDelayCalc::findDriverDelays(Vertex *drvr_vertex,
+                                 MultiDrvrNet *multi_drvr,
                                  ArcDelayCalc *arc_delay_calc,
+                                 DcalcCache *cache,
+                                 DcalcProfile *profile,
                                  LoadPinIndexMap &load_pin_index_map)
 {
-  MultiDrvrNet *multi_drvr = findMultiDrvrNet(drvr_vertex);
   if (multi_drvr == nullptr) {
+    double begin_time = elapsedRunTime();
     initLoadSlews(drvr_vertex);
-    findDriverDelays1(drvr_vertex, multi_drvr, arc_delay_calc, load_pin_index_map);
+    findDriverDelays1(drvr_vertex, multi_drvr, arc_delay_calc, cache,
+                      load_pin_index_map);
+    profileDrvr(drvr_vertex, begin_time, arc_delay_calc, profile);
   }
   else if (drvr_vertex == multi_drvr->dcalcDrvr()) {
+    double begin_time = elapsedRunTime();
     initLoadSlews(drvr_vertex);
     for (Vertex *drvr : multi_drvr->drvrs())
-      findDriverDelays1(drvr, multi_drvr, arc_delay_calc, load_pin_index_map);
+      findDriverDelays1(drvr, multi_drvr, arc_delay_calc, cache,
+                        load_pin_index_map);
+    profileDrvr(drvr_vertex, begin_time, arc_delay_calc, profile);
   }
   arc_delay_calc->finishDrvrPin();
 }
 
-MultiDrvrNet *
+void
+GraphDelayCalc::profileDrvr(const Vertex *drvr_vertex,
+                            double begin_time,
+                            ArcDelayCalc *arc_delay_calc,
+                            DcalcProfile *profile)
+{
+  double time = elapsedRunTime() - begin_time;
+  arc_delay_calc->incrTime(time);
+  if (profile)
+    profile->addDrvr(drvr_vertex, time);
+  debugPrint(debug_, "delay_calc_profile", 1, "{} {:.3f}us",
+             drvr_vertex->to_string(this), time * 1e6);
+}
+
+// Find the multi-driver nets before the delay calc threads look them
+// up. Only drivers with invalid delays can be on new multi-driver nets
+// when delays exist.
+void
+GraphDelayCalc::findMultiDrvrNets()
+{
+  if (delays_exist_) {
+    for (Vertex *vertex : invalid_delays_)
+      findMultiDrvrNet(vertex);
+  }
+  else {
+    VertexIterator vertex_iter(graph_);
+    while (vertex_iter.hasNext()) {
+      Vertex *vertex = vertex_iter.next();
+      findMultiDrvrNet(vertex);
+    }
+  }
+}
+
+void
 GraphDelayCalc::findMultiDrvrNet(Vertex *drvr_vertex)
 {
-  // Avoid locking for single driver nets.
-  if (hasMultiDrvrs(drvr_vertex)) {
-    LockGuard lock(multi_drvr_lock_);
-    MultiDrvrNet *multi_drvr = multiDrvrNet(drvr_vertex);
-    if (multi_drvr)
-      return multi_drvr;
-    multi_drvr = makeMultiDrvrNet(drvr_vertex);
-    return multi_drvr;
+  if (isLeafDriver(drvr_vertex->pin(), network_)
+      && multiDrvrNet(drvr_vertex) == nullptr
+      && hasMultiDrvrs(drvr_vertex))
+    makeMultiDrvrNet(drvr_vertex);
+}
+
+// Find the driver delays of the multi-driver nets deferred by a level.
+// Each driver is a separate task unless the drivers are parallel gates,
+// whose delays depend on all of the drivers.
+void
+GraphDelayCalc::findMultiDrvrDelays(std::vector<ArcDelayCalc*> &arc_delay_calcs,
+                                    std::vector<DcalcCache*> &caches,
+                                    std::vector<DcalcProfile*> &profiles)
+{
+  size_t net_count = multi_drvr_pending_.size();
+  std::vector<LoadPinIndexMap> load_pin_index_maps;
+  std::vector<DrvrLoadSlews> load_slews_prev(net_count);
+  load_pin_index_maps.reserve(net_count);
+  for (size_t i = 0; i < net_count; i++) {
+    Vertex *dcalc_drvr = multi_drvr_pending_[i]->dcalcDrvr();
+    load_pin_index_maps.push_back(makeLoadPinIndexMap(dcalc_drvr));
+    if (delays_exist_)
+      load_slews_prev[i] = loadSlews(load_pin_index_maps[i]);
+    initLoadSlews(dcalc_drvr);
   }
-  return nullptr;
+
+  lock_multi_drvr_loads_ = true;
+  for (size_t i = 0; i < net_count; i++) {
+    MultiDrvrNet *multi_drvr = multi_drvr_pending_[i];
+    if (multi_drvr->parallelGates(network_))
+      dispatch_queue_->dispatch([&, i, multi_drvr] (size_t thread) {
+        double begin_time = elapsedRunTime();
+        LoadPinIndexMap load_pin_index_map = load_pin_index_maps[i];
+        for (Vertex *drvr : multi_drvr->drvrs())
+          findDriverDelays1(drvr, multi_drvr, arc_delay_calcs[thread],
+                            caches[thread], load_pin_index_map);
+        arc_delay_calcs[thread]->finishDrvrPin();
+        profileDrvr(multi_drvr->dcalcDrvr(), begin_time,
+                    arc_delay_calcs[thread], profiles[thread]);
+      });
+    else {
+      for (Vertex *drvr : multi_drvr->drvrs())
+        dispatch_queue_->dispatch([&, i, multi_drvr, drvr] (size_t thread) {
+          double begin_time = elapsedRunTime();
+          LoadPinIndexMap load_pin_index_map = load_pin_index_maps[i];
+          findDriverDelays1(drvr, multi_drvr, arc_delay_calcs[thread],
+                            caches[thread], load_pin_index_map);
+          arc_delay_calcs[thread]->finishDrvrPin();
+          profileDrvr(drvr, begin_time, arc_delay_calcs[thread],
+                      profiles[thread]);
+        });
+    }
+  }
+  dispatch_queue_->finishTasks();
+  lock_multi_drvr_loads_ = false;
+
+  for (size_t i = 0; i < net_count; i++)
+    enqueueDrvrFanouts(multi_drvr_pending_[i]->dcalcDrvr(), load_slews_prev[i],
+                       load_pin_index_maps[i]);
+  multi_drvr_pending_.clear();
 }
 
 bool
@@ -940,6 +1129,7 @@ bool
 GraphDelayCalc::findDriverDelays1(Vertex *drvr_vertex,
                                   MultiDrvrNet *multi_drvr,
                                   ArcDelayCalc *arc_delay_calc,
+                                  DcalcCache *cache,
                                   LoadPinIndexMap &load_pin_index_map)
 {
   initSlew(drvr_vertex);
@@ -951,8 +1141,8 @@ GraphDelayCalc::findDriverDelays1(Vertex *drvr_vertex,
     Edge *edge = edge_iter.next();
     if (!edge->role()->isLatchDtoQ())
       delay_changed |= findDriverEdgeDelays(drvr_vertex, multi_drvr, edge,
-                                            arc_delay_calc, load_pin_index_map,
-                                            delay_exists);
+                                            arc_delay_calc, cache,
+                                            load_pin_index_map, delay_exists);
   }
   for (const RiseFall *rf : RiseFall::range()) {
     if (!delay_exists[rf->index()])
@@ -990,8 +1180,8 @@ GraphDelayCalc::findLatchEdgeDelays(Edge *edge)
   std::array<bool, RiseFall::index_count> delay_exists = {false, false};
   LoadPinIndexMap load_pin_index_map = makeLoadPinIndexMap(drvr_vertex);
   bool delay_changed = findDriverEdgeDelays(drvr_vertex, nullptr, edge,
-                                            arc_delay_calc_, load_pin_index_map,
-                                            delay_exists);
+                                            arc_delay_calc_, nullptr,
+                                            load_pin_index_map, delay_exists);
   if (delay_changed && observer_)
     observer_->delayChangedTo(drvr_vertex);
 }
@@ -1001,6 +1191,7 @@ GraphDelayCalc::findDriverEdgeDelays(Vertex *drvr_vertex,
                                      const MultiDrvrNet *multi_drvr,
                                      Edge *edge,
                                      ArcDelayCalc *arc_delay_calc,
+                                     DcalcCache *cache,
                                      LoadPinIndexMap &load_pin_index_map,
                                      // Return value.
                                      std::array<bool, RiseFall::index_count> &delay_exists)
@@ -1009,18 +1200,38 @@ GraphDelayCalc::findDriverEdgeDelays(Vertex *drvr_vertex,
   const TimingArcSet *arc_set = edge->timingArcSet();
   bool delay_changed = false;
 
+  // Scenes that search thru the edge. Scenes share modes so the search
+  // predicate is only checked when the mode changes.
+  SceneSeq edge_scenes;
+  const Mode *prev_mode = nullptr;
+  bool search_thru = false;
   for (Scene *scene : scenes_) {
     const Mode *mode = scene->mode();
-    if (search_pred_->searchFrom(from_vertex, mode)
-        && search_pred_->searchThru(edge, mode)) {
-      for (const MinMax *min_max : MinMax::range()) {
-        for (const TimingArc *arc : arc_set->arcs()) {
-          delay_changed |= findDriverArcDelays(drvr_vertex, multi_drvr, edge, arc,
-                                               scene, min_max, arc_delay_calc,
-                                               load_pin_index_map);
-          delay_exists[arc->toEdge()->asRiseFall()->index()] = true;
+    if (mode != prev_mode) {
+      search_thru = search_pred_->searchFrom(from_vertex, mode)
+        && search_pred_->searchThru(edge, mode);
+      prev_mode = mode;
+    }
+    if (search_thru)
+      edge_scenes.push_back(scene);
+  }
+
+  if (!edge_scenes.empty()) {
+    bool parallel_gates = multi_drvr && multi_drvr->parallelGates(network_);
+    for (const TimingArc *arc : arc_set->arcs()) {
+      if (parallel_gates) {
+        for (const Scene *scene : edge_scenes) {
+          for (const MinMax *min_max : MinMax::range())
+            delay_changed |= findDriverArcDelays(drvr_vertex, multi_drvr, edge, arc,
+                                                 scene, min_max, arc_delay_calc,
+                                                 load_pin_index_map);
         }
       }
+      else
+        delay_changed |= findDriverArcDelays(drvr_vertex, multi_drvr, edge, arc,
+                                             edge_scenes, arc_delay_calc, cache,
+                                             load_pin_index_map);
+      delay_exists[arc->toEdge()->asRiseFall()->index()] = true;
     }
   }
   if (delay_changed && observer_) {
@@ -1070,6 +1281,7 @@ GraphDelayCalc::findDriverArcDelays(Vertex *drvr_vertex,
       ArcDcalcArgSeq dcalc_args = makeArcDcalcArgs(drvr_vertex, multi_drvr,
                                                    edge, arc, scene, min_max,
                                                    arc_delay_calc);
+      arc_delay_calc->incrCallCount(dcalc_args.size());
       ArcDcalcResultSeq dcalc_results =
         arc_delay_calc->gateDelays(dcalc_args, load_pin_index_map, scene, min_max);
       for (size_t drvr_idx = 0; drvr_idx < dcalc_args.size(); drvr_idx++) {
@@ -1083,6 +1295,7 @@ GraphDelayCalc::findDriverArcDelays(Vertex *drvr_vertex,
     else {
       Vertex *from_vertex = edge->from(graph_);
       const Slew in_slew = edgeFromSlew(from_vertex, from_rf, edge, scene, min_max);
+      arc_delay_calc->incrCallCount(1);
       ArcDcalcResult dcalc_result = arc_delay_calc->gateDelay(drvr_pin, arc, in_slew,
                                                               load_cap, parasitic,
                                                               load_pin_index_map,
@@ -1095,6 +1308,380 @@ GraphDelayCalc::findDriverArcDelays(Vertex *drvr_vertex,
   return delay_changed;
 }
 
+// Find the arc delays for all scene/min_max analysis points with one
+// delay calculator call.
+bool
+GraphDelayCalc::findDriverArcDelays(Vertex *drvr_vertex,
+                                    const MultiDrvrNet *multi_drvr,
+                                    Edge *edge,
+                                    const TimingArc *arc,
+                                    const SceneSeq &scenes,
+                                    ArcDelayCalc *arc_delay_calc,
+                                    DcalcCache *cache,
+                                    LoadPinIndexMap &load_pin_index_map)
+{
+  bool delay_changed = false;
+  const RiseFall *from_rf = arc->fromEdge()->asRiseFall();
+  const RiseFall *drvr_rf = arc->toEdge()->asRiseFall();
+  if (from_rf && drvr_rf) {
+    const Pin *drvr_pin = drvr_vertex->pin();
+    Vertex *from_vertex = edge->from(graph_);
+    const Pin *from_pin = from_vertex->pin();
+    ArcDcalcArgSeq dcalc_args;
+    dcalc_args.reserve(scenes.size() * MinMax::index_count);
+    for (const Scene *scene : scenes) {
+      for (const MinMax *min_max : MinMax::range()) {
+        const Parasitic *parasitic;
+        float load_cap;
+        parasiticLoad(drvr_pin, drvr_rf, scene, min_max, multi_drvr, arc_delay_calc,
+                      load_cap, parasitic);
+        const Slew in_slew = edgeFromSlew(from_vertex, from_rf, edge, scene, min_max);
+        ArcDcalcArg &dcalc_arg = dcalc_args.emplace_back(from_pin, drvr_pin, edge, arc,
+                                                         in_slew, load_cap, parasitic);
+        dcalc_arg.setAnalysisPt(scene, min_max);
+      }
+    }
+    if (cache == nullptr)
+      arc_delay_calc->incrCallCount(dcalc_args.size());
+    ArcDcalcResultSeq dcalc_results = cache
+      ? cachedSceneGateDelays(dcalc_args, load_pin_index_map, arc_delay_calc, cache)
+      : arc_delay_calc->sceneGateDelays(dcalc_args, load_pin_index_map);
+    for (size_t i = 0; i < dcalc_args.size(); i++) {
+      const ArcDcalcArg &dcalc_arg = dcalc_args[i];
+      delay_changed |= annotateDelaysSlews(edge, arc, dcalc_results[i],
+                                           load_pin_index_map,
+                                           dcalc_arg.scene(), dcalc_arg.minMax());
+    }
+    arc_delay_calc->finishDrvrPin();
+  }
+  return delay_changed;
+}
+
+// Reuse the results for args with the same arc, quantized input slew
+// and reduced load as an earlier driver. Misses are found at the
+// quantized slew so the results do not depend on the order drivers
+// are visited.
+ArcDcalcResultSeq
+GraphDelayCalc::cachedSceneGateDelays(ArcDcalcArgSeq &dcalc_args,
+                                      const LoadPinIndexMap &load_pin_index_map,
+                                      ArcDelayCalc *arc_delay_calc,
+                                      DcalcCache *cache)
+{
+  size_t arg_count = dcalc_args.size();
+  ArcDcalcResultSeq dcalc_results(arg_count);
+  std::vector<DcalcCacheKey> keys(arg_count);
+  std::vector<bool> cacheable(arg_count, false);
+  ArcDcalcArgSeq miss_args;
+  std::vector<size_t> miss_indices;
+  for (size_t i = 0; i < arg_count; i++) {
+    const ArcDcalcArg &dcalc_arg = dcalc_args[i];
+    Slew cache_slew;
+    if (makeCacheKey(dcalc_arg, load_pin_index_map, keys[i], cache_slew)) {
+      const ArcDcalcResult *dcalc_result = cache->find(keys[i]);
+      if (dcalc_result) {
+        dcalc_results[i] = *dcalc_result;
+        continue;
+      }
+      cacheable[i] = true;
+      ArcDcalcArg &miss_arg = miss_args.emplace_back(dcalc_arg);
+      miss_arg.setInSlew(cache_slew);
+    }
+    else
+      miss_args.push_back(dcalc_arg);
+    miss_indices.push_back(i);
+  }
+  if (!miss_args.empty()) {
+    arc_delay_calc->incrCallCount(miss_args.size());
+    ArcDcalcResultSeq miss_results =
+      arc_delay_calc->sceneGateDelays(miss_args, load_pin_index_map);
+    for (size_t k = 0; k < miss_indices.size(); k++) {
+      size_t i = miss_indices[k];
+      if (cacheable[i])
+        cache->insert(keys[i], miss_results[k]);
+      dcalc_results[i] = std::move(miss_results[k]);
+    }
+  }
+  return dcalc_results;
+}
+
+// The key is the arc, gate model, pvt, quantized input slew, load cap
+// and the reduced parasitic and liberty port of each load.
+// Return false if the arg result cannot be cached.
+bool
+GraphDelayCalc::makeCacheKey(const ArcDcalcArg &dcalc_arg,
+                             const LoadPinIndexMap &load_pin_index_map,
+                             // Return values.
+                             DcalcCacheKey &key,
+                             Slew &cache_slew) const
+{
+  const Scene *scene = dcalc_arg.scene();
+  const MinMax *min_max = dcalc_arg.minMax();
+  const TimingArc *arc = dcalc_arg.arc();
+  const Sdc *sdc = scene->sdc();
+  const Instance *drvr_inst = network_->instance(dcalc_arg.drvrPin());
+  const Pvt *pvt = sdc->pvt(drvr_inst, min_max);
+  if (pvt == nullptr)
+    pvt = sdc->operatingConditions(min_max);
+  key.addPointer(arc);
+  key.addPointer(arc->gateModel(scene, min_max));
+  key.addPointer(pvt);
+  key.addPointer(min_max);
+
+  // Quantize the input slew on a log scale.
+  float in_slew = dcalc_arg.inSlewFlt();
+  if (in_slew > 0.0) {
+    double slew_step = std::log1p(cache_tolerance_);
+    int64_t slew_index = std::llround(std::log(in_slew) / slew_step);
+    key.addInt(slew_index);
+    cache_slew = std::exp(slew_index * slew_step);
+  }
+  else {
+    key.addInt(std::numeric_limits<int64_t>::min());
+    key.addFloat(in_slew);
+    cache_slew = in_slew;
+  }
+  key.addFloat(dcalc_arg.loadCap());
+
+  // Loads in result index order.
+  std::vector<const Pin*> load_pins(load_pin_index_map.size());
+  for (const auto [load_pin, load_idx] : load_pin_index_map)
+    load_pins[load_idx] = load_pin;
+
+  const Parasitic *parasitic = dcalc_arg.parasitic();
+  if (parasitic) {
+    const Parasitics *parasitics = scene->parasitics(min_max);
+    bool pi_elmore = parasitics->isPiElmore(parasitic);
+    if (!pi_elmore && !parasitics->isPiPoleResidue(parasitic))
+      return false;
+    float c2, rpi, c1;
+    parasitics->piModel(parasitic, c2, rpi, c1);
+    key.addFloat(c2);
+    key.addFloat(rpi);
+    key.addFloat(c1);
+    for (const Pin *load_pin : load_pins) {
+      key.addPointer(network_->libertyPort(load_pin));
+      if (pi_elmore) {
+        float elmore;
+        bool exists;
+        parasitics->findElmore(parasitic, load_pin, elmore, exists);
+        key.addInt(exists);
+        key.addFloat(exists ? elmore : 0.0F);
+      }
+      else {
+        const Parasitic *pole_residue = parasitics->findPoleResidue(parasitic,
+                                                                    load_pin);
+        if (pole_residue) {
+          int pole_count = parasitics->poleResidueCount(pole_residue);
+          key.addInt(pole_count);
+          for (int i = 0; i < pole_count; i++) {
+            ComplexFloat pole, residue;
+            parasitics->poleResidue(pole_residue, i, pole, residue);
+            key.addFloat(pole.real());
+            key.addFloat(pole.imag());
+            key.addFloat(residue.real());
+            key.addFloat(residue.imag());
+          }
+        }
+        else
+          key.addInt(-1);
+      }
+    }
+  }
+  else {
+    for (const Pin *load_pin : load_pins)
+      key.addPointer(network_->libertyPort(load_pin));
+  }
+  return true;
+}
+
+void
+GraphDelayCalc::setCacheTolerance(float tol)
+{
+  cache_tolerance_ = tol;
+  if (tol == 0.0)
+    deleteCaches();
+  else
+    clearCaches();
+}
+
+// Return nullptr when the cache is disabled.
+DcalcCache *
+GraphDelayCalc::acquireCache()
+{
+  if (cache_tolerance_ == 0.0
+      || variables_->pocvEnabled())
+    return nullptr;
+  LockGuard lock(cache_lock_);
+  if (free_caches_.empty()) {
+    DcalcCache *cache = new DcalcCache;
+    caches_.push_back(cache);
+    return cache;
+  }
+  DcalcCache *cache = free_caches_.back();
+  free_caches_.pop_back();
+  return cache;
+}
+
+void
+GraphDelayCalc::releaseCache(DcalcCache *cache)
+{
+  if (cache) {
+    LockGuard lock(cache_lock_);
+    free_caches_.push_back(cache);
+  }
+}
+
+DcalcProfile *
+GraphDelayCalc::acquireProfile()
+{
+  LockGuard lock(profile_lock_);
+  if (free_profiles_.empty()) {
+    DcalcProfile *profile = new DcalcProfile;
+    profiles_.push_back(profile);
+    return profile;
+  }
+  DcalcProfile *profile = free_profiles_.back();
+  free_profiles_.pop_back();
+  return profile;
+}
+
+void
+GraphDelayCalc::releaseProfile(DcalcProfile *profile)
+{
+  LockGuard lock(profile_lock_);
+  free_profiles_.push_back(profile);
+}
+
+void
+GraphDelayCalc::clearProfile()
+{
+  for (DcalcProfile *profile : profiles_)
+    profile->clear();
+  if (arc_delay_calc_)
+    arc_delay_calc_->clearCounts();
+}
+
+// Add the counts of the delay calculator to the profile before it is deleted.
+void
+GraphDelayCalc::keepProfileCounts()
+{
+  if (arc_delay_calc_) {
+    DcalcProfile *profile = acquireProfile();
+    profile->addCounts(arc_delay_calc_);
+    releaseProfile(profile);
+  }
+}
+
+// Driver vertex pointers are not kept when vertices are deleted.
+void
+GraphDelayCalc::clearProfileDrvrs()
+{
+  for (DcalcProfile *profile : profiles_)
+    profile->clearDrvrs();
+}
+
+void
+GraphDelayCalc::deleteProfileDrvr(const Vertex *drvr_vertex)
+{
+  for (DcalcProfile *profile : profiles_)
+    profile->deleteDrvr(drvr_vertex);
+}
+
+// Sum the delay calculator thread profiles and the counts of the delay
+// calculator used directly by findDelays(Vertex*) and findDriverArcDelays.
+ArcDcalcCountsMap
+GraphDelayCalc::profileCounts() const
+{
+  ArcDcalcCountsMap counts;
+  for (const DcalcProfile *profile : profiles_) {
+    for (const auto &[name, dcalc_counts] : profile->counts())
+      counts[name].add(dcalc_counts);
+  }
+  if (arc_delay_calc_)
+    arc_delay_calc_->addCounts(counts);
+  return counts;
+}
+
+size_t
+GraphDelayCalc::profileCallCount() const
+{
+  size_t call_count = 0;
+  for (const DcalcProfile *profile : profiles_) {
+    for (const auto &[name, counts] : profile->counts())
+      call_count += counts.call_count;
+  }
+  return call_count;
+}
+
+void
+GraphDelayCalc::reportProfile(size_t top_count)
+{
+  ArcDcalcCountsMap counts = profileCounts();
+  std::map<const Vertex*, DcalcProfileDrvr> drvr_map;
+  for (const DcalcProfile *profile : profiles_) {
+    for (const DcalcProfileDrvr &drvr : profile->drvrs()) {
+      DcalcProfileDrvr &drvr_sum = drvr_map[drvr.vertex];
+      drvr_sum.vertex = drvr.vertex;
+      drvr_sum.time += drvr.time;
+    }
+  }
+
+  report_->report("Delay calculator      Calls  Time (s)     Newton  Fallbacks "
+                  "Reductions Reduce (s)");
+  report_->report("--------------------------------------------------------------"
+                  "--------------------");
+  for (const auto &[name, dcalc_counts] : counts)
+    report_->report("{:<17} {:>9} {:>9.3f} {:>10} {:>10} {:>10} {:>10.3f}",
+                    name,
+                    dcalc_counts.call_count,
+                    dcalc_counts.time,
+                    dcalc_counts.newton_iteration_count,
+                    dcalc_counts.fallback_count,
+                    dcalc_counts.reduction_count,
+                    dcalc_counts.reduction_time);
+
+  std::vector<DcalcProfileDrvr> drvrs;
+  for (const auto &[vertex, drvr] : drvr_map)
+    drvrs.push_back(drvr);
+  sort(drvrs, [] (const DcalcProfileDrvr &drvr1,
+                  const DcalcProfileDrvr &drvr2) {
+    return drvr1.time > drvr2.time
+      || (drvr1.time == drvr2.time
+          && drvr1.vertex->level() < drvr2.vertex->level());
+  });
+  if (drvrs.size() > top_count)
+    drvrs.resize(top_count);
+  if (!drvrs.empty()) {
+    report_->reportBlankLine();
+    report_->report("Driver                         Net                  "
+                    "Time (ms)");
+    report_->report("--------------------------------------------------------------"
+                    "--------------------");
+    for (const DcalcProfileDrvr &drvr : drvrs) {
+      const Pin *pin = drvr.vertex->pin();
+      const Net *net = network_->net(pin);
+      report_->report("{:<30} {:<20} {:>9.3f}",
+                      sdc_network_->pathName(pin),
+                      net ? sdc_network_->pathName(net) : "",
+                      drvr.time * 1e3);
+    }
+  }
+}
+
+void
+GraphDelayCalc::clearCaches()
+{
+  for (DcalcCache *cache : caches_)
+    cache->clear();
+}
+
+void
+GraphDelayCalc::deleteCaches()
+{
+  deleteContents(caches_);
+  free_caches_.clear();
+}
+
 ArcDcalcArgSeq
 GraphDelayCalc::makeArcDcalcArgs(Vertex *drvr_vertex,
                                  const MultiDrvrNet *multi_drvr,
@@ -1256,6 +1843,12 @@ GraphDelayCalc::annotateLoadDelays(Vertex *drvr_vertex,
                                    const MinMax *min_max)
 {
   DcalcAPIndex ap_index = scene->dcalcAnalysisPtIndex(min_max);
+  std::unique_lock<std::mutex> load_lock;
+  if (lock_multi_drvr_loads_) {
+    MultiDrvrNet *multi_drvr = multiDrvrNet(drvr_vertex);
+    if (multi_drvr)
+      load_lock = std::unique_lock<std::mutex>(multi_drvr->loadLock());
+  }
   VertexOutEdgeIterator edge_iter(drvr_vertex, graph_);
   while (edge_iter.hasNext()) {
     Edge *wire_edge = edge_iter.next();
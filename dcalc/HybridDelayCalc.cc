@@ -0,0 +1,420 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#include "HybridDelayCalc.hh"
+
+#include "ArnoldiDelayCalc.hh"
+#include "CcsCeffDelayCalc.hh"
+#include "Debug.hh"
+#include "DmpDelayCalc.hh"
+#include "Format.hh"
+#include "GraphDelayCalc.hh"
+#include "Liberty.hh"
+#include "LumpedCapDelayCalc.hh"
+#include "Network.hh"
+#include "Parasitics.hh"
+#include "PortDirection.hh"
+#include "PrimaDelayCalc.hh"
+#include "Scene.hh"
+#include "TableModel.hh"
+#include "TimingArc.hh"
+
+namespace sta {
+
+ArcDelayCalc *
+makeHybridDelayCalc(StaState *sta)
+{
+  return new HybridDelayCalc(sta);
+}
+
+HybridDelayCalc::HybridDelayCalc(StaState *sta) :
+  DelayCalcBase(sta),
+  lumped_cap_(makeLumpedCapDelayCalc(sta)),
+  dmp_(makeDmpCeffElmoreDelayCalc(sta)),
+  ccs_ceff_(makeCcsCeffDelayCalc(sta)),
+  arnoldi_(makeArnoldiDelayCalc(sta)),
+  prima_(makePrimaDelayCalc(sta))
+{
+}
+
+HybridDelayCalc::HybridDelayCalc(const HybridDelayCalc &dcalc) :
+  DelayCalcBase(dcalc),
+  lumped_ratio_(dcalc.lumped_ratio_),
+  resistive_ratio_(dcalc.resistive_ratio_),
+  critical_drvrs_(dcalc.critical_drvrs_),
+  lumped_cap_(dcalc.lumped_cap_->copy()),
+  dmp_(dcalc.dmp_->copy()),
+  ccs_ceff_(dcalc.ccs_ceff_->copy()),
+  arnoldi_(dcalc.arnoldi_->copy()),
+  prima_(dcalc.prima_->copy())
+{
+}
+
+HybridDelayCalc::~HybridDelayCalc()
+{
+  delete lumped_cap_;
+  delete dmp_;
+  delete ccs_ceff_;
+  delete arnoldi_;
+  delete prima_;
+}
+
+ArcDelayCalc *
+HybridDelayCalc::copy()
+{
+  return new HybridDelayCalc(*this);
+}
+
+// Notify algorithm components.
+void
+HybridDelayCalc::copyState(const StaState *sta)
+{
+  StaState::copyState(sta);
+  lumped_cap_->copyState(sta);
+  dmp_->copyState(sta);
+  ccs_ceff_->copyState(sta);
+  arnoldi_->copyState(sta);
+  prima_->copyState(sta);
+  port_waveforms_.clear();
+  finishDrvrPin();
+}
+
+void
+HybridDelayCalc::setLumpedRatio(float ratio)
+{
+  lumped_ratio_ = ratio;
+}
+
+void
+HybridDelayCalc::setResistiveRatio(float ratio)
+{
+  resistive_ratio_ = ratio;
+}
+
+void
+HybridDelayCalc::setCriticalDrvrs(PinSet critical_drvrs)
+{
+  critical_drvrs_ = std::make_shared<const PinSet>(std::move(critical_drvrs));
+}
+
+ArcDelayCalc *
+HybridDelayCalc::selectDelayCalc(const Pin *drvr_pin,
+                                 const Scene *scene,
+                                 const MinMax *min_max)
+{
+  select(drvr_pin, scene, min_max);
+  return select_dcalc_;
+}
+
+std::string
+HybridDelayCalc::selectReason(const Pin *drvr_pin,
+                              const Scene *scene,
+                              const MinMax *min_max)
+{
+  select(drvr_pin, scene, min_max);
+  return select_reason_;
+}
+
+// The selection only depends on the driver pin, scene and min/max
+// so findParasitic and the delay functions for a driver agree on the
+// parasitic representation.
+void
+HybridDelayCalc::select(const Pin *drvr_pin,
+                        const Scene *scene,
+                        const MinMax *min_max)
+{
+  if (drvr_pin == select_drvr_pin_
+      && scene == select_scene_
+      && min_max == select_min_max_)
+    return;
+  select_drvr_pin_ = drvr_pin;
+  select_scene_ = scene;
+  select_min_max_ = min_max;
+
+  Parasitics *parasitics = scene->parasitics(min_max);
+  const Parasitic *parasitic_network = parasitics
+    ? parasitics->findParasiticNetwork(drvr_pin)
+    : nullptr;
+  const LibertyPort *drvr_port = network_->libertyPort(drvr_pin);
+  if (parasitic_network == nullptr
+      || drvr_port == nullptr
+      || network_->direction(drvr_pin)->isInternal()) {
+    const Parasitic *reduced = dmp_->findParasitic(drvr_pin, RiseFall::rise(),
+                                                   scene, min_max);
+    if (reduced) {
+      select_dcalc_ = dmp_;
+      select_reason_ = "reduced parasitics";
+    }
+    else {
+      select_dcalc_ = lumped_cap_;
+      select_reason_ = "no parasitics";
+    }
+  }
+  else if (critical_drvrs_ && critical_drvrs_->contains(drvr_pin)) {
+    select_dcalc_ = prima_;
+    select_reason_ = "critical";
+  }
+  else {
+    size_t node_count = parasitics->nodeCount(parasitic_network);
+    float wire_tau, total_cap;
+    networkTau(parasitic_network, parasitics, drvr_pin, scene, min_max,
+               wire_tau, total_cap);
+    float drvr_tau = driveResistance(drvr_pin, scene, min_max) * total_cap;
+    float tau_ratio = drvr_tau > 0.0 ? wire_tau / drvr_tau : 0.0;
+    if (tau_ratio < lumped_ratio_)
+      select_dcalc_ = lumped_cap_;
+    else if (tau_ratio < resistive_ratio_)
+      select_dcalc_ = hasOutputWaveforms(drvr_port, scene, min_max)
+        ? ccs_ceff_
+        : dmp_;
+    else
+      select_dcalc_ = arnoldi_;
+    select_reason_ = sta::format("nodes {} wire/driver tau {:.3f}",
+                                 node_count, tau_ratio);
+  }
+  debugPrint(debug_, "delay_calc_hybrid", 1, "{} {} ({})",
+             network_->pathName(drvr_pin),
+             select_dcalc_->name(),
+             select_reason_);
+}
+
+// The wire tau is the elmore delay of the total network resistance
+// driving half the wire capacitance and the load pin capacitance, an
+// upper bound of the elmore delays to the loads. It is found from the
+// network without reducing it.
+void
+HybridDelayCalc::networkTau(const Parasitic *parasitic_network,
+                            const Parasitics *parasitics,
+                            const Pin *drvr_pin,
+                            const Scene *scene,
+                            const MinMax *min_max,
+                            // Return values.
+                            float &wire_tau,
+                            float &total_cap)
+{
+  float res = 0.0;
+  for (const ParasiticResistor *resistor : parasitics->resistors(parasitic_network))
+    res += parasitics->value(resistor);
+  float wire_cap = parasitics->capacitance(parasitic_network);
+  float pin_cap, wire_cap1, fanout;
+  bool has_net_load;
+  graph_delay_calc_->netCaps(drvr_pin, RiseFall::rise(), scene, min_max,
+                             pin_cap, wire_cap1, fanout, has_net_load);
+  wire_tau = res * (wire_cap * 0.5F + pin_cap);
+  total_cap = wire_cap + pin_cap;
+}
+
+float
+HybridDelayCalc::driveResistance(const Pin *drvr_pin,
+                                 const Scene *scene,
+                                 const MinMax *min_max)
+{
+  const LibertyPort *drvr_port = network_->libertyPort(drvr_pin);
+  const LibertyPort *scene_port = drvr_port->scenePort(scene, min_max);
+  if (scene_port == nullptr)
+    scene_port = drvr_port;
+  return scene_port->driveResistance();
+}
+
+bool
+HybridDelayCalc::hasOutputWaveforms(const LibertyPort *drvr_port,
+                                    const Scene *scene,
+                                    const MinMax *min_max)
+{
+  auto itr = port_waveforms_.find(drvr_port);
+  if (itr != port_waveforms_.end())
+    return itr->second;
+  bool has_waveforms = false;
+  const LibertyCell *cell = drvr_port->libertyCell();
+  for (const TimingArcSet *arc_set : cell->timingArcSetsTo(drvr_port)) {
+    for (const TimingArc *arc : arc_set->arcs()) {
+      GateTableModel *table_model = arc->gateTableModel(scene, min_max);
+      if (table_model && table_model->outputWaveforms()) {
+        has_waveforms = true;
+        break;
+      }
+    }
+    if (has_waveforms)
+      break;
+  }
+  port_waveforms_[drvr_port] = has_waveforms;
+  return has_waveforms;
+}
+
+////////////////////////////////////////////////////////////////
+
+Parasitic *
+HybridDelayCalc::findParasitic(const Pin *drvr_pin,
+                               const RiseFall *rf,
+                               const Scene *scene,
+                               const MinMax *min_max)
+{
+  return selectDelayCalc(drvr_pin, scene, min_max)->findParasitic(drvr_pin, rf,
+                                                                  scene, min_max);
+}
+
+// Parasitics reduced when they are read use the dmp representation.
+bool
+HybridDelayCalc::reduceSupported() const
+{
+  return dmp_->reduceSupported();
+}
+
+Parasitic *
+HybridDelayCalc::reduceParasitic(const Parasitic *parasitic_network,
+                                 const Pin *drvr_pin,
+                                 const RiseFall *rf,
+                                 const Scene *scene,
+                                 const MinMax *min_max)
+{
+  return dmp_->reduceParasitic(parasitic_network, drvr_pin, rf, scene, min_max);
+}
+
+void
+HybridDelayCalc::reduceParasitic(const Parasitic *parasitic_network,
+                                 const Net *net,
+                                 const Scene *scene,
+                                 const MinMaxAll *min_max)
+{
+  dmp_->reduceParasitic(parasitic_network, net, scene, min_max);
+}
+
+ArcDcalcResult
+HybridDelayCalc::inputPortDelay(const Pin *port_pin,
+                                float in_slew,
+                                const RiseFall *rf,
+                                const Parasitic *parasitic,
+                                const LoadPinIndexMap &load_pin_index_map,
+                                const Scene *scene,
+                                const MinMax *min_max)
+{
+  ArcDelayCalc *dcalc = selectDelayCalc(port_pin, scene, min_max);
+  return dcalc->inputPortDelay(port_pin, in_slew, rf, parasitic,
+                               load_pin_index_map, scene, min_max);
+}
+
+ArcDcalcResult
+HybridDelayCalc::gateDelay(const Pin *drvr_pin,
+                           const TimingArc *arc,
+                           const Slew &in_slew,
+                           float load_cap,
+                           const Parasitic *parasitic,
+                           const LoadPinIndexMap &load_pin_index_map,
+                           const Scene *scene,
+                           const MinMax *min_max)
+{
+  ArcDelayCalc *dcalc = selectDelayCalc(drvr_pin, scene, min_max);
+  dcalc->incrCallCount(1);
+  return dcalc->gateDelay(drvr_pin, arc, in_slew, load_cap, parasitic,
+                          load_pin_index_map, scene, min_max);
+}
+
+// Parallel drivers that select different delay calculators use dmp
+// with its own parasitics.
+ArcDcalcResultSeq
+HybridDelayCalc::gateDelays(ArcDcalcArgSeq &args,
+                            const LoadPinIndexMap &load_pin_index_map,
+                            const Scene *scene,
+                            const MinMax *min_max)
+{
+  ArcDelayCalc *dcalc = selectDelayCalc(args[0].drvrPin(), scene, min_max);
+  for (const ArcDcalcArg &arg : args) {
+    if (selectDelayCalc(arg.drvrPin(), scene, min_max) != dcalc) {
+      dmp_->setDcalcArgParasiticSlew(args, scene, min_max);
+      dmp_->incrCallCount(args.size());
+      return dmp_->gateDelays(args, load_pin_index_map, scene, min_max);
+    }
+  }
+  dcalc->incrCallCount(args.size());
+  return dcalc->gateDelays(args, load_pin_index_map, scene, min_max);
+}
+
+std::string
+HybridDelayCalc::reportGateDelay(const Pin *drvr_pin,
+                                 const TimingArc *arc,
+                                 const Slew &in_slew,
+                                 float load_cap,
+                                 const Parasitic *parasitic,
+                                 const LoadPinIndexMap &load_pin_index_map,
+                                 const Scene *scene,
+                                 const MinMax *min_max,
+                                 int digits)
+{
+  ArcDelayCalc *dcalc = selectDelayCalc(drvr_pin, scene, min_max);
+  std::string result = sta::format("Delay calculator: {} ({})\n",
+                                   dcalc->name(), select_reason_);
+  result += dcalc->reportGateDelay(drvr_pin, arc, in_slew, load_cap, parasitic,
+                                   load_pin_index_map, scene, min_max, digits);
+  return result;
+}
+
+void
+HybridDelayCalc::finishDrvrPin()
+{
+  lumped_cap_->finishDrvrPin();
+  dmp_->finishDrvrPin();
+  ccs_ceff_->finishDrvrPin();
+  arnoldi_->finishDrvrPin();
+  prima_->finishDrvrPin();
+  select_drvr_pin_ = nullptr;
+  select_dcalc_ = nullptr;
+}
+
+void
+HybridDelayCalc::parasiticsInvalid(const Pin *drvr_pin)
+{
+  lumped_cap_->parasiticsInvalid(drvr_pin);
+  dmp_->parasiticsInvalid(drvr_pin);
+  ccs_ceff_->parasiticsInvalid(drvr_pin);
+  arnoldi_->parasiticsInvalid(drvr_pin);
+  prima_->parasiticsInvalid(drvr_pin);
+}
+
+void
+HybridDelayCalc::addCounts(ArcDcalcCountsMap &counts) const
+{
+  // Gate delay calls are counted by the delay calculators they are
+  // delegated to so they are not counted twice.
+  ArcDcalcCounts hybrid_counts = counts_;
+  hybrid_counts.call_count = 0;
+  counts[std::string(name())].add(hybrid_counts);
+  lumped_cap_->addCounts(counts);
+  dmp_->addCounts(counts);
+  ccs_ceff_->addCounts(counts);
+  arnoldi_->addCounts(counts);
+  prima_->addCounts(counts);
+}
+
+void
+HybridDelayCalc::clearCounts()
+{
+  ArcDelayCalc::clearCounts();
+  lumped_cap_->clearCounts();
+  dmp_->clearCounts();
+  ccs_ceff_->clearCounts();
+  arnoldi_->clearCounts();
+  prima_->clearCounts();
+}
+
+} // namespace sta
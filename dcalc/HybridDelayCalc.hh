@@ -0,0 +1,163 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+//
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "DelayCalcBase.hh"
+#include "NetworkClass.hh"
+
+namespace sta {
+
+class LibertyPort;
+
+ArcDelayCalc *
+makeHybridDelayCalc(StaState *sta);
+
+// Delay calculator that chooses a delay calculator for each driver.
+//  no parasitics                          lumped_cap
+//  reduced parasitics (no network)        dmp_ceff_elmore
+//  critical driver from a previous pass   prima
+//  wire/driver tau < lumped_ratio         lumped_cap
+//  wire/driver tau < resistive_ratio      ccs_ceff (dmp_ceff_elmore without
+//                                         ccs output waveforms)
+//  otherwise                              arnoldi
+// The wire tau is the total network resistance times half the wire
+// capacitance plus the load pin capacitance, and the driver tau is the
+// driver resistance times the total capacitance. Neither reduces the
+// parasitic network. The calls delegated to each delay calculator are
+// added to its profile call count instead of the hybrid call count.
+class HybridDelayCalc : public DelayCalcBase
+{
+public:
+  HybridDelayCalc(StaState *sta);
+  HybridDelayCalc(const HybridDelayCalc &dcalc);
+  ~HybridDelayCalc() override;
+  ArcDelayCalc *copy() override;
+  void copyState(const StaState *sta) override;
+  std::string_view name() const override { return "hybrid"; }
+  void setLumpedRatio(float ratio);
+  void setResistiveRatio(float ratio);
+  // Drivers timed with prima.
+  void setCriticalDrvrs(PinSet critical_drvrs);
+  // Delay calculator chosen for drvr_pin and the reason for the choice.
+  ArcDelayCalc *selectDelayCalc(const Pin *drvr_pin,
+                                const Scene *scene,
+                                const MinMax *min_max);
+  std::string selectReason(const Pin *drvr_pin,
+                           const Scene *scene,
+                           const MinMax *min_max);
+
+  Parasitic *findParasitic(const Pin *drvr_pin,
+                           const RiseFall *rf,
+                           const Scene *scene,
+                           const MinMax *min_max) override;
+  bool reduceSupported() const override;
+  Parasitic *reduceParasitic(const Parasitic *parasitic_network,
+                             const Pin *drvr_pin,
+                             const RiseFall *rf,
+                             const Scene *scene,
+                             const MinMax *min_max) override;
+  void reduceParasitic(const Parasitic *parasitic_network,
+                       const Net *net,
+                       const Scene *scene,
+                       const MinMaxAll *min_max) override;
+  ArcDcalcResult inputPortDelay(const Pin *port_pin,
+                                float in_slew,
+                                const RiseFall *rf,
+                                const Parasitic *parasitic,
+                                const LoadPinIndexMap &load_pin_index_map,
+                                const Scene *scene,
+                                const MinMax *min_max) override;
+  ArcDcalcResult gateDelay(const Pin *drvr_pin,
+                           const TimingArc *arc,
+                           const Slew &in_slew,
+                           float load_cap,
+                           const Parasitic *parasitic,
+                           const LoadPinIndexMap &load_pin_index_map,
+                           const Scene *scene,
+                           const MinMax *min_max) override;
+  ArcDcalcResultSeq gateDelays(ArcDcalcArgSeq &args,
+                               const LoadPinIndexMap &load_pin_index_map,
+                               const Scene *scene,
+                               const MinMax *min_max) override;
+  std::string reportGateDelay(const Pin *drvr_pin,
+                              const TimingArc *arc,
+                              const Slew &in_slew,
+                              float load_cap,
+                              const Parasitic *parasitic,
+                              const LoadPinIndexMap &load_pin_index_map,
+                              const Scene *scene,
+                              const MinMax *min_max,
+                              int digits) override;
+  void finishDrvrPin() override;
+  void parasiticsInvalid(const Pin *drvr_pin) override;
+  void addCounts(ArcDcalcCountsMap &counts) const override;
+  void clearCounts() override;
+
+protected:
+  void select(const Pin *drvr_pin,
+              const Scene *scene,
+              const MinMax *min_max);
+  void networkTau(const Parasitic *parasitic_network,
+                  const Parasitics *parasitics,
+                  const Pin *drvr_pin,
+                  const Scene *scene,
+                  const MinMax *min_max,
+                  // Return values.
+                  float &wire_tau,
+                  float &total_cap);
+  float driveResistance(const Pin *drvr_pin,
+                        const Scene *scene,
+                        const MinMax *min_max);
+  bool hasOutputWaveforms(const LibertyPort *drvr_port,
+                          const Scene *scene,
+                          const MinMax *min_max);
+
+  float lumped_ratio_{0.02};
+  float resistive_ratio_{0.5};
+  // Shared by the copies used by delay calc threads.
+  std::shared_ptr<const PinSet> critical_drvrs_;
+
+  ArcDelayCalc *lumped_cap_;
+  ArcDelayCalc *dmp_;
+  ArcDelayCalc *ccs_ceff_;
+  ArcDelayCalc *arnoldi_;
+  ArcDelayCalc *prima_;
+
+  // Last selection.
+  const Pin *select_drvr_pin_{nullptr};
+  const Scene *select_scene_{nullptr};
+  const MinMax *select_min_max_{nullptr};
+  ArcDelayCalc *select_dcalc_{nullptr};
+  std::string select_reason_;
+  std::map<const LibertyPort*, bool> port_waveforms_;
+
+  using ArcDelayCalc::reduceParasitic;
+};
+
+} // namespace sta
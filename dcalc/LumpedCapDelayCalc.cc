@@ -25,14 +25,19 @@
 #include "LumpedCapDelayCalc.hh"
 
 #include <cmath>  // isnan
+#include <map>
+#include <utility>
+#include <vector>
 
 #include "Debug.hh"
 #include "GraphDelayCalc.hh"
 #include "Liberty.hh"
+#include "Machine.hh"
 #include "Network.hh"
 #include "Parasitics.hh"
 #include "PortDirection.hh"
 #include "Sdc.hh"
+#include "TableModel.hh"
 #include "TimingArc.hh"
 #include "TimingModel.hh"
 #include "Units.hh"
@@ -78,7 +83,9 @@ LumpedCapDelayCalc::findParasitic(const Pin *drvr_pin,
     return parasitic;
   Parasitic *parasitic_network = parasitics->findParasiticNetwork(drvr_pin);
   if (parasitic_network) {
+    double begin_time = elapsedRunTime();
     parasitic = reduceParasitic(parasitic_network, drvr_pin, rf, scene, min_max);
+    incrReduction(begin_time);
     if (parasitic)
       return parasitic;
   }
@@ -132,20 +139,12 @@ LumpedCapDelayCalc::gateDelay(const Pin *drvr_pin,
                               const MinMax *min_max)
 {
   GateTimingModel *model = arc->gateModel(scene, min_max);
-  debugPrint(debug_, "delay_calc", 3,
-             "    in_slew = {} load_cap = {} lumped",
-             delayAsString(in_slew, this),
-             units()->capacitanceUnit()->asString(load_cap));
+  checkGateDelayArgs(in_slew, load_cap);
   const RiseFall *rf = arc->toEdge()->asRiseFall();
   const LibertyLibrary *drvr_library = arc->to()->libertyLibrary();
   if (model) {
     float gate_delay, drvr_slew;
     float in_slew1 = delayAsFloat(in_slew);
-    // NaNs cause seg faults during table lookup.
-    if (std::isnan(load_cap))
-      report_->error(1350, "gate delay load cap is NaN");
-    if (std::isnan(in_slew.mean()))
-      report_->error(1351, "gate delay input slew is NaN");
     const Pvt *pvt = pinPvt(drvr_pin, scene, min_max);
     model->gateDelay(pvt, in_slew1, load_cap, gate_delay, drvr_slew);
 
@@ -162,6 +161,97 @@ LumpedCapDelayCalc::gateDelay(const Pin *drvr_pin,
     return makeResult(drvr_library, rf, delay_zero, delay_zero, load_pin_index_map);
 }
 
+void
+LumpedCapDelayCalc::checkGateDelayArgs(const Slew &in_slew,
+                                       float load_cap)
+{
+  debugPrint(debug_, "delay_calc", 3,
+             "    in_slew = {} load_cap = {} lumped",
+             delayAsString(in_slew, this),
+             units()->capacitanceUnit()->asString(load_cap));
+  // NaNs cause seg faults during table lookup.
+  if (std::isnan(load_cap))
+    report_->error(1350, "gate delay load cap is NaN");
+  if (std::isnan(in_slew.mean()))
+    report_->error(1351, "gate delay input slew is NaN");
+}
+
+// Lookup points of a gate table model and pvt.
+class GateTablePoints
+{
+public:
+  const GateTableModel *table_model;
+  const Pvt *pvt;
+  const ArcDcalcArg *arg;
+  std::vector<size_t> arg_indices;
+  FloatSeq in_slews;
+  FloatSeq load_caps;
+};
+
+// Analysis points that share a gate table model and pvt are found
+// with one batched table lookup.
+ArcDcalcResultSeq
+LumpedCapDelayCalc::sceneGateDelays(ArcDcalcArgSeq &args,
+                                    const LoadPinIndexMap &load_pin_index_map)
+{
+  if (variables_->pocvEnabled())
+    return ArcDelayCalc::sceneGateDelays(args, load_pin_index_map);
+
+  size_t arg_count = args.size();
+  ArcDcalcResultSeq dcalc_results(arg_count);
+  // Group the args by table model and pvt in one pass.
+  std::vector<GateTablePoints> groups;
+  std::map<std::pair<const GateTableModel*, const Pvt*>, size_t> group_index_map;
+  for (size_t i = 0; i < arg_count; i++) {
+    const ArcDcalcArg &arg = args[i];
+    const Scene *scene = arg.scene();
+    const MinMax *min_max = arg.minMax();
+    const GateTableModel *table_model = arg.arc()->gateTableModel(scene, min_max);
+    if (table_model && lumpedCapGateDelay(arg)) {
+      const Pvt *pvt = pinPvt(arg.drvrPin(), scene, min_max);
+      auto [group_iter, inserted] =
+        group_index_map.try_emplace({table_model, pvt}, groups.size());
+      if (inserted)
+        groups.push_back({table_model, pvt, &arg, {}, {}, {}});
+      GateTablePoints &group = groups[group_iter->second];
+      checkGateDelayArgs(arg.inSlew(), arg.loadCap());
+      group.arg_indices.push_back(i);
+      group.in_slews.push_back(arg.inSlewFlt());
+      group.load_caps.push_back(arg.loadCap());
+    }
+    else
+      dcalc_results[i] = gateDelay(arg.drvrPin(), arg.arc(), arg.inSlew(),
+                                   arg.loadCap(), arg.parasitic(),
+                                   load_pin_index_map, scene, min_max);
+  }
+
+  FloatSeq gate_delays;
+  FloatSeq drvr_slews;
+  for (const GateTablePoints &group : groups) {
+    size_t point_count = group.arg_indices.size();
+    gate_delays.resize(point_count);
+    drvr_slews.resize(point_count);
+    group.table_model->gateDelays(group.pvt, group.in_slews.data(),
+                                  group.load_caps.data(), point_count,
+                                  gate_delays.data(), drvr_slews.data());
+    const TimingArc *arc = group.arg->arc();
+    const RiseFall *rf = arc->toEdge()->asRiseFall();
+    const LibertyLibrary *drvr_library = arc->to()->libertyLibrary();
+    for (size_t k = 0; k < point_count; k++)
+      dcalc_results[group.arg_indices[k]] = makeResult(drvr_library, rf,
+                                                       gate_delays[k],
+                                                       drvr_slews[k],
+                                                       load_pin_index_map);
+  }
+  return dcalc_results;
+}
+
+bool
+LumpedCapDelayCalc::lumpedCapGateDelay(const ArcDcalcArg &) const
+{
+  return true;
+}
+
 ArcDcalcResult
 LumpedCapDelayCalc::makeResult(const LibertyLibrary *drvr_library,
                                const RiseFall *rf,
@@ -61,6 +61,8 @@ public:
                            const LoadPinIndexMap &load_pin_index_map,
                            const Scene *scene,
                            const MinMax *min_max) override;
+  ArcDcalcResultSeq sceneGateDelays(ArcDcalcArgSeq &args,
+                                    const LoadPinIndexMap &load_pin_index_map) override;
   std::string reportGateDelay(const Pin *check_pin,
                               const TimingArc *arc,
                               const Slew &in_slew,
@@ -72,6 +74,10 @@ public:
                               int digits) override;
 
 protected:
+  // Return true if gateDelay for arg is the lumped cap table lookup.
+  virtual bool lumpedCapGateDelay(const ArcDcalcArg &arg) const;
+  void checkGateDelayArgs(const Slew &in_slew,
+                          float load_cap);
   ArcDcalcResult makeResult(const LibertyLibrary *drvr_library,
                             const RiseFall *rf,
                             const ArcDelay &gate_delay,
@@ -26,6 +26,7 @@
 
 #include <Eigen/LU>
 #include <Eigen/QR>
+#include <algorithm>
 #include <cmath>  // abs
 #include <string_view>
 
@@ -35,6 +36,7 @@
 #include "Graph.hh"
 #include "GraphDelayCalc.hh"
 #include "Liberty.hh"
+#include "Machine.hh"
 #include "Network.hh"
 #include "Parasitics.hh"
 #include "PortDirection.hh"
@@ -61,6 +63,66 @@ makePrimaDelayCalc(StaState *sta)
   return new PrimaDelayCalc(sta);
 }
 
+// Matrices must be compressed.
+static bool
+samePattern(const MatrixSd &matrix1,
+            const MatrixSd &matrix2)
+{
+  if (matrix1.rows() != matrix2.rows()
+      || matrix1.cols() != matrix2.cols()
+      || matrix1.nonZeros() != matrix2.nonZeros())
+    return false;
+  return std::equal(matrix1.outerIndexPtr(),
+                    matrix1.outerIndexPtr() + matrix1.outerSize() + 1,
+                    matrix2.outerIndexPtr())
+    && std::equal(matrix1.innerIndexPtr(),
+                  matrix1.innerIndexPtr() + matrix1.nonZeros(),
+                  matrix2.innerIndexPtr());
+}
+
+static bool
+sameMatrix(const MatrixSd &matrix1,
+           const MatrixSd &matrix2)
+{
+  return samePattern(matrix1, matrix2)
+    && std::equal(matrix1.valuePtr(),
+                  matrix1.valuePtr() + matrix1.nonZeros(),
+                  matrix2.valuePtr());
+}
+
+bool
+PrimaLuFactor::factor(const MatrixSd &matrix)
+{
+  if (valid_ && samePattern(matrix, matrix_)) {
+    if (sameMatrix(matrix, matrix_))
+      return true;
+  }
+  else {
+    solver_.analyzePattern(matrix);
+    symbolic_count_++;
+  }
+  solver_.factorize(matrix);
+  numeric_count_++;
+  matrix_ = matrix;
+  valid_ = solver_.info() == Eigen::Success;
+  return false;
+}
+
+void
+PrimaLuFactor::clear()
+{
+  matrix_.resize(0, 0);
+  valid_ = false;
+}
+
+void
+PrimaDrvrStats::clear()
+{
+  *this = PrimaDrvrStats();
+}
+
+////////////////////////////////////////////////////////////////
+
 PrimaDelayCalc::PrimaDelayCalc(StaState *sta) :
   DelayCalcBase(sta),
   pin_node_map_(network_),
@@ -80,6 +142,7 @@ PrimaDelayCalc::PrimaDelayCalc(const PrimaDelayCalc &dcalc) :
 
 PrimaDelayCalc::~PrimaDelayCalc()
 {
+  reportDrvrStats();
   delete table_dcalc_;
 }
 
@@ -97,6 +160,20 @@ PrimaDelayCalc::copyState(const StaState *sta)
   table_dcalc_->copyState(sta);
 }
 
+void
+PrimaDelayCalc::addCounts(ArcDcalcCountsMap &counts) const
+{
+  ArcDelayCalc::addCounts(counts);
+  table_dcalc_->addCounts(counts);
+}
+
+void
+PrimaDelayCalc::clearCounts()
+{
+  ArcDelayCalc::clearCounts();
+  table_dcalc_->clearCounts();
+}
+
 Parasitic *
 PrimaDelayCalc::findParasitic(const Pin *drvr_pin,
                               const RiseFall *rf,
@@ -313,6 +390,7 @@ PrimaDelayCalc::failureReason()
 ArcDcalcResultSeq
 PrimaDelayCalc::tableDcalcResults()
 {
+  incrFallbackCount();
   for (size_t drvr_idx = 0; drvr_idx < drvr_count_; drvr_idx++) {
     ArcDcalcArg &dcalc_arg = (*dcalc_args_)[drvr_idx];
     const Pin *drvr_pin = dcalc_arg.drvrPin();
@@ -330,18 +408,63 @@ PrimaDelayCalc::tableDcalcResults()
 void
 PrimaDelayCalc::simulate()
 {
+  bool stats = debug_->statsLevel() > 1;
+  double begin_time = stats ? elapsedRunTime() : 0.0;
+  size_t symbolic_count = G_lu_.symbolicCount() + A_lu_.symbolicCount();
+  size_t numeric_count = G_lu_.numericCount() + A_lu_.numericCount();
   initSim();
   stampEqns();
   setXinit();
+  double stamp_time = stats ? elapsedRunTime() : 0.0;
+  double reduce_time = stamp_time;
 
   if (prima_order_ > 0 && node_count_ > prima_order_) {
     primaReduce();
+    if (stats)
+      reduce_time = elapsedRunTime();
     simulate1(Gq_, Cq_, Bq_, xq_init_, Vq_, prima_order_);
   }
   else {
     Eigen::MatrixXd x_to_v = Eigen::MatrixXd::Identity(order_, order_);
     simulate1(G_, C_, B_, x_init_, x_to_v, order_);
   }
+
+  if (stats) {
+    const Pin *drvr_pin = (*dcalc_args_)[0].drvrPin();
+    if (drvr_pin != drvr_stats_.drvr_pin) {
+      reportDrvrStats();
+      drvr_stats_.drvr_pin = drvr_pin;
+    }
+    drvr_stats_.node_count = node_count_;
+    drvr_stats_.call_count++;
+    drvr_stats_.symbolic_count += G_lu_.symbolicCount() + A_lu_.symbolicCount()
+      - symbolic_count;
+    drvr_stats_.numeric_count += G_lu_.numericCount() + A_lu_.numericCount()
+      - numeric_count;
+    drvr_stats_.stamp_time += stamp_time - begin_time;
+    drvr_stats_.reduce_time += reduce_time - stamp_time;
+    drvr_stats_.simulate_time += elapsedRunTime() - reduce_time;
+  }
+}
+
+// Report the phase run times of the driver pin with "set_debug stats 2".
+void
+PrimaDelayCalc::reportDrvrStats()
+{
+  if (drvr_stats_.call_count > 0)
+    report_->report("stats: prima {} nodes {} calls {} stamp {:.3f}ms "
+                    "reduce {:.3f}ms sim {:.3f}ms symbolic {} numeric {} "
+                    "basis reuse {}",
+                    network_->pathName(drvr_stats_.drvr_pin),
+                    drvr_stats_.node_count,
+                    drvr_stats_.call_count,
+                    drvr_stats_.stamp_time * 1e+3,
+                    drvr_stats_.reduce_time * 1e+3,
+                    drvr_stats_.simulate_time * 1e+3,
+                    drvr_stats_.symbolic_count,
+                    drvr_stats_.numeric_count,
+                    drvr_stats_.basis_reuse_count);
+  drvr_stats_.clear();
 }
 
 void
@@ -370,15 +493,14 @@ PrimaDelayCalc::simulate1(const MatrixSd &G,
   MatrixSd A(order, order);
   A = G + (2.0 / time_step_) * C;
   A.makeCompressed();
-  Eigen::SparseLU<MatrixSd> A_solver;
-  A_solver.compute(A);
+  A_lu_.factor(A);
 
   // Initial time depends on ceff which impact delay, so use a sim step
   // to find an initial ceff.
   setPortCurrents();
   Eigen::VectorXd rhs(order);
   rhs = B * u_ + (1.0 / time_step_) * C * (3.0 * x_prev - x_prev2);
-  x = A_solver.solve(rhs);
+  x = A_lu_.solve(rhs);
   v_ = x_to_v * x;
 
   updateCeffIdrvr();
@@ -400,7 +522,7 @@ PrimaDelayCalc::simulate1(const MatrixSd &G,
       break;
     setPortCurrents();
     rhs = B * u_ + (1.0 / time_step_) * C * (3.0 * x_prev - x_prev2);
-    x = A_solver.solve(rhs);
+    x = A_lu_.solve(rhs);
     v_ = x_to_v * x;
 
     const ArcDcalcArg &dcalc_arg = (*dcalc_args_)[0];
@@ -491,8 +613,7 @@ PrimaDelayCalc::findNodeCount()
   for (const ArcDcalcArg &dcalc_arg : *dcalc_args_) {
     const Parasitic *parasitic = dcalc_arg.parasitic();
     if (!visited_parasitics.contains(parasitic)) {
-      ParasiticNodeResistorMap resistor_map =
-        parasitics_->parasiticNodeResistorMap(parasitic);
+      ParasiticResistorAdjacency resistor_adjacency(parasitic, parasitics_);
       std::vector<ParasiticNode *> queue;
       for (size_t drvr_idx = 0; drvr_idx < drvr_count_; drvr_idx++) {
         const Pin *drvr_pin = (*dcalc_args_)[drvr_idx].drvrPin();
@@ -508,17 +629,14 @@ PrimaDelayCalc::findNodeCount()
         ParasiticNode *node = queue.back();
         queue.pop_back();
         size_t node_index = node_index_map_[node];
-        auto resistor_itr = resistor_map.find(node);
-        if (resistor_itr != resistor_map.end()) {
-          for (ParasiticResistor *resistor : resistor_itr->second) {
-            ParasiticNode *next_node = parasitics_->otherNode(resistor, node);
-            if (next_node
-                && !parasitics_->isExternal(next_node)
-                && !node_index_map_.contains(next_node)) {
-              bool shorted = parasitics_->value(resistor) == 0;
-              placeNode(next_node, shorted ? node_index : node_count_++);
-              queue.push_back(next_node);
-            }
+        for (ParasiticResistor *resistor : resistor_adjacency.devices(node)) {
+          ParasiticNode *next_node = parasitics_->otherNode(resistor, node);
+          if (next_node
+              && !parasitics_->isExternal(next_node)
+              && !node_index_map_.contains(next_node)) {
+            bool shorted = parasitics_->value(resistor) == 0;
+            placeNode(next_node, shorted ? node_index : node_count_++);
+            queue.push_back(next_node);
           }
         }
       }
@@ -956,6 +1074,7 @@ void
 PrimaDelayCalc::setPrimaReduceOrder(size_t order)
 {
   prima_order_ = order;
+  basis_valid_ = false;
 }
 
 // This version fills in one column of the orthonomal matrix
@@ -964,12 +1083,20 @@ void
 PrimaDelayCalc::primaReduce()
 {
   G_.makeCompressed();
-  // Step 3: solve G*R = B for R
-  Eigen::SparseLU<MatrixSd> G_solver(G_);
-  if (G_solver.info() != Eigen::Success)
+  C_.makeCompressed();
+  bool same_g = G_lu_.factor(G_);
+  if (G_lu_.info() != Eigen::Success)
     report_->error(1752, "G matrix is singular.");
+  if (reuseBasis(same_g)) {
+    // Only the initial voltages depend on the driver transition.
+    xq_init_ = Vq_qr_.solve(x_init_);
+    drvr_stats_.basis_reuse_count++;
+    return;
+  }
+
+  // Step 3: solve G*R = B for R
   Eigen::MatrixXd R(order_, port_count_);
-  R = G_solver.solve(B_);
+  R = G_lu_.solve(B_);
 
   // Step 4
   Eigen::HouseholderQR<Eigen::MatrixXd> R_solver(R);
@@ -983,7 +1110,7 @@ PrimaDelayCalc::primaReduce()
   // Step 6 - Arnolid iteration
   for (size_t k = 1; k < prima_order_; k++) {
     Eigen::VectorXd V = C_ * Vq_.col(k - 1);
-    Vq_.col(k) = G_solver.solve(V);
+    Vq_.col(k) = G_lu_.solve(V);
 
     // Modified Gram-Schmidt orthonormalization
     for (size_t j = 0; j < k; j++) {
@@ -1004,7 +1131,11 @@ PrimaDelayCalc::primaReduce()
 
   // x = Vq * x~
   // solve x_init = Vq * x~_init for x~_init
-  xq_init_ = Vq_.colPivHouseholderQr().solve(x_init_);
+  Vq_qr_.compute(Vq_);
+  xq_init_ = Vq_qr_.solve(x_init_);
+  basis_C_ = C_;
+  basis_B_ = B_;
+  basis_valid_ = true;
 
   if (debug_->check("prima", 3)) {
     reportMatrix("Vq", Vq_);
@@ -1014,6 +1145,19 @@ PrimaDelayCalc::primaReduce()
   }
 }
 
+// The Vq basis only depends on G, C and B, so arcs, rise/fall and
+// scenes that stamp the same matrices share it.
+bool
+PrimaDelayCalc::reuseBasis(bool same_g)
+{
+  return basis_valid_
+    && same_g
+    && static_cast<size_t>(Vq_.rows()) == order_
+    && static_cast<size_t>(Vq_.cols()) == prima_order_
+    && sameMatrix(C_, basis_C_)
+    && B_ == basis_B_;
+}
+
 // This version fills in port_count columns of the orthonomal matrix
 // at a time as shown in the prima algorithm figure 4.
 void
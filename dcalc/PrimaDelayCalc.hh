@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <Eigen/QR>
 #include <Eigen/SparseCore>
 #include <Eigen/SparseLU>
 #include <array>
@@ -52,6 +53,49 @@ using Waveform = Table;
 ArcDelayCalc *
 makePrimaDelayCalc(StaState *sta);
 
+// Sparse LU factorization that keeps the symbolic analysis (column
+// ordering and elimination tree) while the matrix sparsity pattern is
+// unchanged. Nets with the same RC topology only redo the numeric
+// factorization, and identical matrices are not refactored at all.
+class PrimaLuFactor
+{
+public:
+  // Matrix must be compressed.
+  // Return true if the matrix is the same as the previous factor call.
+  bool factor(const MatrixSd &matrix);
+  bool valid() const { return valid_; }
+  Eigen::ComputationInfo info() const { return solver_.info(); }
+  template <typename Rhs>
+  auto solve(const Eigen::MatrixBase<Rhs> &rhs) const { return solver_.solve(rhs); }
+  void clear();
+  size_t symbolicCount() const { return symbolic_count_; }
+  size_t numericCount() const { return numeric_count_; }
+
+protected:
+  Eigen::SparseLU<MatrixSd> solver_;
+  // Last factored matrix.
+  MatrixSd matrix_;
+  bool valid_{false};
+  size_t symbolic_count_{0};
+  size_t numeric_count_{0};
+};
+
+// Prima phase run times and reuse counts for one driver pin.
+struct PrimaDrvrStats
+{
+  void clear();
+
+  const Pin *drvr_pin{nullptr};
+  size_t node_count{0};
+  size_t call_count{0};
+  size_t basis_reuse_count{0};
+  size_t symbolic_count{0};
+  size_t numeric_count{0};
+  double stamp_time{0.0};
+  double reduce_time{0.0};
+  double simulate_time{0.0};
+};
+
 class PrimaDelayCalc : public DelayCalcBase,
                        public ArcDcalcWaveforms
 {
@@ -61,6 +105,8 @@ public:
   ~PrimaDelayCalc() override;
   ArcDelayCalc *copy() override;
   void copyState(const StaState *sta) override;
+  void addCounts(ArcDcalcCountsMap &counts) const override;
+  void clearCounts() override;
   std::string_view name() const override { return "prima"; }
   void setPrimaReduceOrder(size_t order);
   Parasitic *findParasitic(const Pin *drvr_pin,
@@ -176,6 +222,8 @@ protected:
                      const MinMax *min_max);
   void primaReduce();
   void primaReduce2();
+  bool reuseBasis(bool same_g);
+  void reportDrvrStats();
 
   void reportMatrix(std::string_view name,
                     MatrixSd &matrix);
@@ -226,6 +274,17 @@ protected:
   MatrixSd Cq_;
   Eigen::MatrixXd Bq_;
   Eigen::VectorXd xq_init_;
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> Vq_qr_;
+
+  // Factorizations reused across arcs, rise/fall and scenes of nets
+  // with the same RC network.
+  PrimaLuFactor G_lu_;
+  PrimaLuFactor A_lu_;
+  // C and B of the Vq basis.
+  MatrixSd basis_C_;
+  Eigen::MatrixXd basis_B_;
+  bool basis_valid_{false};
+  PrimaDrvrStats drvr_stats_;
 
   // Node voltages.
   Eigen::VectorXd v_;                  // voltage[node_idx]
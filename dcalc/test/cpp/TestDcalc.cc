@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <cmath>
 #include <functional>
+#include <sstream>
 
 #include "DelayCalc.hh"
 #include "ArcDelayCalc.hh"
@@ -407,7 +408,9 @@ TEST_F(DcalcRegistryTest, VariousInvalidNames) {
 #include "dcalc/DmpCeff.hh"
 #include "dcalc/CcsCeffDelayCalc.hh"
 #include "dcalc/PrimaDelayCalc.hh"
+#include "dcalc/HybridDelayCalc.hh"
 #include "dcalc/LumpedCapDelayCalc.hh"
+#include "dcalc/DcalcProfile.hh"
 #include "GraphDelayCalc.hh"
 #include "Units.hh"
 #include "MinMax.hh"
@@ -701,6 +704,14 @@ TEST_F(StaDcalcTest, ArnoldiCopy) {
   delete calc;
 }
 
+// Test arnoldi::reduceSupported
+TEST_F(StaDcalcTest, ArnoldiReduceSupported) {
+  ArcDelayCalc *calc = makeDelayCalc("arnoldi", sta_);
+  ASSERT_NE(calc, nullptr);
+  EXPECT_FALSE(calc->reduceSupported());
+  delete calc;
+}
+
 // Test ccs_ceff name
 TEST_F(StaDcalcTest, CcsCeffName) {
   ArcDelayCalc *calc = makeDelayCalc("ccs_ceff", sta_);
@@ -966,6 +977,43 @@ TEST_F(StaDcalcTest, CcsCeffWatchPins) {
   delete calc;
 }
 
+// PrimaLuFactor keeps the symbolic factorization for matrices with the
+// same sparsity pattern.
+TEST_F(StaDcalcTest, PrimaLuFactorReuse) {
+  auto makeMatrix = [](double g) {
+    MatrixSd matrix(3, 3);
+    matrix.coeffRef(0, 0) = 2.0 * g;
+    matrix.coeffRef(0, 1) = -g;
+    matrix.coeffRef(1, 0) = -g;
+    matrix.coeffRef(1, 1) = 2.0 * g;
+    matrix.coeffRef(1, 2) = -g;
+    matrix.coeffRef(2, 1) = -g;
+    matrix.coeffRef(2, 2) = g;
+    matrix.makeCompressed();
+    return matrix;
+  };
+  PrimaLuFactor lu;
+  EXPECT_FALSE(lu.factor(makeMatrix(1.0)));
+  EXPECT_TRUE(lu.factor(makeMatrix(1.0)));
+  EXPECT_EQ(lu.symbolicCount(), 1u);
+  EXPECT_EQ(lu.numericCount(), 1u);
+
+  MatrixSd matrix = makeMatrix(2.0);
+  EXPECT_FALSE(lu.factor(matrix));
+  EXPECT_EQ(lu.symbolicCount(), 1u);
+  EXPECT_EQ(lu.numericCount(), 2u);
+  Eigen::VectorXd b = Eigen::VectorXd::Ones(3);
+  Eigen::VectorXd x = lu.solve(b);
+  EXPECT_NEAR((matrix * x - b).norm(), 0.0, 1e-12);
+
+  // Different pattern redoes the symbolic analysis.
+  MatrixSd diag(3, 3);
+  diag.setIdentity();
+  diag.makeCompressed();
+  EXPECT_FALSE(lu.factor(diag));
+  EXPECT_EQ(lu.symbolicCount(), 2u);
+}
+
 // Test PrimaDelayCalc watchPin/clearWatchPins/watchPins
 TEST_F(StaDcalcTest, PrimaWatchPins) {
   ArcDelayCalc *calc = makeDelayCalc("prima", sta_);
@@ -1624,6 +1672,7 @@ TEST_F(StaDcalcTest, UnitDelayCalcReduceParasiticNetOverload) {
 // that require a fully loaded design with parasitics
 
 #include "Network.hh"
+#include "Liberty.hh"
 #include "Graph.hh"
 #include "Sdc.hh"
 #include "Search.hh"
@@ -1859,6 +1908,505 @@ TEST_F(DesignDcalcTest, ArnoldiReduceParasiticWithDesign) {
   delete calc;
 }
 
+// Arcs of a driver share the reduction of its parasitic network.
+TEST_F(DesignDcalcTest, ArnoldiReductionShared) {
+  ASSERT_TRUE(design_loaded_);
+  Scene *corner = sta_->cmdScene();
+  corner->setParasitics(sta_->findParasitics("spef"), MinMaxAll::minMax());
+  Network *network = sta_->network();
+  Instance *u1 = network->findChild(network->topInstance(), "u1");
+  ASSERT_NE(u1, nullptr);
+  Pin *y_pin = network->findPin(u1, "Y");
+  ASSERT_NE(y_pin, nullptr);
+  Instance *u2 = network->findChild(network->topInstance(), "u2");
+  ASSERT_NE(u2, nullptr);
+  Pin *y_pin2 = network->findPin(u2, "Y");
+  ASSERT_NE(y_pin2, nullptr);
+  ArcDelayCalc *calc = makeDelayCalc("arnoldi", sta_);
+  ASSERT_NE(calc, nullptr);
+  const MinMax *mm = MinMax::max();
+  Parasitic *parasitic1 = calc->findParasitic(y_pin, RiseFall::rise(), corner, mm);
+  ASSERT_NE(parasitic1, nullptr);
+  // Reductions of other drivers (parallel gates) are kept with the
+  // first driver's until finishDrvrPin.
+  Parasitic *parasitic_u2 = calc->findParasitic(y_pin2, RiseFall::rise(),
+                                                corner, mm);
+  ASSERT_NE(parasitic_u2, nullptr);
+  Parasitic *parasitic2 = calc->findParasitic(y_pin, RiseFall::rise(), corner, mm);
+  EXPECT_EQ(parasitic1, parasitic2);
+  EXPECT_EQ(calc->findParasitic(y_pin2, RiseFall::rise(), corner, mm),
+            parasitic_u2);
+  Parasitics *parasitics = corner->parasitics(mm);
+  ASSERT_NE(parasitics, nullptr);
+  float cap = parasitics->capacitance(parasitic1);
+  calc->finishDrvrPin();
+
+  // Reductions are made again after the parasitics change.
+  calc->parasiticsInvalid(y_pin);
+  Parasitic *parasitic3 = calc->findParasitic(y_pin, RiseFall::rise(), corner, mm);
+  ASSERT_NE(parasitic3, nullptr);
+  EXPECT_FLOAT_EQ(parasitics->capacitance(parasitic3), cap);
+  calc->finishDrvrPin();
+  calc->parasiticsInvalid(nullptr);
+  delete calc;
+
+  sta_->setArcDelayCalc("arnoldi");
+  sta_->updateTiming(true);
+  EXPECT_GT(sta_->graph()->vertexCount(), 0);
+}
+
+// Each driver of a multi-driver net has its own reduction rooted at
+// the driver.
+TEST_F(DesignDcalcTest, ArnoldiReductionMultiDrvr) {
+  ASSERT_TRUE(design_loaded_);
+  Scene *corner = sta_->cmdScene();
+  Parasitics *parasitics = sta_->findParasitics("spef");
+  ASSERT_NE(parasitics, nullptr);
+  corner->setParasitics(parasitics, MinMaxAll::minMax());
+  Network *network = sta_->network();
+  Instance *top = network->topInstance();
+  LibertyCell *buf = network->findLibertyCell("BUFx2_ASAP7_75t_R");
+  ASSERT_NE(buf, nullptr);
+  Instance *u1 = network->findChild(top, "u1");
+  ASSERT_NE(u1, nullptr);
+  Pin *y_pin1 = network->findPin(u1, "Y");
+  ASSERT_NE(y_pin1, nullptr);
+  Net *net = network->net(y_pin1);
+  ASSERT_NE(net, nullptr);
+  // Parallel driver of u1z.
+  Instance *u3 = sta_->makeInstance("u3", buf, top);
+  sta_->connectPin(u3, buf->findLibertyPort("A"), network->findNet(top, "r2q"));
+  sta_->connectPin(u3, buf->findLibertyPort("Y"), net);
+  Pin *y_pin3 = network->findPin(u3, "Y");
+  ASSERT_NE(y_pin3, nullptr);
+  Instance *u2 = network->findChild(top, "u2");
+  ASSERT_NE(u2, nullptr);
+  Pin *b_pin = network->findPin(u2, "B");
+  ASSERT_NE(b_pin, nullptr);
+
+  Parasitic *parasitic = sta_->beginParasiticEco(net, parasitics, false, true);
+  ASSERT_NE(parasitic, nullptr);
+  ParasiticNode *node1 = parasitics->ensureParasiticNode(parasitic, y_pin1,
+                                                         network);
+  ParasiticNode *node3 = parasitics->ensureParasiticNode(parasitic, y_pin3,
+                                                         network);
+  ParasiticNode *subnode = parasitics->ensureParasiticNode(parasitic, net, 1,
+                                                           network);
+  ParasiticNode *load_node = parasitics->ensureParasiticNode(parasitic, b_pin,
+                                                             network);
+  parasitics->makeResistor(parasitic, 1, 100.0, node1, subnode);
+  parasitics->makeResistor(parasitic, 2, 1000.0, node3, subnode);
+  parasitics->makeResistor(parasitic, 3, 100.0, subnode, load_node);
+  parasitics->incrCap(subnode, 20e-15);
+  sta_->finishParasiticEco(net, parasitics, false);
+  ASSERT_EQ(parasitics->findParasiticNetwork(y_pin1),
+            parasitics->findParasiticNetwork(y_pin3));
+
+  ArcDelayCalc *calc = makeDelayCalc("arnoldi", sta_);
+  ASSERT_NE(calc, nullptr);
+  const MinMax *mm = MinMax::max();
+  Parasitic *parasitic1 = calc->findParasitic(y_pin1, RiseFall::rise(), corner, mm);
+  ASSERT_NE(parasitic1, nullptr);
+  Parasitic *parasitic3 = calc->findParasitic(y_pin3, RiseFall::rise(), corner, mm);
+  ASSERT_NE(parasitic3, nullptr);
+  EXPECT_NE(parasitic1, parasitic3);
+  // Each driver reuses its own reduction.
+  EXPECT_EQ(calc->findParasitic(y_pin1, RiseFall::rise(), corner, mm),
+            parasitic1);
+  EXPECT_EQ(calc->findParasitic(y_pin3, RiseFall::rise(), corner, mm),
+            parasitic3);
+  calc->finishDrvrPin();
+  calc->parasiticsInvalid(nullptr);
+  delete calc;
+}
+
+// Parasitic ECO replaces one net's network and re-reduces its driver.
+TEST_F(DesignDcalcTest, ParasiticEco) {
+  ASSERT_TRUE(design_loaded_);
+  Scene *corner = sta_->cmdScene();
+  Parasitics *parasitics = sta_->findParasitics("spef");
+  ASSERT_NE(parasitics, nullptr);
+  corner->setParasitics(parasitics, MinMaxAll::minMax());
+  sta_->setArcDelayCalc("dmp_ceff_elmore");
+  sta_->updateTiming(true);
+
+  Network *network = sta_->network();
+  Graph *graph = sta_->graph();
+  Instance *u1 = network->findChild(network->topInstance(), "u1");
+  ASSERT_NE(u1, nullptr);
+  Pin *y_pin = network->findPin(u1, "Y");
+  ASSERT_NE(y_pin, nullptr);
+  Net *net = network->net(y_pin);
+  ASSERT_NE(net, nullptr);
+  Vertex *drvr_vertex = graph->pinDrvrVertex(y_pin);
+  VertexInEdgeIterator edge_iter(drvr_vertex, graph);
+  ASSERT_TRUE(edge_iter.hasNext());
+  Edge *edge = edge_iter.next();
+  TimingArc *arc = edge->timingArcSet()->arcs()[0];
+  const MinMax *mm = MinMax::max();
+  DcalcAPIndex ap_index = corner->dcalcAnalysisPtIndex(mm);
+  float delay1 = delayAsFloat(graph->arcDelay(edge, arc, ap_index));
+
+  // Replace the network with a resistive one.
+  Parasitic *parasitic = sta_->beginParasiticEco(net, parasitics, false, true);
+  ASSERT_NE(parasitic, nullptr);
+  ParasiticNode *drvr_node = parasitics->ensureParasiticNode(parasitic, y_pin,
+                                                             network);
+  ParasiticNode *subnode = parasitics->ensureParasiticNode(parasitic, net, 1,
+                                                           network);
+  parasitics->makeResistor(parasitic, 1, 1000.0, drvr_node, subnode);
+  parasitics->incrCap(subnode, 20e-15);
+  uint32_t res_id = 2;
+  NetConnectedPinIterator *pin_iter = network->connectedPinIterator(net);
+  while (pin_iter->hasNext()) {
+    const Pin *pin = pin_iter->next();
+    if (network->isLoad(pin)) {
+      ParasiticNode *load_node = parasitics->ensureParasiticNode(parasitic, pin,
+                                                                 network);
+      parasitics->makeResistor(parasitic, res_id++, 100.0, subnode, load_node);
+    }
+  }
+  delete pin_iter;
+  sta_->finishParasiticEco(net, parasitics, true);
+
+  // The network is reduced for the driver and deleted.
+  EXPECT_EQ(parasitics->findParasiticNetwork(net), nullptr);
+  EXPECT_NE(parasitics->findPiElmore(y_pin, RiseFall::rise(), mm), nullptr);
+  sta_->updateTiming(false);
+  float delay2 = delayAsFloat(graph->arcDelay(edge, arc, ap_index));
+  EXPECT_GT(delay2, delay1);
+
+  // Incremental update matches a full update.
+  sta_->delaysInvalid();
+  sta_->updateTiming(true);
+  EXPECT_FLOAT_EQ(delayAsFloat(graph->arcDelay(edge, arc, ap_index)), delay2);
+}
+
+TEST_F(DesignDcalcTest, DelayCalcProfile) {
+  ASSERT_TRUE(design_loaded_);
+  Scene *corner = sta_->cmdScene();
+  Parasitics *parasitics = sta_->findParasitics("spef");
+  ASSERT_NE(parasitics, nullptr);
+  corner->setParasitics(parasitics, MinMaxAll::minMax());
+  sta_->setArcDelayCalc("dmp_ceff_elmore");
+  GraphDelayCalc *graph_dcalc = sta_->graphDelayCalc();
+  auto profile_call_count = [=] () {
+    size_t call_count = 0;
+    for (const auto &[name, dcalc_counts] : graph_dcalc->profileCounts())
+      call_count += dcalc_counts.call_count;
+    return call_count;
+  };
+  sta_->clearDelayCalcProfile();
+  EXPECT_EQ(profile_call_count(), 0u);
+  sta_->updateTiming(true);
+  size_t full_call_count = profile_call_count();
+  EXPECT_GT(full_call_count, 0u);
+  sta_->reportDelayCalcProfile(5);
+
+  // Copies start with zero counts.
+  ArcDelayCalc *dcalc = sta_->arcDelayCalc()->copy();
+  dcalc->incrCallCount(3);
+  dcalc->incrTime(0.5);
+  ArcDcalcCountsMap counts;
+  dcalc->addCounts(counts);
+  ArcDelayCalc *dcalc_copy = dcalc->copy();
+  dcalc_copy->addCounts(counts);
+  delete dcalc_copy;
+  delete dcalc;
+  const ArcDcalcCounts &dmp_counts = counts["dmp_ceff_elmore"];
+  EXPECT_EQ(dmp_counts.call_count, 3u);
+  EXPECT_DOUBLE_EQ(dmp_counts.time, 0.5);
+
+  // Incremental updates add to the profile.
+  Network *network = sta_->network();
+  Pin *y_pin = network->findPin(network->findChild(network->topInstance(), "u1"),
+                                "Y");
+  ASSERT_NE(y_pin, nullptr);
+  sta_->delaysInvalidFrom(y_pin);
+  sta_->updateTiming(false);
+  size_t incr_call_count = profile_call_count();
+  EXPECT_GT(incr_call_count, full_call_count);
+
+  // So do delays found with the graph delay calculator's own calculator.
+  graph_dcalc->findDelays(sta_->graph()->pinDrvrVertex(y_pin));
+  EXPECT_GT(profile_call_count(), incr_call_count);
+
+  // Deleting a driver vertex keeps the other drivers.
+  Vertex *u1_vertex = sta_->graph()->pinDrvrVertex(y_pin);
+  Pin *q_pin = network->findPin(network->findChild(network->topInstance(), "r1"),
+                                "Q");
+  ASSERT_NE(q_pin, nullptr);
+  Vertex *r1_vertex = sta_->graph()->pinDrvrVertex(q_pin);
+  DcalcProfile drvr_profile;
+  drvr_profile.addDrvr(u1_vertex, 1.0);
+  drvr_profile.addDrvr(r1_vertex, 2.0);
+  drvr_profile.addDrvr(u1_vertex, 3.0);
+  drvr_profile.deleteDrvr(u1_vertex);
+  ASSERT_EQ(drvr_profile.drvrs().size(), 1u);
+  EXPECT_EQ(drvr_profile.drvrs()[0].vertex, r1_vertex);
+
+  sta_->reportDelayCalcProfile(5);
+  sta_->clearDelayCalcProfile();
+  EXPECT_EQ(profile_call_count(), 0u);
+  for (const auto &[name, dcalc_counts] : graph_dcalc->profileCounts()) {
+    EXPECT_DOUBLE_EQ(dcalc_counts.time, 0.0);
+    EXPECT_EQ(dcalc_counts.newton_iteration_count, 0u);
+  }
+  sta_->report()->redirectStringBegin();
+  sta_->reportDelayCalcProfile(5);
+  std::string profile = sta_->report()->redirectStringEnd();
+  EXPECT_EQ(profile.find("Driver "), std::string::npos);
+}
+
+// Batched scene gate delays match gateDelay for each analysis point,
+// with and without parasitics.
+TEST_F(DesignDcalcTest, SceneGateDelaysMatchGateDelay) {
+  ASSERT_TRUE(design_loaded_);
+  sta_->updateTiming(true);
+  Scene *corner = sta_->cmdScene();
+  Network *network = sta_->network();
+  Graph *graph = sta_->graph();
+  Instance *top = network->topInstance();
+  Instance *u1 = network->findChild(top, "u1");
+  ASSERT_NE(u1, nullptr);
+  Pin *y_pin = network->findPin(u1, "Y");
+  ASSERT_NE(y_pin, nullptr);
+  Vertex *drvr_vertex = graph->pinDrvrVertex(y_pin);
+  ASSERT_NE(drvr_vertex, nullptr);
+  VertexInEdgeIterator edge_iter(drvr_vertex, graph);
+  ASSERT_TRUE(edge_iter.hasNext());
+  Edge *edge = edge_iter.next();
+  const Pin *from_pin = edge->from(graph)->pin();
+  LoadPinIndexMap load_pin_index_map =
+    sta_->graphDelayCalc()->makeLoadPinIndexMap(drvr_vertex);
+
+  for (const char *calc_name : {"lumped_cap", "dmp_ceff_elmore"}) {
+    ArcDelayCalc *calc = makeDelayCalc(calc_name, sta_);
+    ASSERT_NE(calc, nullptr);
+    for (const TimingArc *arc : edge->timingArcSet()->arcs()) {
+      const RiseFall *drvr_rf = arc->toEdge()->asRiseFall();
+      ArcDcalcArgSeq args;
+      for (const MinMax *min_max : MinMax::range()) {
+        const Parasitic *parasitic = calc->findParasitic(y_pin, drvr_rf,
+                                                         corner, min_max);
+        for (float in_slew : {5e-12f, 20e-12f}) {
+          for (const Parasitic *parasitic1 : {parasitic, (const Parasitic*)nullptr}) {
+            ArcDcalcArg &arg = args.emplace_back(from_pin, y_pin, edge, arc,
+                                                 Slew(in_slew), 2e-15f, parasitic1);
+            arg.setAnalysisPt(corner, min_max);
+          }
+        }
+      }
+      ArcDcalcResultSeq results = calc->sceneGateDelays(args, load_pin_index_map);
+      ASSERT_EQ(results.size(), args.size());
+      for (size_t i = 0; i < args.size(); i++) {
+        const ArcDcalcArg &arg = args[i];
+        ArcDcalcResult result = calc->gateDelay(y_pin, arc, arg.inSlew(),
+                                                arg.loadCap(), arg.parasitic(),
+                                                load_pin_index_map,
+                                                arg.scene(), arg.minMax());
+        EXPECT_FLOAT_EQ(delayAsFloat(results[i].gateDelay()),
+                        delayAsFloat(result.gateDelay()));
+        EXPECT_FLOAT_EQ(delayAsFloat(results[i].drvrSlew()),
+                        delayAsFloat(result.drvrSlew()));
+      }
+    }
+    calc->finishDrvrPin();
+    delete calc;
+  }
+}
+
+// Cached delays are within the slew quantization error of the uncached delays.
+TEST_F(DesignDcalcTest, DelayCalcCacheMatchesUncached) {
+  ASSERT_TRUE(design_loaded_);
+  sta_->setArcDelayCalc("dmp_ceff_elmore");
+  sta_->updateTiming(true);
+  Graph *graph = sta_->graph();
+  DcalcAPIndex ap_index = sta_->cmdScene()->dcalcAnalysisPtIndex(MinMax::max());
+  std::vector<float> delays;
+  VertexIterator viter(graph);
+  while (viter.hasNext()) {
+    Vertex *vertex = viter.next();
+    VertexInEdgeIterator eiter(vertex, graph);
+    while (eiter.hasNext()) {
+      Edge *edge = eiter.next();
+      for (const TimingArc *arc : edge->timingArcSet()->arcs())
+        delays.push_back(delayAsFloat(graph->arcDelay(edge, arc, ap_index)));
+    }
+  }
+
+  sta_->setDelayCalcCacheTolerance(0.01);
+  sta_->updateTiming(true);
+  size_t i = 0;
+  VertexIterator viter2(graph);
+  while (viter2.hasNext()) {
+    Vertex *vertex = viter2.next();
+    VertexInEdgeIterator eiter(vertex, graph);
+    while (eiter.hasNext()) {
+      Edge *edge = eiter.next();
+      for (const TimingArc *arc : edge->timingArcSet()->arcs()) {
+        ASSERT_LT(i, delays.size());
+        float delay = delayAsFloat(graph->arcDelay(edge, arc, ap_index));
+        EXPECT_NEAR(delay, delays[i], std::abs(delays[i]) * 0.01 + 1e-13);
+        i++;
+      }
+    }
+  }
+  EXPECT_EQ(i, delays.size());
+  sta_->setDelayCalcCacheTolerance(0.0);
+}
+
+// The hybrid calculator reports its choice for each driver and uses
+// prima for critical drivers.
+TEST_F(DesignDcalcTest, HybridDelayCalcSelect) {
+  ASSERT_TRUE(design_loaded_);
+  sta_->cmdScene()->setParasitics(sta_->findParasitics("spef"),
+                                  MinMaxAll::minMax());
+  sta_->setArcDelayCalc("hybrid");
+  sta_->updateTiming(true);
+  HybridDelayCalc *hybrid = dynamic_cast<HybridDelayCalc*>(sta_->arcDelayCalc());
+  ASSERT_NE(hybrid, nullptr);
+  Scene *corner = sta_->cmdScene();
+  Network *network = sta_->network();
+  Graph *graph = sta_->graph();
+  Instance *u1 = network->findChild(network->topInstance(), "u1");
+  ASSERT_NE(u1, nullptr);
+  Pin *y_pin = network->findPin(u1, "Y");
+  ASSERT_NE(y_pin, nullptr);
+  ArcDelayCalc *dcalc = hybrid->selectDelayCalc(y_pin, corner, MinMax::max());
+  ASSERT_NE(dcalc, nullptr);
+  EXPECT_NE(dcalc->name(), "prima");
+
+  Vertex *drvr_vertex = graph->pinDrvrVertex(y_pin);
+  VertexInEdgeIterator edge_iter(drvr_vertex, graph);
+  ASSERT_TRUE(edge_iter.hasNext());
+  Edge *edge = edge_iter.next();
+  const TimingArc *arc = edge->timingArcSet()->arcs()[0];
+  std::string report = sta_->reportDelayCalc(edge, const_cast<TimingArc*>(arc),
+                                             corner, MinMax::max(), 4);
+  EXPECT_NE(report.find("Delay calculator: "), std::string::npos);
+
+  PinSet critical_drvrs(network);
+  critical_drvrs.insert(y_pin);
+  hybrid->setCriticalDrvrs(critical_drvrs);
+  hybrid->finishDrvrPin();
+  EXPECT_EQ(hybrid->selectDelayCalc(y_pin, corner, MinMax::max())->name(), "prima");
+  hybrid->finishDrvrPin();
+  sta_->clearDelayCalcProfile();
+  sta_->delaysInvalid();
+  sta_->updateTiming(true);
+
+  // The critical driver is the only one delegated to prima.
+  sta_->report()->redirectStringBegin();
+  sta_->reportDelayCalcProfile(0);
+  std::string profile = sta_->report()->redirectStringEnd();
+  size_t prima_pos = profile.find("\nprima ");
+  ASSERT_NE(prima_pos, std::string::npos);
+  std::istringstream prima_row(profile.substr(prima_pos + 1));
+  std::string prima_name;
+  size_t prima_calls = 0;
+  prima_row >> prima_name >> prima_calls;
+  EXPECT_GT(prima_calls, 0u);
+  // Calls are only counted by the delegated delay calculators.
+  ArcDcalcCountsMap counts = sta_->graphDelayCalc()->profileCounts();
+  EXPECT_EQ(counts["hybrid"].call_count, 0u);
+}
+
+TEST_F(DesignDcalcTest, DmpSolverWarmStart) {
+  ASSERT_TRUE(design_loaded_);
+  sta_->cmdScene()->setParasitics(sta_->findParasitics("spef"),
+                                  MinMaxAll::minMax());
+  sta_->setArcDelayCalc("dmp_ceff_elmore");
+  sta_->updateTiming(true);
+  DmpCeffDelayCalc *dmp = dynamic_cast<DmpCeffDelayCalc*>(sta_->arcDelayCalc());
+  ASSERT_NE(dmp, nullptr);
+  Scene *corner = sta_->cmdScene();
+  Network *network = sta_->network();
+  Graph *graph = sta_->graph();
+  Instance *u1 = network->findChild(network->topInstance(), "u1");
+  ASSERT_NE(u1, nullptr);
+  Pin *y_pin = network->findPin(u1, "Y");
+  ASSERT_NE(y_pin, nullptr);
+  Vertex *drvr_vertex = graph->pinDrvrVertex(y_pin);
+  VertexInEdgeIterator edge_iter(drvr_vertex, graph);
+  ASSERT_TRUE(edge_iter.hasNext());
+  Edge *edge = edge_iter.next();
+
+  // Reports finish the driver after each arc so they never warm start
+  // and repeated reports are identical.
+  std::string report1;
+  std::string report2;
+  for (int i = 0; i < 2; i++) {
+    for (TimingArc *arc : edge->timingArcSet()->arcs()) {
+      std::string report = sta_->reportDelayCalc(edge, arc, corner,
+                                                 MinMax::max(), 4);
+      if (i == 0)
+        report1 += report;
+      else
+        report2 += report;
+    }
+  }
+  EXPECT_FALSE(report1.empty());
+  EXPECT_EQ(report1, report2);
+
+  // The arcs of one driver warm start from the previous arc until the
+  // driver is finished.
+  GraphDelayCalc *graph_dcalc = sta_->graphDelayCalc();
+  LoadPinIndexMap load_pin_index_map =
+    graph_dcalc->makeLoadPinIndexMap(drvr_vertex);
+  float load_cap = graph_dcalc->loadCap(y_pin, corner, MinMax::max());
+  Vertex *in_vertex = edge->from(graph);
+  DcalcAPIndex ap_index = corner->dcalcAnalysisPtIndex(MinMax::max());
+  auto arcDelays = [&] () {
+    std::vector<float> delays;
+    for (TimingArc *arc : edge->timingArcSet()->arcs()) {
+      const RiseFall *rf = arc->toEdge()->asRiseFall();
+      const Parasitic *parasitic = dmp->findParasitic(y_pin, rf, corner,
+                                                      MinMax::max());
+      Slew in_slew = graph->slew(in_vertex, arc->fromEdge()->asRiseFall(),
+                                 ap_index);
+      ArcDcalcResult result = dmp->gateDelay(y_pin, arc, in_slew, load_cap,
+                                             parasitic, load_pin_index_map,
+                                             corner, MinMax::max());
+      delays.push_back(delayAsFloat(result.gateDelay()));
+    }
+    return delays;
+  };
+  DmpSolverStats stats0 = dmp->solverStats();
+  arcDelays();
+  // Every arc of the second pass is warm started.
+  std::vector<float> warm_delays = arcDelays();
+  dmp->finishDrvrPin();
+  DmpSolverStats stats1 = dmp->solverStats();
+  EXPECT_GT(stats1.solve_count, stats0.solve_count);
+  EXPECT_GT(stats1.warm_start_count, stats0.warm_start_count);
+  EXPECT_GE(stats1.iteration_count, stats1.solve_count);
+  EXPECT_LE(stats1.warm_start_retry_count, stats1.warm_start_count);
+
+  // The first arc after finishDrvrPin is a cold start.
+  TimingArc *arc0 = edge->timingArcSet()->arcs()[0];
+  const RiseFall *rf0 = arc0->toEdge()->asRiseFall();
+  Slew in_slew0 = graph->slew(in_vertex, arc0->fromEdge()->asRiseFall(),
+                              ap_index);
+  ArcDcalcResult cold = dmp->gateDelay(y_pin, arc0, in_slew0, load_cap,
+                                       dmp->findParasitic(y_pin, rf0, corner,
+                                                          MinMax::max()),
+                                       load_pin_index_map, corner,
+                                       MinMax::max());
+  dmp->finishDrvrPin();
+  EXPECT_EQ(dmp->solverStats().warm_start_count, stats1.warm_start_count);
+  // Warm starts converge to the cold start delays.
+  EXPECT_NEAR(delayAsFloat(cold.gateDelay()), warm_delays[0],
+              std::abs(warm_delays[0]) * 1e-3f);
+
+  // Thread copies start with empty solver stats.
+  ArcDelayCalc *copy = dmp->copy();
+  DmpCeffDelayCalc *dmp_copy = dynamic_cast<DmpCeffDelayCalc*>(copy);
+  ASSERT_NE(dmp_copy, nullptr);
+  EXPECT_EQ(dmp_copy->solverStats().solve_count, 0u);
+  delete copy;
+}
+
 // Test switching delay calculator mid-flow
 TEST_F(DesignDcalcTest, SwitchDelayCalcMidFlow) {
   ASSERT_TRUE(design_loaded_);
@@ -4683,6 +5231,105 @@ TEST_F(MultiDriverDcalcTest, FindDelaysExplicit) {
   EXPECT_GT(sta_->graph()->vertexCount(), 0);
 }
 
+// Tristate and parallel gate multi-driver nets found by separate
+// tasks match the single thread delays.
+TEST_F(MultiDriverDcalcTest, MultiDrvrNetThreads) {
+  EXPECT_TRUE(design_loaded_);
+  Network *network = sta_->network();
+  Instance *top = network->topInstance();
+  LibertyCell *tbuf = network->findLibertyCell("TBUF_X1");
+  ASSERT_NE(tbuf, nullptr);
+  LibertyCell *buf = network->findLibertyCell("BUF_X1");
+  ASSERT_NE(buf, nullptr);
+  Net *n1 = network->findNet(top, "n1");
+  Net *n4 = network->findNet(top, "n4");
+  Net *n6 = network->findNet(top, "n6");
+  ASSERT_NE(n1, nullptr);
+  ASSERT_NE(n4, nullptr);
+  ASSERT_NE(n6, nullptr);
+
+  // Tristate bus driven by 4 tbufs.
+  Net *bus = sta_->makeNet("bus", top);
+  std::vector<Instance*> drvrs;
+  for (int i = 0; i < 4; i++) {
+    std::string name = "tbuf" + std::to_string(i);
+    Instance *inst = sta_->makeInstance(name.c_str(), tbuf, top);
+    sta_->connectPin(inst, tbuf->findLibertyPort("A"), (i % 2) ? n1 : n4);
+    sta_->connectPin(inst, tbuf->findLibertyPort("EN"), n6);
+    sta_->connectPin(inst, tbuf->findLibertyPort("Z"), bus);
+    drvrs.push_back(inst);
+  }
+  // Parallel buffers.
+  Net *par = sta_->makeNet("par", top);
+  for (int i = 0; i < 2; i++) {
+    std::string name = "pbuf" + std::to_string(i);
+    Instance *inst = sta_->makeInstance(name.c_str(), buf, top);
+    sta_->connectPin(inst, buf->findLibertyPort("A"), n1);
+    sta_->connectPin(inst, buf->findLibertyPort("Z"), par);
+    drvrs.push_back(inst);
+  }
+  Net *bus_z = sta_->makeNet("bus_z", top);
+  Net *par_z = sta_->makeNet("par_z", top);
+  Instance *bus_load = sta_->makeInstance("bus_load", buf, top);
+  sta_->connectPin(bus_load, buf->findLibertyPort("A"), bus);
+  sta_->connectPin(bus_load, buf->findLibertyPort("Z"), bus_z);
+  Instance *par_load = sta_->makeInstance("par_load", buf, top);
+  sta_->connectPin(par_load, buf->findLibertyPort("A"), par);
+  sta_->connectPin(par_load, buf->findLibertyPort("Z"), par_z);
+  drvrs.push_back(bus_load);
+  drvrs.push_back(par_load);
+
+  sta_->setArcDelayCalc("dmp_ceff_elmore");
+  DcalcAPIndex ap_index = sta_->cmdScene()->dcalcAnalysisPtIndex(MinMax::max());
+  auto instDelays = [&]() {
+    Graph *graph = sta_->graph();
+    std::vector<float> delays;
+    for (Instance *inst : drvrs) {
+      InstancePinIterator *pin_iter = network->pinIterator(inst);
+      while (pin_iter->hasNext()) {
+        const Pin *pin = pin_iter->next();
+        Vertex *vertex = graph->pinDrvrVertex(pin);
+        if (vertex && network->isDriver(pin)) {
+          for (const RiseFall *rf : RiseFall::range())
+            delays.push_back(delayAsFloat(graph->slew(vertex, rf, ap_index)));
+          VertexInEdgeIterator edge_iter(vertex, graph);
+          while (edge_iter.hasNext()) {
+            Edge *edge = edge_iter.next();
+            for (TimingArc *arc : edge->timingArcSet()->arcs())
+              delays.push_back(delayAsFloat(graph->arcDelay(edge, arc, ap_index)));
+          }
+        }
+      }
+      delete pin_iter;
+    }
+    return delays;
+  };
+
+  sta_->setThreadCount(1);
+  sta_->updateTiming(true);
+  std::vector<float> delays1 = instDelays();
+  ASSERT_FALSE(delays1.empty());
+
+  sta_->setThreadCount(4);
+  sta_->updateTiming(true);
+  std::vector<float> delays4 = instDelays();
+  ASSERT_EQ(delays4.size(), delays1.size());
+  for (size_t i = 0; i < delays1.size(); i++)
+    EXPECT_FLOAT_EQ(delays4[i], delays1[i]);
+
+  // Incremental update matches a full update.
+  sta_->setInputSlew(network->findPort(network->cell(top), "in2"),
+                     RiseFallBoth::riseFall(), MinMaxAll::all(), 0.1f,
+                     sta_->cmdSdc());
+  sta_->updateTiming(false);
+  std::vector<float> delays_incr = instDelays();
+  sta_->updateTiming(true);
+  std::vector<float> delays_full = instDelays();
+  ASSERT_EQ(delays_incr.size(), delays_full.size());
+  for (size_t i = 0; i < delays_full.size(); i++)
+    EXPECT_FLOAT_EQ(delays_incr[i], delays_full[i]);
+}
+
 ////////////////////////////////////////////////////////////////
 // MultiCornerDcalcTest - Loads Nangate45 fast/slow + dcalc_test1.v
 
@@ -52,8 +52,29 @@ using ArcDcalcArgSeq = std::vector<ArcDcalcArg>;
 // Driver load pin -> index in driver loads.
 using LoadPinIndexMap = std::map<const Pin *, size_t, PinIdLess>;
 
+// Delay calculator profile counts.
+struct ArcDcalcCounts
+{
+  void add(const ArcDcalcCounts &counts);
+
+  // Gate delays found by the delay calculator for GraphDelayCalc.
+  size_t call_count{0};
+  // Seconds to find driver delays, including parasitic reduction.
+  double time{0.0};
+  size_t newton_iteration_count{0};
+  // Gate delays that fall back to a lumped capacitance or table model
+  // because the delay calculator failed or does not support the model.
+  size_t fallback_count{0};
+  size_t reduction_count{0};
+  double reduction_time{0.0};
+};
+
+// Delay calculator name -> counts.
+using ArcDcalcCountsMap = std::map<std::string, ArcDcalcCounts, std::less<>>;
+
 // Arguments for gate delay calculation delay/slew at one driver pin
 // through one timing arc at one delay calc analysis point.
+// The scene/min_max analysis point is only used by sceneGateDelays.
 class ArcDcalcArg
 {
 public:
@@ -92,6 +113,10 @@ public:
   void setLoadCap(float load_cap);
   float inputDelay() const { return input_delay_; }
   void setInputDelay(float input_delay);
+  const Scene *scene() const { return scene_; }
+  const MinMax *minMax() const { return min_max_; }
+  void setAnalysisPt(const Scene *scene,
+                     const MinMax *min_max);
 
 protected:
   const Pin *in_pin_;
@@ -102,6 +127,8 @@ protected:
   float load_cap_;
   const Parasitic *parasitic_;
   float input_delay_;
+  const Scene *scene_;
+  const MinMax *min_max_;
 };
 
 
@@ -155,6 +182,7 @@ using ArcDcalcResultSeq = std::vector<ArcDcalcResult>;
 //    CcsCeffDelayCalc
 //    CcsSimfDelayCalc
 //    PrimafDelayCalc
+//    HybridDelayCalc
 
 // Abstract class for the graph delay calculator traversal to interface
 // to a delay calculator primitive.
@@ -162,6 +190,8 @@ class ArcDelayCalc : public StaState
 {
 public:
   ArcDelayCalc(StaState *sta);
+  // Copies start with zero profile counts.
+  ArcDelayCalc(const ArcDelayCalc &dcalc);
   virtual ArcDelayCalc *copy() = 0;
   virtual std::string_view name() const = 0;
 
@@ -230,6 +260,11 @@ public:
                                        const LoadPinIndexMap &load_pin_index_map,
                                        const Scene *scene,
                                        const MinMax *min_max) = 0;
+  // Find the delay and slew for one driver pin arc at the scene/min_max
+  // analysis point of each arg. Results are in args order.
+  // The default calls gateDelay for each arg.
+  virtual ArcDcalcResultSeq sceneGateDelays(ArcDcalcArgSeq &args,
+                                            const LoadPinIndexMap &load_pin_index_map);
 
   // Find the delay for a timing check arc given the arc's
   // from/clock, to/data slews and related output pin parasitic.
@@ -261,6 +296,23 @@ public:
                                        const MinMax *min_max,
                                        int digits) = 0;
   virtual void finishDrvrPin() = 0;
+  // The parasitics of drvr_pin (all drivers if nullptr) changed so
+  // parasitic reductions kept by the delay calculator are stale.
+  virtual void parasiticsInvalid(const Pin *drvr_pin);
+
+  // Add the profile counts of the delay calculator and the delay
+  // calculators it uses to counts.
+  virtual void addCounts(ArcDcalcCountsMap &counts) const;
+  virtual void clearCounts();
+  void incrCallCount(size_t count) { counts_.call_count += count; }
+  void incrTime(double time) { counts_.time += time; }
+
+protected:
+  void incrFallbackCount() { counts_.fallback_count++; }
+  // Count a parasitic reduction that started at elapsedRunTime begin_time.
+  void incrReduction(double begin_time);
+
+  ArcDcalcCounts counts_;
 };
 
 } // namespace sta
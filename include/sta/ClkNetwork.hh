@@ -58,6 +58,7 @@ public:
   const ClockSet *idealClocks(const Pin *pin) const;
   const PinSet *pins(const Clock *clk);
   void clkPinsInvalid();
+  bool clkPinsValid() const { return clk_pins_valid_; }
   float idealClkSlew(const Pin *pin,
                      const RiseFall *rf,
                      const MinMax *min_max) const;
@@ -291,6 +291,8 @@ protected:
 
 private:
   friend class ConcreteLibertyLibraryIterator;
+  friend class NetlistSnapshotWriter;
+  friend class NetlistSnapshotReader;
 };
 
 class ConcreteInstance
@@ -342,6 +344,7 @@ protected:
 private:
   friend class ConcreteNetwork;
   friend class ConcreteInstancePinIterator;
+  friend class NetlistSnapshotWriter;
 };
 
 class ConcretePin
@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <string>
 
 #include "LibertyClass.hh"
@@ -86,6 +88,11 @@ public:
   // Return true if there is a mismatch.
   bool checkSize(size_t size);
   bool checkSize(LibertyPort *port);
+  // Compile the truth table used to evaluate the function without BDDs.
+  void makeTruthTable();
+  // nullptr if the truth table was not made or the function has more
+  // than FuncTruthTable::max_var_count ports.
+  const FuncTruthTable *truthTable() const { return truth_table_; }
 
 private:
   void findPorts(const FuncExpr *expr,
@@ -99,6 +106,57 @@ private:
   FuncExpr *left_;
   FuncExpr *right_;
   LibertyPort *port_;
+  FuncTruthTable *truth_table_{nullptr};
+};
+
+// Truth table of a function of up to 6 ports.
+// Minterm m has the value of var i in bit i of m. Minterm sets are
+// bit masks with bit m set for minterm m.
+class FuncTruthTable
+{
+public:
+  static constexpr size_t max_var_count = 6;
+
+  // nullptr if expr has more than max_var_count ports.
+  static FuncTruthTable *make(const FuncExpr *expr);
+  size_t varCount() const { return var_count_; }
+  const LibertyPort *var(size_t var_index) const { return vars_[var_index]; }
+  // -1 if port is not a function input.
+  int varIndex(const LibertyPort *port) const;
+  // Minterms where the function is one.
+  uint64_t ones() const { return ones_; }
+  // Minterms where the function changes with var (Boolean difference).
+  uint64_t diff(size_t var_index) const { return diffs_[var_index]; }
+  // All minterms.
+  uint64_t minterms() const;
+  // Minterms with the values of the vars in care_vars.
+  uint64_t cube(unsigned care_vars,
+                unsigned var_values) const;
+  // Probability of the minterms given the probability each var is one.
+  float probability(uint64_t minterms,
+                    const float *var_probs) const;
+  // Sense of the function wrt var in the minterms of cube.
+  // Cube must not constrain var.
+  TimingSense sense(size_t var_index,
+                    uint64_t cube) const;
+  // Minterms where var is one.
+  static uint64_t varOnes(size_t var_index);
+
+private:
+  FuncTruthTable(const std::array<const LibertyPort*, max_var_count> &vars,
+                 size_t var_count,
+                 uint64_t ones);
+  static uint64_t evalOnes(const FuncExpr *expr,
+                           const std::array<const LibertyPort*,
+                                            max_var_count> &vars,
+                           size_t var_count,
+                           // Return value.
+                           bool &valid);
+
+  std::array<const LibertyPort*, max_var_count> vars_;
+  size_t var_count_;
+  uint64_t ones_;
+  std::array<uint64_t, max_var_count> diffs_;
 };
 
 // Negate an expression.
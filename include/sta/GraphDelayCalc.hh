@@ -39,6 +39,9 @@
 namespace sta {
 
 class DelayCalcObserver;
+class DcalcCache;
+class DcalcCacheKey;
+class DcalcProfile;
 class MultiDrvrNet;
 class FindVertexDelays;
 class NetCaps;
@@ -81,6 +84,19 @@ public:
   // delays to be recomputed during incremental delay calculation.
   virtual float incrementalDelayTolerance();
   virtual void setIncrementalDelayTolerance(float tol);
+  // Relative input slew quantization step for reusing driver arc delay
+  // calculation results with the same arc and reduced load.
+  // Zero disables the cache.
+  float cacheTolerance() const { return cache_tolerance_; }
+  void setCacheTolerance(float tol);
+  // Report delay calculator call counts and times and the top_count
+  // slowest drivers since the last clearProfile.
+  void reportProfile(size_t top_count);
+  // Delay calculator name -> counts since the last clearProfile.
+  ArcDcalcCountsMap profileCounts() const;
+  void clearProfile();
+  // Keep the profile counts of the delay calculator before it is replaced.
+  void keepProfileCounts();
 
   float loadCap(const Pin *drvr_pin,
                 const Scene *scene,
@@ -188,22 +204,35 @@ protected:
                          const MinMax *min_max,
                          ArcDelayCalc *arc_delay_calc);
   void findDriverDelays(Vertex *drvr_vertex,
+                        MultiDrvrNet *multi_drvr,
 			ArcDelayCalc *arc_delay_calc,
+                        DcalcCache *cache,
+                        DcalcProfile *profile,
                         LoadPinIndexMap &load_pin_index_map);
+  void profileDrvr(const Vertex *drvr_vertex,
+                   double begin_time,
+                   ArcDelayCalc *arc_delay_calc,
+                   DcalcProfile *profile);
   MultiDrvrNet *multiDrvrNet(const Vertex *drvr_vertex) const;
-  MultiDrvrNet *findMultiDrvrNet(Vertex *drvr_vertex);
+  void findMultiDrvrNets();
+  void findMultiDrvrNet(Vertex *drvr_vertex);
   MultiDrvrNet *makeMultiDrvrNet(Vertex *drvr_vertex);
+  void findMultiDrvrDelays(std::vector<ArcDelayCalc*> &arc_delay_calcs,
+                           std::vector<DcalcCache*> &caches,
+                           std::vector<DcalcProfile*> &profiles);
   bool hasMultiDrvrs(Vertex *drvr_vertex);
   Vertex *firstLoad(Vertex *drvr_vertex);
   bool findDriverDelays1(Vertex *drvr_vertex,
 			 MultiDrvrNet *multi_drvr,
 			 ArcDelayCalc *arc_delay_calc,
+                         DcalcCache *cache,
                          LoadPinIndexMap &load_pin_index_map);
   void initLoadSlews(Vertex *drvr_vertex);
   bool findDriverEdgeDelays(Vertex *drvr_vertex,
                             const MultiDrvrNet *multi_drvr,
                             Edge *edge,
                             ArcDelayCalc *arc_delay_calc,
+                            DcalcCache *cache,
                             LoadPinIndexMap &load_pin_index_map,
                             // Return value.
                             std::array<bool, RiseFall::index_count> &delay_exists);
@@ -215,6 +244,32 @@ protected:
                            const MinMax *min_max,
                            ArcDelayCalc *arc_delay_calc,
                            LoadPinIndexMap &load_pin_index_map);
+  bool findDriverArcDelays(Vertex *drvr_vertex,
+                           const MultiDrvrNet *multi_drvr,
+                           Edge *edge,
+                           const TimingArc *arc,
+                           const SceneSeq &scenes,
+                           ArcDelayCalc *arc_delay_calc,
+                           DcalcCache *cache,
+                           LoadPinIndexMap &load_pin_index_map);
+  ArcDcalcResultSeq cachedSceneGateDelays(ArcDcalcArgSeq &dcalc_args,
+                                          const LoadPinIndexMap &load_pin_index_map,
+                                          ArcDelayCalc *arc_delay_calc,
+                                          DcalcCache *cache);
+  bool makeCacheKey(const ArcDcalcArg &dcalc_arg,
+                    const LoadPinIndexMap &load_pin_index_map,
+                    // Return values.
+                    DcalcCacheKey &key,
+                    Slew &cache_slew) const;
+  DcalcCache *acquireCache();
+  void releaseCache(DcalcCache *cache);
+  DcalcProfile *acquireProfile();
+  void releaseProfile(DcalcProfile *profile);
+  void clearProfileDrvrs();
+  void deleteProfileDrvr(const Vertex *drvr_vertex);
+  size_t profileCallCount() const;
+  void clearCaches();
+  void deleteCaches();
   ArcDcalcArgSeq makeArcDcalcArgs(Vertex *drvr_vertex,
                                   const MultiDrvrNet *multi_drvr,
                                   Edge *edge,
@@ -232,7 +287,12 @@ protected:
   void zeroSlewAndWireDelays(Vertex *drvr_vertex,
                              const RiseFall *rf);
   void findVertexDelay(Vertex *vertex,
-		       ArcDelayCalc *arc_delay_calc);
+		       ArcDelayCalc *arc_delay_calc,
+                       DcalcCache *cache,
+                       DcalcProfile *profile);
+  void enqueueDrvrFanouts(Vertex *drvr_vertex,
+                          DrvrLoadSlews &load_slews_prev,
+                          LoadPinIndexMap &load_pin_index_map);
   DrvrLoadSlews loadSlews(LoadPinIndexMap &load_pin_index_map);
   void enqueueCheckEdges(Vertex *vertex);
   bool loadSlewChanged(Vertex *load_vertex,
@@ -308,11 +368,27 @@ protected:
   SearchPred *search_pred_;
   SearchPred *search_non_latch_pred_;
   BfsFwdIterator *iter_;
+  // Multi-driver nets are found before the parallel delay calc pass so
+  // the map is only read by the delay calc threads.
   MultiDrvrNetMap multi_drvr_net_map_;
+  // Defer multi-driver nets to findMultiDrvrDelays at the end of each level.
+  bool multi_drvr_tasks_{false};
+  std::vector<MultiDrvrNet*> multi_drvr_pending_;
   std::mutex multi_drvr_lock_;
+  // Lock the loads of multi-driver nets while their drivers are found.
+  bool lock_multi_drvr_loads_{false};
   // Percentage (0.0:1.0) change in delay that causes downstream
   // delays to be recomputed during incremental delay calculation.
   float incremental_delay_tolerance_{0.0};
+  float cache_tolerance_{0.0};
+  // Driver arc delay calculation caches used by one thread at a time.
+  std::vector<DcalcCache*> caches_;
+  std::vector<DcalcCache*> free_caches_;
+  std::mutex cache_lock_;
+  // Delay calculation profiles used by one thread at a time.
+  std::vector<DcalcProfile*> profiles_;
+  std::vector<DcalcProfile*> free_profiles_;
+  std::mutex profile_lock_;
 
   friend class FindVertexDelays;
   friend class MultiDrvrNet;
@@ -337,6 +413,8 @@ public:
   const VertexSeq &drvrs() const { return drvrs_; }
   bool parallelGates(const Network *network) const;
   Vertex *dcalcDrvr() const { return dcalc_drvr_; }
+  // Serializes the load slew merges of drivers found by separate tasks.
+  std::mutex &loadLock() { return load_lock_; }
   void setDcalcDrvr(Vertex *drvr);
   void netCaps(const RiseFall *rf,
                const Scene *scene,
@@ -354,6 +432,7 @@ private:
   VertexSeq drvrs_;
   // [drvr_rf->index][dcalc_ap->index]
   std::vector<NetCaps> net_caps_;
+  std::mutex load_lock_;
 };
 
 } // namespace sta
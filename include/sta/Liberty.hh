@@ -620,6 +620,8 @@ public:
   // for all the defined scenes.
   static void checkLibertyScenes();
   void ensureVoltageWaveforms(const SceneSeq &scenes);
+  // Make voltage waveforms for the cell timing arc models.
+  void makeVoltageWaveforms(float vdd);
   const std::string &footprint() const { return footprint_; }
   void setFootprint(std::string_view footprint);
   const std::string &userFunctionClass() const { return user_function_class_; }
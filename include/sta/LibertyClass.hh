@@ -57,6 +57,7 @@ class InternalPower;
 class LeakagePower;
 class Sequential;
 class FuncExpr;
+class FuncTruthTable;
 class TimingModel;
 class TimingRole;
 class Transition;
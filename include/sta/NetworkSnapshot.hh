@@ -24,42 +24,21 @@
 
 #pragma once
 
-#include "SaifLocation.hh"
-#include "SaifParse.hh"
-
-#ifndef __FLEX_LEXER_H
-#undef yyFlexLexer
-#define yyFlexLexer SaifFlexLexer
-#include <FlexLexer.h>
-#endif
+#include <string_view>
 
 namespace sta {
 
-class Report;
-class SaifReader;
-
-class SaifScanner : public SaifFlexLexer
-{
-public:
-  SaifScanner(std::istream *stream,
-             const std::string &filename,
-             SaifReader *reader,
-             Report *report);
-  virtual int lex(SaifParse::semantic_type *yylval,
-                  SaifParse::location_type *yylloc);
-  // YY_DECL defined in SaifLex.ll
-  // Method body created by flex in SaifLex.cc
-
-  void error(const char *msg);
-
-  // Get rid of override virtual function warning.
-  using FlexLexer::yylex;
-
-private:
-  std::string filename_;
-  SaifReader *reader_;
-  Report *report_;
-  std::string token_;
-};
+class ConcreteNetwork;
+
+// Binary snapshot of a linked network that is reloaded without reading
+// or linking verilog. Liberty cells are bound by library and cell name
+// so the libraries must be read before the snapshot.
+void
+writeNetlistSnapshot(std::string_view filename,
+                     ConcreteNetwork *network);
+// Replaces the linked network. Return true if successful.
+bool
+readNetlistSnapshot(std::string_view filename,
+                    ConcreteNetwork *network);
 
 } // namespace sta
@@ -25,7 +25,11 @@
 #pragma once
 
 #include <complex>
+#include <cstdint>
 #include <map>
+#include <span>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "LibertyClass.hh"
@@ -226,6 +230,10 @@ public:
   // }
   ParasiticNodeResistorMap parasiticNodeResistorMap(const Parasitic *parasitic) const;
   ParasiticNodeCapacitorMap parasiticNodeCapacitorMap(const Parasitic *parasitic) const;
+  // Parasitic network nodes have a dense index in [0, nodeCount) that
+  // can be used to index vectors instead of maps keyed by node.
+  virtual size_t nodeCount(const Parasitic *parasitic) const = 0;
+  virtual uint32_t nodeIndex(const ParasiticNode *node) const = 0;
 
   // Filters loads that are missing path from driver.
   virtual PinSet unannotatedLoads(const Parasitic *parasitic,
@@ -266,6 +274,16 @@ public:
   virtual void loadPinCapacitanceChanged(const Pin *pin) = 0;
   float couplingCapFactor() const { return coupling_cap_factor_; }
   void setCouplingCapFactor(float factor);
+  // Spef file read into the parasitics and the hash of its contents
+  // used to check parasitics caches. The hash is zero if no spef file,
+  // more than one spef file or an unreadable spef file was read.
+  // A zero hash passed to setSpefFile is found when it is first used
+  // so reading a spef file does not read it twice.
+  const std::string &spefFilename() const { return spef_filename_; }
+  size_t spefHash() const;
+  void setSpefFile(std::string_view filename,
+                   size_t hash);
+  void spefFileInvalid();
 
 protected:
   void makeWireloadNetworkWorst(Parasitic *parasitic,
@@ -288,8 +306,35 @@ protected:
   const Net *findParasiticNet(const Pin *pin) const;
 
   float coupling_cap_factor_ {1.0};
+  std::string spef_filename_;
+  mutable size_t spef_hash_{0};
+  bool spef_file_valid_{true};
 };
 
+// Devices connected to each parasitic network node in compressed
+// sparse row form. Devices are in network order for each node.
+// ParasiticResistorAdjacency adjacency(parasitic_network, parasitics_);
+// for (ParasiticResistor *resistor : adjacency.devices(node)) {
+// }
+template <class DEVICE>
+class ParasiticDeviceAdjacency
+{
+public:
+  ParasiticDeviceAdjacency() = default;
+  ParasiticDeviceAdjacency(const Parasitic *parasitic,
+                           const Parasitics *parasitics);
+  std::span<DEVICE* const> devices(const ParasiticNode *node) const;
+
+private:
+  const Parasitics *parasitics_{nullptr};
+  // Devices of node index i are devices_[offsets_[i], offsets_[i + 1]).
+  std::vector<uint32_t> offsets_;
+  std::vector<DEVICE*> devices_;
+};
+
+using ParasiticResistorAdjacency = ParasiticDeviceAdjacency<ParasiticResistor>;
+using ParasiticCapacitorAdjacency = ParasiticDeviceAdjacency<ParasiticCapacitor>;
+
 class ParasiticNodeLess
 {
 public:
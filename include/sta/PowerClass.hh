@@ -84,7 +84,8 @@ public:
   float switching() const { return switching_; }
   float leakage() const { return leakage_; }
   float total() const;
-  void incr(PowerResult &result);
+  void incr(const PowerResult &result);
+  void decr(const PowerResult &result);
   void incrInternal(float pwr);
   void incrSwitching(float pwr);
   void incrLeakage(float pwr);
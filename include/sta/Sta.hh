@@ -163,6 +163,11 @@ public:
   // Return true if successful.
   bool linkDesign(const char *top_cell_name,
                   bool make_black_boxes);
+  // Write the linked network to a binary snapshot file.
+  void writeNetlistSnapshot(std::string_view filename);
+  // Replace the network with a snapshot written by writeNetlistSnapshot.
+  // Return true if successful.
+  bool readNetlistSnapshot(std::string_view filename);
 
   bool readSdf(std::string_view filename,
                std::string_view path,
@@ -1242,6 +1247,16 @@ public:
                 float coupling_cap_factor,
                 bool reduce);
   Parasitics *findParasitics(const std::string &name);
+  // Write the reduced parasitics of spef name to a binary cache file.
+  void writeParasiticsCache(std::string_view name,
+                            std::string_view filename);
+  // Read reduced parasitics from a cache file written by
+  // writeParasiticsCache instead of reading and reducing spef.
+  // Return false if the cache does not match the netlist, spef file
+  // or delay calculator.
+  bool readParasiticsCache(std::string_view name,
+                           std::string_view filename,
+                           std::string_view spef_filename);
   void reportParasiticAnnotation(const std::string &spef_name,
                                  bool report_unannotated);
   // Parasitics.
@@ -1274,6 +1289,22 @@ public:
                                   bool includes_pin_caps,
                                   const Scene *scene,
                                   const MinMax *min_max);
+  // Parasitic ECO for one net.
+  // Return the parasitic network of net in parasitics to edit with the
+  // Parasitics node, resistor and capacitor functions. The network is
+  // replaced by an empty one if replace is true or net does not have one.
+  // Reduced parasitics of the net drivers are deleted.
+  Parasitic *beginParasiticEco(const Net *net,
+                               Parasitics *parasitics,
+                               bool includes_pin_caps,
+                               bool replace);
+  // Finish the parasitic ECO for net. With reduce the network is
+  // reduced for the net drivers in the scenes that use parasitics and
+  // deleted if the delay calculator supports reduction. Only the delays
+  // from the net drivers are invalidated.
+  void finishParasiticEco(const Net *net,
+                          Parasitics *parasitics,
+                          bool reduce);
 
   ////////////////////////////////////////////////////////////////
   // TCL network edit function support.
@@ -1372,6 +1403,14 @@ public:
   // delays to be recomputed during incremental delay calculation.
   // Defaults to 0.0 for maximum accuracy and slowest incremental speed.
   void setIncrementalDelayTolerance(float tol);
+  // Relative input slew quantization step (0.0:1.0) used to reuse
+  // delay calculation results for drivers with the same arc and load.
+  // Defaults to 0.0, which disables the delay calc cache.
+  void setDelayCalcCacheTolerance(float tol);
+  // Report delay calculator call counts and times and the top_count
+  // drivers that took the most time to find delays.
+  void reportDelayCalcProfile(int top_count);
+  void clearDelayCalcProfile();
   // Make graph and find delays.
   void searchPreamble();
 
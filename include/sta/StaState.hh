@@ -101,6 +101,7 @@ public:
   Latches *latches() { return latches_; }
   Latches *latches() const { return latches_; }
   size_t threadCount() const { return thread_count_; }
+  DispatchQueue *dispatchQueue() const { return dispatch_queue_; }
   bool crprActive(const Mode *mode) const;
   Variables *variables() { return variables_; }
   const Variables *variables() const { return variables_; }
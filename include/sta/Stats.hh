@@ -38,6 +38,9 @@ public:
   Stats(Debug *debug,
         Report *report);
   void report(const char *step);
+  // Report a count found by step.
+  void reportCount(const char *step,
+                   size_t count);
 
 private:
   double elapsed_begin_{0.0};
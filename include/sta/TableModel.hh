@@ -25,6 +25,7 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -46,6 +47,7 @@ class Table;
 class TableModel;
 class TableAxis;
 class OutputWaveforms;
+class CompiledTable;
 
 using FloatSeq = std::vector<float>;
 using FloatTable = std::vector<FloatSeq>;
@@ -96,6 +98,14 @@ public:
                               int digits) const override;
   float driveResistance(const Pvt *pvt) const override;
   void setIsScaled(bool is_scaled) override;
+  // Gate delay and driver slew for count (in_slew, load_cap) points.
+  void gateDelays(const Pvt *pvt,
+                  const float *in_slews,
+                  const float *load_caps,
+                  size_t count,
+                  // Return values.
+                  float *gate_delays,
+                  float *drvr_slews) const;
 
   const TableModels *delayModels() const { return delay_models_.get(); }
   const TableModel *delayModel() const;
@@ -137,11 +147,18 @@ protected:
                       float &axis_value2,
                       float &axis_value3) const;
   static bool checkAxis(const TableAxis *axis);
+  void makeCompiledTables();
 
   std::unique_ptr<TableModels> delay_models_;
   std::unique_ptr<TableModels> slew_models_;
   ReceiverModelPtr receiver_model_;
   std::unique_ptr<OutputWaveforms> output_waveforms_;
+  // Compiled order 2 delay/slew tables (nullptr for other orders).
+  std::unique_ptr<CompiledTable> delay_table_;
+  std::unique_ptr<CompiledTable> slew_table_;
+  // Delay and slew tables have the same axes so a lookup point is
+  // found once for both.
+  bool compiled_axes_equal_{false};
 };
 
 class CheckTableModel : public CheckTimingModel
@@ -346,6 +363,65 @@ private:
   TableAxisPtr axis3_;
 };
 
+// Order 2 slew/cap table compiled for repeated lookups.
+// Values are a contiguous copy of the table values, so a compiled
+// gate model keeps its delay and slew values twice. Single value axes
+// are padded to two points so every lookup interpolates between four
+// values. Lookups return the same values as Table::findValue.
+class CompiledTable
+{
+public:
+  // Lookup point in the table.
+  class Point
+  {
+  public:
+    size_t offset;
+    double dx1;
+    double dx2;
+  };
+
+  // Table axes must be input slew and load capacitance.
+  CompiledTable(const Table *table);
+  bool axesEqual(const CompiledTable *table) const;
+  Point findPoint(float in_slew,
+                  float load_cap) const;
+  float value(const Point &point) const;
+  float findValue(float in_slew,
+                  float load_cap) const;
+  // Interpolate count (in_slew, load_cap) points.
+  void findValues(const float *in_slews,
+                  const float *load_caps,
+                  size_t count,
+                  // Return values.
+                  float *values) const;
+  // Return true if table can be compiled.
+  static bool compilable(const Table *table);
+
+private:
+  static void compileAxis(const TableAxis *axis,
+                          // Return values.
+                          FloatSeq &axis_values,
+                          bool &padded);
+  static size_t findAxisIndex(float value,
+                              const FloatSeq &axis_values);
+  static double axisFraction(float value,
+                             size_t index,
+                             const FloatSeq &axis_values,
+                             bool padded);
+
+  // Axes up to this size are searched with a linear count.
+  static constexpr size_t linear_search_max = 16;
+
+  bool axis1_is_slew_;
+  FloatSeq axis1_;
+  FloatSeq axis2_;
+  bool axis1_padded_;
+  bool axis2_padded_;
+  size_t size2_;
+  // Row major axis1 x axis2 values.
+  FloatSeq values_;
+};
+
 // Wrapper class for Table to apply scale factors.
 class TableModel
 {
@@ -389,10 +465,10 @@ public:
                           int digits) const;
   std::string report(const Units *units,
                      Report *report) const;
-
-protected:
   float scaleFactor(const LibertyCell *cell,
                     const Pvt *pvt) const;
+
+protected:
   std::string reportPvtScaleFactor(const LibertyCell *cell,
                                    const Pvt *pvt,
                                    int digits) const;
@@ -516,6 +592,10 @@ private:
                       size_t wave_index11);
   float voltageTime2(float volt,
                      size_t wave_index);
+  void makeVoltageGrid();
+  size_t findVoltageIndex(float volt,
+                          size_t wave_index,
+                          const FloatSeq &voltages) const;
 
   // Row.
   TableAxisPtr slew_axis_;
@@ -527,6 +607,12 @@ private:
   Table1Seq voltage_currents_;
   Table ref_times_;
   float vdd_{0.0F};
+  // Voltage waveform index of each normalized voltage grid point
+  // (voltage_grid_count_ + 1 per waveform) where the segment search
+  // for voltages above the grid point starts.
+  // Empty if a voltage waveform is not monotonic.
+  std::vector<uint16_t> voltage_grid_;
+  static constexpr size_t voltage_grid_count_ = 16;
   static constexpr size_t voltage_waveform_step_count_ = 100;
 };
 
@@ -60,6 +60,7 @@ class VerilogNetBitSelect;
 class VerilogNetPartSelect;
 class StringRegistry;
 class VerilogBindingTbl;
+class VerilogInstLink;
 class VerilogNetNameIterator;
 class VerilogNetPortRef;
 class LibertyCell;
@@ -221,9 +222,21 @@ protected:
                              VerilogModule *parent_module,
                              VerilogBindingTbl *parent_bindings,
                              bool make_black_boxes);
+  void resolveLinks();
+  void resolveLinks(VerilogModule *module,
+                    size_t stmt_begin,
+                    size_t stmt_end);
+  VerilogInstLink *makeInstLink(VerilogModuleInst *mod_inst,
+                                VerilogModule *parent_module,
+                                Cell *cell);
+  VerilogInstLink *makeModuleInstLink(VerilogModuleInst *mod_inst,
+                                      VerilogModule *parent_module,
+                                      bool make_black_boxes);
+  Cell *findInstCell(VerilogModuleInst *mod_inst);
+  void resolveLibertyInst(VerilogLibertyInst *lib_inst,
+                          VerilogModule *parent_module);
   void makeLibertyInst(VerilogLibertyInst *lib_inst,
                        Instance *parent,
-                       VerilogModule *parent_module,
                        VerilogBindingTbl *parent_bindings);
   void bindGlobalNets(VerilogBindingTbl *bindings);
   void makeNamedInstPins1(Cell *cell,
@@ -234,32 +247,17 @@ protected:
                           VerilogBindingTbl *parent_bindings,
                           bool is_leaf);
   void makeNamedInstPins(Cell *cell,
-                         Instance *inst,
                          VerilogModuleInst *mod_inst,
-                         VerilogBindingTbl *bindings,
-                         Instance *parent,
                          VerilogModule *parent_module,
-                         VerilogBindingTbl *parent_bindings,
-                         bool is_leaf);
+                         VerilogInstLink *link);
   void makeOrderedInstPins(Cell *cell,
-                           Instance *inst,
                            VerilogModuleInst *mod_inst,
-                           VerilogBindingTbl *bindings,
-                           Instance *parent,
                            VerilogModule *parent_module,
-                           VerilogBindingTbl *parent_bindings,
-                           bool is_leaf);
+                           VerilogInstLink *link);
   void mergeAssignNet(VerilogAssign *assign,
                       VerilogModule *module,
                       Instance *inst,
                       VerilogBindingTbl *bindings);
-  void makeInstPin(Instance *inst,
-                   Port *port,
-                   VerilogNetNameIterator *net_name_iter,
-                   VerilogBindingTbl *bindings,
-                   Instance *parent,
-                   VerilogBindingTbl *parent_bindings,
-                   bool is_leaf);
   void makeInstPin(Instance *inst,
                    Port *port,
                    const std::string &net_name,
@@ -36,6 +36,9 @@ public:
   virtual ~VertexVisitor() = default;
   virtual VertexVisitor *copy() const = 0;
   virtual void visit(Vertex *vertex) = 0;
+  // Called by BfsIterator::visitParallel after the vertices in a level
+  // are visited and before the next level is started.
+  virtual void levelFinished() {}
   void operator()(Vertex *vertex) { visit(vertex); }
 };
 
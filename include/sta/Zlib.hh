@@ -43,6 +43,7 @@
 #define gzopen fopen
 #define gzclose fclose
 #define gzgets(stream,s,size) fgets(s,size,stream)
+#define gzread(stream,buf,len) fread(buf,1,len,stream)
 #define gzprintf fprintf
 #define Z_NULL nullptr
 
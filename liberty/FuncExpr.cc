@@ -93,6 +93,7 @@ FuncExpr::~FuncExpr()
 {
   delete left_;
   delete right_;
+  delete truth_table_;
 }
 
 void
@@ -372,6 +373,13 @@ FuncExpr::findPorts(const FuncExpr *expr,
   }
 }
 
+void
+FuncExpr::makeTruthTable()
+{
+  if (truth_table_ == nullptr)
+    truth_table_ = FuncTruthTable::make(this);
+}
+
 bool
 FuncExpr::equiv(const FuncExpr *expr1,
                 const FuncExpr *expr2)
@@ -423,4 +431,173 @@ FuncExpr::less(const FuncExpr *expr1,
     return (expr1 == nullptr && expr2 != nullptr);
 }
 
+////////////////////////////////////////////////////////////////
+
+// Minterms where var i is one.
+static constexpr std::array<uint64_t, FuncTruthTable::max_var_count> var_ones = {
+  0xaaaaaaaaaaaaaaaaull,
+  0xccccccccccccccccull,
+  0xf0f0f0f0f0f0f0f0ull,
+  0xff00ff00ff00ff00ull,
+  0xffff0000ffff0000ull,
+  0xffffffff00000000ull
+};
+
+FuncTruthTable *
+FuncTruthTable::make(const FuncExpr *expr)
+{
+  LibertyPortSet ports = expr->ports();
+  if (ports.size() <= max_var_count) {
+    std::array<const LibertyPort*, max_var_count> vars{};
+    size_t var_count = 0;
+    for (const LibertyPort *port : ports)
+      vars[var_count++] = port;
+    bool valid = true;
+    uint64_t ones = evalOnes(expr, vars, var_count, valid);
+    if (valid)
+      return new FuncTruthTable(vars, var_count, ones);
+  }
+  return nullptr;
+}
+
+FuncTruthTable::FuncTruthTable(const std::array<const LibertyPort*,
+                                                max_var_count> &vars,
+                               size_t var_count,
+                               uint64_t ones) :
+  vars_(vars),
+  var_count_(var_count),
+  ones_(ones & minterms()),
+  diffs_{}
+{
+  for (size_t var_index = 0; var_index < var_count_; var_index++) {
+    // Compare each var=0 minterm with its var=1 minterm.
+    unsigned shift = 1U << var_index;
+    uint64_t diff0 = (ones_ ^ (ones_ >> shift)) & ~varOnes(var_index);
+    diffs_[var_index] = diff0 | (diff0 << shift);
+  }
+}
+
+// Protect against null sub-expressions caused by unknown port refs.
+uint64_t
+FuncTruthTable::evalOnes(const FuncExpr *expr,
+                         const std::array<const LibertyPort*,
+                                          max_var_count> &vars,
+                         size_t var_count,
+                         // Return value.
+                         bool &valid)
+{
+  if (expr == nullptr) {
+    valid = false;
+    return 0;
+  }
+  switch (expr->op()) {
+  case FuncExpr::Op::port:
+    for (size_t var_index = 0; var_index < var_count; var_index++) {
+      if (vars[var_index] == expr->port())
+        return varOnes(var_index);
+    }
+    valid = false;
+    return 0;
+  case FuncExpr::Op::not_:
+    return ~evalOnes(expr->left(), vars, var_count, valid);
+  case FuncExpr::Op::or_:
+    return evalOnes(expr->left(), vars, var_count, valid)
+      | evalOnes(expr->right(), vars, var_count, valid);
+  case FuncExpr::Op::and_:
+    return evalOnes(expr->left(), vars, var_count, valid)
+      & evalOnes(expr->right(), vars, var_count, valid);
+  case FuncExpr::Op::xor_:
+    return evalOnes(expr->left(), vars, var_count, valid)
+      ^ evalOnes(expr->right(), vars, var_count, valid);
+  case FuncExpr::Op::one:
+    return ~0ULL;
+  case FuncExpr::Op::zero:
+    return 0;
+  }
+  // Prevent warnings from lame compilers.
+  return 0;
+}
+
+int
+FuncTruthTable::varIndex(const LibertyPort *port) const
+{
+  for (size_t var_index = 0; var_index < var_count_; var_index++) {
+    if (vars_[var_index] == port)
+      return var_index;
+  }
+  return -1;
+}
+
+uint64_t
+FuncTruthTable::varOnes(size_t var_index)
+{
+  return var_ones[var_index];
+}
+
+uint64_t
+FuncTruthTable::minterms() const
+{
+  if (var_count_ == max_var_count)
+    return ~0ULL;
+  else
+    return (1ULL << (1U << var_count_)) - 1;
+}
+
+uint64_t
+FuncTruthTable::cube(unsigned care_vars,
+                     unsigned var_values) const
+{
+  uint64_t cube = minterms();
+  for (size_t var_index = 0; var_index < var_count_; var_index++) {
+    unsigned var_bit = 1U << var_index;
+    if (care_vars & var_bit) {
+      if (var_values & var_bit)
+        cube &= varOnes(var_index);
+      else
+        cube &= ~varOnes(var_index);
+    }
+  }
+  return cube;
+}
+
+// Shannon expansion of the minterm values one var at a time, the
+// same as walking a BDD.
+float
+FuncTruthTable::probability(uint64_t minterms,
+                            const float *var_probs) const
+{
+  std::array<float, 1U << max_var_count> probs;
+  size_t count = 1U << var_count_;
+  for (size_t m = 0; m < count; m++)
+    probs[m] = (minterms >> m) & 1;
+  for (size_t var_index = 0; var_index < var_count_; var_index++) {
+    float prob = var_probs[var_index];
+    count /= 2;
+    for (size_t m = 0; m < count; m++)
+      probs[m] = probs[2 * m] * (1.0 - prob) + probs[2 * m + 1] * prob;
+  }
+  return probs[0];
+}
+
+TimingSense
+FuncTruthTable::sense(size_t var_index,
+                      uint64_t cube) const
+{
+  unsigned shift = 1U << var_index;
+  uint64_t cube0 = cube & ~varOnes(var_index);
+  // Function values with var=0 and var=1 at the var=0 minterms.
+  uint64_t ones0 = ones_ & cube0;
+  uint64_t ones1 = (ones_ >> shift) & cube0;
+  bool increasing = (ones0 & ~ones1) == 0;
+  bool decreasing = (ones1 & ~ones0) == 0;
+  if (increasing && decreasing)
+    return TimingSense::none;
+  else if (increasing)
+    return TimingSense::positive_unate;
+  else if (decreasing)
+    return TimingSense::negative_unate;
+  else
+    return TimingSense::non_unate;
+}
+
 } // namespace sta
@@ -49,6 +49,8 @@ InternalPower::InternalPower(LibertyPort *port,
   when_(when),
   models_(models)
 {
+  if (when_)
+    when_->makeTruthTable();
 }
 
 LibertyCell *
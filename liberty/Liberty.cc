@@ -1463,6 +1463,8 @@ LibertyCell::addScaledCell(OperatingConditions *op_cond,
                            LibertyCell *scaled_cell)
 {
   scaled_cells_[op_cond] = scaled_cell;
+  // Scaled models are checked by ensureVoltageWaveforms.
+  have_voltage_waveforms_ = false;
 
   LibertyCellPortBitIterator port_iter1(this);
   LibertyCellPortBitIterator port_iter2(scaled_cell);
@@ -1551,6 +1553,9 @@ LibertyCell::setSceneCell(LibertyCell *scene_cell,
   if (lib_ap_index >= scene_cells_.size())
     scene_cells_.resize(lib_ap_index + 1);
   scene_cells_[lib_ap_index] = scene_cell;
+  // Models of another cell are checked by ensureVoltageWaveforms.
+  if (scene_cell != this)
+    have_voltage_waveforms_ = false;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -1888,6 +1893,24 @@ LibertyCell::ensureVoltageWaveforms(const SceneSeq &scenes)
   }
 }
 
+void
+LibertyCell::makeVoltageWaveforms(float vdd)
+{
+  for (TimingArcSet *arc_set : timingArcSets()) {
+    for (TimingArc *arc : arc_set->arcs()) {
+      GateTableModel *model = arc->gateTableModel();
+      if (model) {
+        OutputWaveforms *output_waveforms = model->outputWaveforms();
+        if (output_waveforms)
+          output_waveforms->ensureVoltageWaveforms(vdd);
+      }
+    }
+  }
+  // The cell's own models are all it uses until scene cells or scaled
+  // cells are added, so ensureVoltageWaveforms has nothing to do.
+  have_voltage_waveforms_ = true;
+}
+
 void
 LibertyCell::setFootprint(std::string_view footprint)
 {
@@ -2214,6 +2237,8 @@ void
 LibertyPort::setFunction(FuncExpr *func)
 {
   function_ = func;
+  if (func)
+    func->makeTruthTable();
   if (hasMembers()) {
     LibertyPortMemberIterator member_iter(this);
     int bit_offset = 0;
@@ -2230,6 +2255,8 @@ void
 LibertyPort::setTristateEnable(FuncExpr *enable)
 {
   tristate_enable_ = enable;
+  if (enable)
+    enable->makeTruthTable();
   if (hasMembers()) {
     LibertyPortMemberIterator member_iter(this);
     while (member_iter.hasNext()) {
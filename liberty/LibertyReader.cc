@@ -164,9 +164,29 @@ LibertyReader::endLibrary(const LibertyGroup *library_group,
   if (!library_group->empty())
     readLibraryAttributes(library_group);
   checkThresholds(library_group);
+  makeVoltageWaveforms();
   delete library_group;
 }
 
+// Make the ccs voltage waveforms when the library is read so delay
+// calculation does not have to make them on demand.
+void
+LibertyReader::makeVoltageWaveforms()
+{
+  if (library_) {
+    float vdd;
+    bool vdd_exists;
+    library_->supplyVoltage("VDD", vdd, vdd_exists);
+    if (vdd_exists && vdd != 0.0) {
+      LibertyCellIterator cell_iter(library_);
+      while (cell_iter.hasNext()) {
+        LibertyCell *cell = cell_iter.next();
+        cell->makeVoltageWaveforms(vdd);
+      }
+    }
+  }
+}
+
 ////////////////////////////////////////////////////////////////
 
 void
@@ -133,6 +133,7 @@ protected:
                           TableTemplateType type);
   void readThresholds(const LibertyGroup *library_group);
   void checkThresholds(const LibertyGroup *library_group) const;
+  void makeVoltageWaveforms();
   TableAxisPtr makeTableTemplateAxis(const LibertyGroup *template_group,
                                      int axis_index);
   void readVoltateMaps(const LibertyGroup *library_group);
@@ -49,6 +49,10 @@ Sequential::Sequential(bool is_register,
   output_(output),
   output_inv_(output_inv)
 {
+  if (clock_)
+    clock_->makeTruthTable();
+  if (data_)
+    data_->makeTruthTable();
 }
 
 Sequential::Sequential(Sequential &&other) noexcept :
@@ -25,6 +25,7 @@
 #include "TableModel.hh"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
 #include <memory>
@@ -75,6 +76,7 @@ GateTableModel::GateTableModel(LibertyCell *cell,
   receiver_model_(std::move(receiver_model)),
   output_waveforms_(output_waveforms)
 {
+  makeCompiledTables();
 }
 
 GateTableModel::GateTableModel(LibertyCell *cell,
@@ -86,6 +88,20 @@ GateTableModel::GateTableModel(LibertyCell *cell,
   receiver_model_(nullptr),
   output_waveforms_(nullptr)
 {
+  makeCompiledTables();
+}
+
+void
+GateTableModel::makeCompiledTables()
+{
+  const TableModel *delay_model = delayModel();
+  if (delay_model && CompiledTable::compilable(delay_model->table().get()))
+    delay_table_ = std::make_unique<CompiledTable>(delay_model->table().get());
+  const TableModel *slew_model = slewModel();
+  if (slew_model && CompiledTable::compilable(slew_model->table().get()))
+    slew_table_ = std::make_unique<CompiledTable>(slew_model->table().get());
+  compiled_axes_equal_ = delay_table_ && slew_table_
+    && delay_table_->axesEqual(slew_table_.get());
 }
 
 const TableModel *
@@ -117,6 +133,17 @@ GateTableModel::gateDelay(const Pvt *pvt,
                           float &gate_delay,
                           float &drvr_slew) const
 {
+  if (compiled_axes_equal_) {
+    // Find the lookup point once for the delay and slew tables.
+    CompiledTable::Point point = delay_table_->findPoint(in_slew, load_cap);
+    gate_delay = delay_table_->value(point)
+      * delay_models_->model()->scaleFactor(cell_, pvt);
+    drvr_slew = slew_table_->value(point)
+      * slew_models_->model()->scaleFactor(cell_, pvt);
+    // Clip negative slews to zero.
+    drvr_slew = std::max(drvr_slew, 0.0F);
+    return;
+  }
   if (delay_models_ && delay_models_->model())
     gate_delay = findValue(pvt, delay_models_->model(), in_slew, load_cap, 0.0);
   else
@@ -130,6 +157,41 @@ GateTableModel::gateDelay(const Pvt *pvt,
     drvr_slew = 0.0;
 }
 
+void
+GateTableModel::gateDelays(const Pvt *pvt,
+                           const float *in_slews,
+                           const float *load_caps,
+                           size_t count,
+                           // Return values.
+                           float *gate_delays,
+                           float *drvr_slews) const
+{
+  if (compiled_axes_equal_) {
+    float delay_scale = delay_models_->model()->scaleFactor(cell_, pvt);
+    float slew_scale = slew_models_->model()->scaleFactor(cell_, pvt);
+    // Find the points for a block of lookups and then interpolate
+    // each table in a separate loop the compiler can vectorize.
+    constexpr size_t block_size = 64;
+    std::array<CompiledTable::Point, block_size> points;
+    for (size_t start = 0; start < count; start += block_size) {
+      size_t block_count = std::min(block_size, count - start);
+      for (size_t i = 0; i < block_count; i++)
+        points[i] = delay_table_->findPoint(in_slews[start + i],
+                                            load_caps[start + i]);
+      for (size_t i = 0; i < block_count; i++)
+        gate_delays[start + i] = delay_table_->value(points[i]) * delay_scale;
+      for (size_t i = 0; i < block_count; i++)
+        // Clip negative slews to zero.
+        drvr_slews[start + i] =
+          std::max(slew_table_->value(points[i]) * slew_scale, 0.0F);
+    }
+  }
+  else {
+    for (size_t i = 0; i < count; i++)
+      gateDelay(pvt, in_slews[i], load_caps[i], gate_delays[i], drvr_slews[i]);
+  }
+}
+
 void
 GateTableModel::gateDelayPocv(const Pvt *pvt,
                               float in_slew,
@@ -417,6 +479,154 @@ GateTableModel::checkAxis(const TableAxis *axis)
 
 ////////////////////////////////////////////////////////////////
 
+static bool
+isSlewAxisVariable(TableAxisVariable var)
+{
+  return var == TableAxisVariable::input_transition_time
+    || var == TableAxisVariable::input_net_transition;
+}
+
+bool
+CompiledTable::compilable(const Table *table)
+{
+  if (table && table->order() == 2
+      && table->axis1()->size() > 0
+      && table->axis2()->size() > 0) {
+    TableAxisVariable var1 = table->axis1()->variable();
+    TableAxisVariable var2 = table->axis2()->variable();
+    TableAxisVariable cap_var = TableAxisVariable::total_output_net_capacitance;
+    return (isSlewAxisVariable(var1) && var2 == cap_var)
+      || (var1 == cap_var && isSlewAxisVariable(var2));
+  }
+  return false;
+}
+
+CompiledTable::CompiledTable(const Table *table) :
+  axis1_is_slew_(isSlewAxisVariable(table->axis1()->variable()))
+{
+  compileAxis(table->axis1(), axis1_, axis1_padded_);
+  compileAxis(table->axis2(), axis2_, axis2_padded_);
+  size_t size1 = table->axis1()->size();
+  size_t size2 = table->axis2()->size();
+  size2_ = axis2_.size();
+  values_.reserve(axis1_.size() * size2_);
+  for (size_t index1 = 0; index1 < axis1_.size(); index1++) {
+    for (size_t index2 = 0; index2 < size2_; index2++)
+      values_.push_back(table->value(std::min(index1, size1 - 1),
+                                     std::min(index2, size2 - 1)));
+  }
+}
+
+void
+CompiledTable::compileAxis(const TableAxis *axis,
+                           // Return values.
+                           FloatSeq &axis_values,
+                           bool &padded)
+{
+  axis_values = axis->values();
+  padded = axis_values.size() == 1;
+  if (padded)
+    // Pad with an interval that always interpolates to the first value.
+    axis_values.push_back(axis_values[0]);
+}
+
+bool
+CompiledTable::axesEqual(const CompiledTable *table) const
+{
+  return axis1_is_slew_ == table->axis1_is_slew_
+    && axis1_ == table->axis1_
+    && axis2_ == table->axis2_;
+}
+
+// Same index as findValueIndex.
+size_t
+CompiledTable::findAxisIndex(float value,
+                             const FloatSeq &axis_values)
+{
+  size_t size = axis_values.size();
+  if (size > linear_search_max)
+    return findValueIndex(value, &axis_values);
+  else {
+    // Count the interior axis values below value.
+    size_t index = 0;
+    for (size_t i = 1; i < size - 1; i++)
+      index += value >= axis_values[i];
+    return index;
+  }
+}
+
+CompiledTable::Point
+CompiledTable::findPoint(float in_slew,
+                         float load_cap) const
+{
+  float x1 = axis1_is_slew_ ? in_slew : load_cap;
+  float x2 = axis1_is_slew_ ? load_cap : in_slew;
+  size_t index1 = findAxisIndex(x1, axis1_);
+  size_t index2 = findAxisIndex(x2, axis2_);
+  double dx1 = axisFraction(x1, index1, axis1_, axis1_padded_);
+  double dx2 = axisFraction(x2, index2, axis2_, axis2_padded_);
+  return Point{index1 * size2_ + index2, dx1, dx2};
+}
+
+// Divide by the interval like Table::findValue rather than multiply
+// by a reciprocal so the lookups round the same way.
+double
+CompiledTable::axisFraction(float value,
+                            size_t index,
+                            const FloatSeq &axis_values,
+                            bool padded)
+{
+  if (padded)
+    return 0.0;
+  double x = value;
+  double xl = axis_values[index];
+  double xu = axis_values[index + 1];
+  return (x - xl) / (xu - xl);
+}
+
+float
+CompiledTable::value(const Point &point) const
+{
+  const float *y = &values_[point.offset];
+  double y00 = y[0];
+  double y01 = y[1];
+  double y10 = y[size2_];
+  double y11 = y[size2_ + 1];
+  double dx1 = point.dx1;
+  double dx2 = point.dx2;
+  return (1 - dx1) * (1 - dx2) * y00
+    + dx1 * (1 - dx2) * y10
+    + dx1 * dx2 * y11
+    + (1 - dx1) * dx2 * y01;
+}
+
+float
+CompiledTable::findValue(float in_slew,
+                         float load_cap) const
+{
+  return value(findPoint(in_slew, load_cap));
+}
+
+void
+CompiledTable::findValues(const float *in_slews,
+                          const float *load_caps,
+                          size_t count,
+                          // Return values.
+                          float *values) const
+{
+  constexpr size_t block_size = 64;
+  std::array<Point, block_size> points;
+  for (size_t start = 0; start < count; start += block_size) {
+    size_t block_count = std::min(block_size, count - start);
+    for (size_t i = 0; i < block_count; i++)
+      points[i] = findPoint(in_slews[start + i], load_caps[start + i]);
+    for (size_t i = 0; i < block_count; i++)
+      values[start + i] = value(points[i]);
+  }
+}
+
+////////////////////////////////////////////////////////////////
+
 void
 ReceiverModel::setCapacitanceModel(TableModel table_model,
                                    size_t segment,
@@ -1830,6 +2040,51 @@ OutputWaveforms::ensureVoltageWaveforms(float vdd)
         findVoltages(wave_index, cap_axis_->axisValue(cap_index));
       }
     }
+    makeVoltageGrid();
+  }
+}
+
+void
+OutputWaveforms::makeVoltageGrid()
+{
+  size_t grid_size = voltage_grid_count_ + 1;
+  voltage_grid_.reserve(voltage_waveforms_.size() * grid_size);
+  for (const Table *voltage_waveform : voltage_waveforms_) {
+    const FloatSeq *voltages = voltage_waveform->values();
+    if (voltages->size() > UINT16_MAX
+        || !std::ranges::is_sorted(*voltages)) {
+      voltage_grid_.clear();
+      return;
+    }
+    for (size_t i = 0; i < grid_size; i++) {
+      float volt = i * vdd_ / voltage_grid_count_;
+      voltage_grid_.push_back(static_cast<uint16_t>(findValueIndex(volt, voltages)));
+    }
+  }
+}
+
+// Same index as findValueIndex.
+size_t
+OutputWaveforms::findVoltageIndex(float volt,
+                                  size_t wave_index,
+                                  const FloatSeq &voltages) const
+{
+  size_t size = voltages.size();
+  if (size <= 1 || volt <= voltages[0])
+    return 0;
+  else if (volt >= voltages[size - 1])
+    return size - 2;
+  else {
+    double grid_volt = volt * voltage_grid_count_ / vdd_;
+    size_t grid_index = std::min(static_cast<size_t>(std::max(grid_volt, 0.0)),
+                                 voltage_grid_count_);
+    size_t index = voltage_grid_[wave_index * (voltage_grid_count_ + 1) + grid_index];
+    // Rounding can put volt below the grid point.
+    while (index > 0 && voltages[index] > volt)
+      index--;
+    while (voltages[index + 1] <= volt)
+      index++;
+    return index;
   }
 }
 
@@ -1977,7 +2232,9 @@ OutputWaveforms::voltageTime2(float volt,
 {
   const Table *voltage_waveform = voltage_waveforms_[wave_index];
   const FloatSeq *voltages = voltage_waveform->values();
-  size_t index1 = findValueIndex(volt, voltages);
+  size_t index1 = voltage_grid_.empty()
+    ? findValueIndex(volt, voltages)
+    : findVoltageIndex(volt, wave_index, *voltages);
   float volt_lo = (*voltages)[index1];
   float volt_hi = (*voltages)[index1 + 1];
   float dv = volt_hi - volt_lo;
@@ -96,6 +96,8 @@ void
 TimingArcAttrs::setCond(FuncExpr *cond)
 {
   cond_ = cond;
+  if (cond_)
+    cond_->makeTruthTable();
 }
 
 void
@@ -1071,6 +1071,100 @@ TEST(Table2Test, SingleCellValue) {
   EXPECT_FLOAT_EQ(table.findValue(0.0f, 0.0f, 0.0f), 42.0f);
 }
 
+////////////////////////////////////////////////////////////////
+// CompiledTable tests
+////////////////////////////////////////////////////////////////
+
+static Table
+makeSlewCapTable(TableAxisVariable var1,
+                 size_t size1,
+                 TableAxisVariable var2,
+                 size_t size2)
+{
+  FloatSeq axis1_vals;
+  for (size_t i = 0; i < size1; i++)
+    axis1_vals.push_back(0.01f * (i + 1) * (i + 1));
+  FloatSeq axis2_vals;
+  for (size_t i = 0; i < size2; i++)
+    axis2_vals.push_back(0.002f * (i + 1) * (i + 2));
+  FloatTable values;
+  for (size_t i = 0; i < size1; i++) {
+    FloatSeq row;
+    for (size_t j = 0; j < size2; j++)
+      row.push_back(0.05f + 0.3f * i - 0.02f * j + 0.01f * i * j);
+    values.push_back(std::move(row));
+  }
+  return Table(std::move(values),
+               std::make_shared<TableAxis>(var1, std::move(axis1_vals)),
+               std::make_shared<TableAxis>(var2, std::move(axis2_vals)));
+}
+
+// Compare compiled lookups to Table::findValue including extrapolation.
+static void
+expectCompiledMatches(const Table &table,
+                      bool axis1_is_slew)
+{
+  ASSERT_TRUE(CompiledTable::compilable(&table));
+  CompiledTable compiled(&table);
+  for (float in_slew = -0.1f; in_slew < 0.8f; in_slew += 0.013f) {
+    for (float load_cap = -0.01f; load_cap < 0.2f; load_cap += 0.0031f) {
+      float value = axis1_is_slew
+        ? table.findValue(in_slew, load_cap, 0.0f)
+        : table.findValue(load_cap, in_slew, 0.0f);
+      EXPECT_FLOAT_EQ(compiled.findValue(in_slew, load_cap), value);
+    }
+  }
+}
+
+TEST(CompiledTableTest, MatchesTable) {
+  expectCompiledMatches(makeSlewCapTable(TableAxisVariable::input_net_transition, 7,
+                                         TableAxisVariable::total_output_net_capacitance, 7),
+                        true);
+  expectCompiledMatches(makeSlewCapTable(TableAxisVariable::total_output_net_capacitance, 5,
+                                         TableAxisVariable::input_transition_time, 9),
+                        false);
+  // Binary search axes.
+  expectCompiledMatches(makeSlewCapTable(TableAxisVariable::input_net_transition, 20,
+                                         TableAxisVariable::total_output_net_capacitance, 24),
+                        true);
+}
+
+TEST(CompiledTableTest, SingleValueAxes) {
+  expectCompiledMatches(makeSlewCapTable(TableAxisVariable::input_net_transition, 1,
+                                         TableAxisVariable::total_output_net_capacitance, 6),
+                        true);
+  expectCompiledMatches(makeSlewCapTable(TableAxisVariable::input_net_transition, 6,
+                                         TableAxisVariable::total_output_net_capacitance, 1),
+                        true);
+  expectCompiledMatches(makeSlewCapTable(TableAxisVariable::input_net_transition, 1,
+                                         TableAxisVariable::total_output_net_capacitance, 1),
+                        true);
+}
+
+TEST(CompiledTableTest, NotCompilable) {
+  Table table = makeSlewCapTable(TableAxisVariable::input_net_transition, 3,
+                                 TableAxisVariable::constrained_pin_transition, 3);
+  EXPECT_FALSE(CompiledTable::compilable(&table));
+  Table table0(1.0f);
+  EXPECT_FALSE(CompiledTable::compilable(&table0));
+}
+
+TEST(CompiledTableTest, FindValuesMatchesFindValue) {
+  Table table = makeSlewCapTable(TableAxisVariable::input_net_transition, 7,
+                                 TableAxisVariable::total_output_net_capacitance, 7);
+  CompiledTable compiled(&table);
+  const size_t count = 150;
+  FloatSeq in_slews, load_caps;
+  for (size_t i = 0; i < count; i++) {
+    in_slews.push_back(0.006f * i);
+    load_caps.push_back(0.0011f * ((i * 7) % count));
+  }
+  FloatSeq values(count);
+  compiled.findValues(in_slews.data(), load_caps.data(), count, values.data());
+  for (size_t i = 0; i < count; i++)
+    EXPECT_FLOAT_EQ(values[i], compiled.findValue(in_slews[i], load_caps[i]));
+}
+
 ////////////////////////////////////////////////////////////////
 // TimingType/TimingSense string conversions
 ////////////////////////////////////////////////////////////////
@@ -2098,6 +2192,58 @@ TEST(FuncExprTest, XorTimingSense) {
   delete xor_expr;
 }
 
+// (A & B) | !C
+TEST(FuncExprTest, TruthTable) {
+  ConcreteLibrary lib("test_lib", "test.lib", false);
+  ConcreteCell *cell = lib.makeCell("AOI", true, "");
+  LibertyPort *port_a = reinterpret_cast<LibertyPort*>(cell->makePort("A"));
+  LibertyPort *port_b = reinterpret_cast<LibertyPort*>(cell->makePort("B"));
+  LibertyPort *port_c = reinterpret_cast<LibertyPort*>(cell->makePort("C"));
+  FuncExpr *expr = FuncExpr::makeOr(
+    FuncExpr::makeAnd(FuncExpr::makePort(port_a), FuncExpr::makePort(port_b)),
+    FuncExpr::makeNot(FuncExpr::makePort(port_c)));
+  expr->makeTruthTable();
+  const FuncTruthTable *table = expr->truthTable();
+  ASSERT_NE(table, nullptr);
+  ASSERT_EQ(table->varCount(), 3u);
+  EXPECT_EQ(table->varIndex(port_a), 0);
+  EXPECT_EQ(table->varIndex(port_c), 2);
+  for (unsigned m = 0; m < 8; m++) {
+    bool a = m & 1, b = m & 2, c = m & 4;
+    EXPECT_EQ(((table->ones() >> m) & 1) != 0, (a && b) || !c);
+  }
+  // dF/dA = B & C
+  EXPECT_EQ(table->diff(0), 0xc0u);
+  float half[3] = {0.5f, 0.5f, 0.5f};
+  EXPECT_FLOAT_EQ(table->probability(table->ones(), half), 0.625f);
+  EXPECT_FLOAT_EQ(table->probability(table->diff(0), half), 0.25f);
+
+  uint64_t all = table->minterms();
+  EXPECT_EQ(table->sense(0, all), TimingSense::positive_unate);
+  EXPECT_EQ(table->sense(2, all), TimingSense::negative_unate);
+  // B=0 makes the function independent of A.
+  EXPECT_EQ(table->sense(0, table->cube(0x2, 0x0)), TimingSense::none);
+  // C=1 makes F = A & B.
+  uint64_t c1 = table->cube(0x4, 0x4);
+  EXPECT_EQ(table->ones() & c1, 0x80u);
+  delete expr;
+}
+
+TEST(FuncExprTest, TruthTableTooManyPorts) {
+  ConcreteLibrary lib("test_lib", "test.lib", false);
+  ConcreteCell *cell = lib.makeCell("OR7", true, "");
+  FuncExpr *expr = nullptr;
+  for (int i = 0; i < 7; i++) {
+    std::string name = "A" + std::to_string(i);
+    FuncExpr *port = FuncExpr::makePort(
+      reinterpret_cast<LibertyPort*>(cell->makePort(name)));
+    expr = expr ? FuncExpr::makeOr(expr, port) : port;
+  }
+  expr->makeTruthTable();
+  EXPECT_EQ(expr->truthTable(), nullptr);
+  delete expr;
+}
+
 TEST(FuncExprTest, ZeroOneExpressions) {
   FuncExpr *zero = FuncExpr::makeZero();
   FuncExpr *one = FuncExpr::makeOne();
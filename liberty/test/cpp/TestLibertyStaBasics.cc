@@ -996,6 +996,41 @@ TEST_F(StaLibertyTest, GateTableModelDriveResistanceAndDelay) {
     EXPECT_FALSE(std::isinf(delay_f));
     EXPECT_GE(slew_f, 0.0f);
 
+    // Batched lookups match the uncompiled table lookups.
+    auto tableValue = [buf] (const TableModel *model,
+                             float in_slew,
+                             float load_cap) {
+      const Table *table = model->table().get();
+      TableAxisVariable var1 = table->axis1()->variable();
+      bool slew_first = var1 == TableAxisVariable::input_net_transition
+        || var1 == TableAxisVariable::input_transition_time;
+      float value = slew_first
+        ? table->findValue(in_slew, load_cap, 0.0f)
+        : table->findValue(load_cap, in_slew, 0.0f);
+      return value * model->scaleFactor(buf, nullptr);
+    };
+    const TableModel *table_delay_model = gtm->delayModel();
+    const TableModel *table_slew_model = gtm->slewModel();
+    ASSERT_NE(table_delay_model, nullptr);
+    ASSERT_NE(table_slew_model, nullptr);
+    ASSERT_EQ(table_delay_model->table()->order(), 2);
+    const size_t count = 5;
+    float in_slews[count] = {0.0f, 0.02f, 0.1f, 0.3f, 2.0f};
+    float load_caps[count] = {0.0f, 0.005f, 0.01f, 0.05f, 1.0f};
+    float delays[count], slews[count];
+    gtm->gateDelays(nullptr, in_slews, load_caps, count, delays, slews);
+    for (size_t i = 0; i < count; i++) {
+      EXPECT_FLOAT_EQ(delays[i],
+                      tableValue(table_delay_model, in_slews[i],
+                                 load_caps[i]));
+      EXPECT_FLOAT_EQ(slews[i],
+                      std::max(tableValue(table_slew_model, in_slews[i],
+                                          load_caps[i]), 0.0f));
+      gtm->gateDelay(nullptr, in_slews[i], load_caps[i], delay_f, slew_f);
+      EXPECT_FLOAT_EQ(delays[i], delay_f);
+      EXPECT_FLOAT_EQ(slews[i], slew_f);
+    }
+
     // Test drive resistance
     float res = gtm->driveResistance(nullptr);
     EXPECT_GE(res, 0.0f);
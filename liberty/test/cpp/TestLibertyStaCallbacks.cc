@@ -3509,6 +3509,51 @@ TEST_F(StaLibertyTest, TimingGroupOutputWaveforms) {
   EXPECT_TRUE(found_gate_table_model);
 }
 
+// CCS voltage waveforms are made when the library is read.
+TEST_F(StaLibertyTest, OutputWaveformsVoltageTime) {
+  LibertyLibrary *ccs_lib = sta_->readLiberty("test/asap7_ccsn.lib.gz",
+                                              sta_->cmdScene(),
+                                              MinMaxAll::min(), false);
+  ASSERT_NE(ccs_lib, nullptr);
+  LibertyCell *cell = ccs_lib->findLibertyCell("A2O1A1Ixp33_ASAP7_75t_L");
+  ASSERT_NE(cell, nullptr);
+  OutputWaveforms *waveforms = nullptr;
+  for (TimingArcSet *arc_set : cell->timingArcSets()) {
+    for (TimingArc *arc : arc_set->arcs()) {
+      GateTableModel *model = arc->gateTableModel();
+      if (model && model->outputWaveforms() && waveforms == nullptr)
+        waveforms = model->outputWaveforms();
+    }
+  }
+  ASSERT_NE(waveforms, nullptr);
+  float slew = waveforms->slewAxis()->axisValue(0);
+  float cap = waveforms->capAxis()->axisValue(0);
+  const Table *waveform = waveforms->voltageWaveformRaw(slew, cap);
+  ASSERT_NE(waveform, nullptr);
+
+  // At table axis points voltageTime interpolates the voltage waveform.
+  const FloatSeq *volts = waveform->values();
+  const TableAxis *time_axis = waveform->axis1();
+  size_t size = volts->size();
+  ASSERT_GT(size, 2u);
+  float vdd = (*volts)[size - 1];
+  float prev_time = -INF;
+  for (int step = 1; step < 40; step++) {
+    float volt = step * vdd / 40;
+    size_t index = 0;
+    while (index + 2 < size && (*volts)[index + 1] <= volt)
+      index++;
+    float v1 = (*volts)[index];
+    float v2 = (*volts)[index + 1];
+    float t1 = time_axis->axisValue(index);
+    float t2 = time_axis->axisValue(index + 1);
+    float time = waveforms->voltageTime(slew, cap, volt);
+    EXPECT_FLOAT_EQ(time, t1 + (t2 - t1) * (volt - v1) / (v2 - v1));
+    EXPECT_GE(time, prev_time);
+    prev_time = time;
+  }
+}
+
 // =========================================================================
 // R11_ tests: Cover additional uncovered functions in liberty module
 // =========================================================================
@@ -54,5 +54,19 @@ proc_redirect link_design {
   link_design_cmd $top_cell_name $make_black_boxes
 }
 
+define_cmd_args "write_netlist_snapshot" {filename}
+
+proc_redirect write_netlist_snapshot {
+  check_argc_eq1 "write_netlist_snapshot" $args
+  write_netlist_snapshot_cmd [file nativename [lindex $args 0]]
+}
+
+define_cmd_args "read_netlist_snapshot" {filename}
+
+proc_redirect read_netlist_snapshot {
+  check_argc_eq1 "read_netlist_snapshot" $args
+  read_netlist_snapshot_cmd [file nativename [lindex $args 0]]
+}
+
 # sta namespace end
 }
@@ -274,6 +274,18 @@ link_design_cmd(const char *top_cell_name,
   return Sta::sta()->linkDesign(top_cell_name, make_black_boxes);
 }
 
+void
+write_netlist_snapshot_cmd(const char *filename)
+{
+  Sta::sta()->writeNetlistSnapshot(filename);
+}
+
+bool
+read_netlist_snapshot_cmd(const char *filename)
+{
+  return Sta::sta()->readNetlistSnapshot(filename);
+}
+
 Instance *
 top_instance()
 {
@@ -0,0 +1,709 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+
+#include "NetworkSnapshot.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <deque>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ConcreteNetwork.hh"
+#include "Debug.hh"
+#include "Error.hh"
+#include "Network.hh"
+#include "PortDirection.hh"
+#include "Report.hh"
+#include "Stats.hh"
+
+namespace sta {
+
+// File layout (native byte order):
+//  magic, version
+//  library count, library names
+//  cell count
+//    library index, cell name, is liberty
+//    netlist cells: is leaf, filename, attributes, port count
+//      port name, direction name, port kind, from/to index | bundle members
+//  instances in depth first order starting with the top instance
+//    cell index, instance name, attributes
+//    net count, (net name, constant value)...
+//    child count, children...
+//  pins of each instance in the same order
+//    pin count, (port bit index, net index, term net index)...
+//  merged net count, (net index, into net index)...
+// Names are string table indices. The first reference to a name is
+// followed by its length and characters so the file is written in one
+// pass. Nets are numbered in the order they are written.
+static constexpr char snapshot_magic[8] = {'S','T','A','N','E','T','S','\0'};
+static constexpr uint32_t snapshot_version = 2;
+static constexpr uint32_t snapshot_no_net = UINT32_MAX;
+static constexpr uint32_t snapshot_no_term = UINT32_MAX - 1;
+
+enum class SnapshotPort : uint8_t { scalar, bus, bundle };
+
+class NetlistSnapshotWriter
+{
+public:
+  NetlistSnapshotWriter(std::string_view filename,
+                        ConcreteNetwork *network);
+  void write();
+
+private:
+  void findCells(const Instance *inst);
+  void writeCells();
+  void writeCell(const Cell *cell);
+  void writeInstance(const Instance *inst);
+  void writeInstancePins(const Instance *inst);
+  void writeMergedNets();
+  void writeAttributes(const AttributeMap &attrs);
+  uint32_t netIndex(const Net *net) const;
+  template <class VALUE>
+  void writeValue(VALUE value);
+  void writeString(std::string_view str);
+
+  std::string filename_;
+  ConcreteNetwork *network_;
+  std::ofstream stream_;
+  std::unordered_map<std::string, uint32_t> string_index_;
+  std::vector<const Cell*> cells_;
+  std::map<const Cell*, uint32_t> cell_index_;
+  std::vector<std::unordered_map<const Port*, uint32_t>> cell_port_bits_;
+  std::unordered_map<const ConcreteNet*, uint32_t> net_index_;
+  std::vector<std::pair<const ConcreteNet*, const ConcreteNet*>> merged_nets_;
+  size_t instance_count_{0};
+};
+
+class NetlistSnapshotReader
+{
+public:
+  NetlistSnapshotReader(std::string_view filename,
+                        ConcreteNetwork *network);
+  bool read();
+
+private:
+  void readHeader();
+  void readCells();
+  Cell *readCell();
+  Cell *readNetlistCell(Library *library,
+                        const std::string &cell_name);
+  void checkCellPorts(Cell *cell);
+  Instance *readInstance(Instance *parent);
+  void readInstancePins(size_t inst_index);
+  void readMergedNets();
+  void deleteInstances();
+  Net *readNet();
+  template <class VALUE>
+  VALUE readValue();
+  const std::string &readString();
+  [[noreturn]] void formatError();
+
+  std::string filename_;
+  ConcreteNetwork *network_;
+  Report *report_;
+  std::ifstream stream_;
+  // Deque so readString references stay valid as strings are added.
+  std::deque<std::string> strings_;
+  std::vector<Library*> libraries_;
+  std::vector<Cell*> cells_;
+  std::vector<std::vector<Port*>> cell_port_bits_;
+  std::vector<Instance*> instances_;
+  std::vector<uint32_t> instance_cells_;
+  std::vector<Net*> nets_;
+};
+
+////////////////////////////////////////////////////////////////
+
+void
+writeNetlistSnapshot(std::string_view filename,
+                     ConcreteNetwork *network)
+{
+  NetlistSnapshotWriter writer(filename, network);
+  writer.write();
+}
+
+NetlistSnapshotWriter::NetlistSnapshotWriter(std::string_view filename,
+                                             ConcreteNetwork *network) :
+  filename_(filename),
+  network_(network)
+{
+}
+
+void
+NetlistSnapshotWriter::write()
+{
+  Stats stats(network_->debug(), network_->report());
+  stream_.open(filename_, std::ios::binary);
+  if (!stream_.is_open())
+    throw FileNotWritable(filename_);
+
+  stream_.write(snapshot_magic, sizeof(snapshot_magic));
+  writeValue(snapshot_version);
+  Instance *top_inst = network_->topInstance();
+  findCells(top_inst);
+  writeCells();
+  writeInstance(top_inst);
+  writeInstancePins(top_inst);
+  writeMergedNets();
+  stream_.close();
+  if (stream_.fail())
+    throw FileNotWritable(filename_);
+  debugPrint(network_->debug(), "netlist_snapshot", 1,
+             "wrote {} instances {} nets to {}",
+             instance_count_, net_index_.size(), filename_);
+  stats.report("Write netlist snapshot");
+}
+
+// Find the cells and number the nets in the order they are written.
+void
+NetlistSnapshotWriter::findCells(const Instance *inst)
+{
+  const Cell *cell = network_->cell(inst);
+  if (!cell_index_.contains(cell)) {
+    cell_index_[cell] = cells_.size();
+    cells_.push_back(cell);
+    std::unordered_map<const Port*, uint32_t> &port_bits =
+      cell_port_bits_.emplace_back();
+    CellPortBitIterator *port_iter = network_->portBitIterator(cell);
+    while (port_iter->hasNext()) {
+      const Port *port = port_iter->next();
+      port_bits[port] = port_bits.size();
+    }
+    delete port_iter;
+  }
+  const ConcreteInstance *cinst = reinterpret_cast<const ConcreteInstance*>(inst);
+  if (cinst->nets_) {
+    for (const auto &[net_name, net] : *cinst->nets_) {
+      uint32_t net_index = net_index_.size();
+      net_index_[net] = net_index;
+    }
+  }
+  InstanceChildIterator *child_iter = network_->childIterator(inst);
+  while (child_iter->hasNext())
+    findCells(child_iter->next());
+  delete child_iter;
+}
+
+void
+NetlistSnapshotWriter::writeCells()
+{
+  std::vector<const Library*> libraries;
+  std::map<const Library*, uint32_t> library_index;
+  for (const Cell *cell : cells_) {
+    const Library *library = network_->library(cell);
+    if (!library_index.contains(library)) {
+      library_index[library] = libraries.size();
+      libraries.push_back(library);
+    }
+  }
+  writeValue<uint32_t>(libraries.size());
+  for (const Library *library : libraries)
+    writeString(network_->name(library));
+
+  writeValue<uint32_t>(cells_.size());
+  for (const Cell *cell : cells_) {
+    writeValue<uint32_t>(library_index[network_->library(cell)]);
+    writeCell(cell);
+  }
+}
+
+void
+NetlistSnapshotWriter::writeCell(const Cell *cell)
+{
+  writeString(network_->name(cell));
+  bool is_liberty = network_->libertyCell(cell) != nullptr;
+  writeValue<uint8_t>(is_liberty);
+  if (!is_liberty) {
+    writeValue<uint8_t>(network_->isLeaf(cell));
+    writeString(network_->filename(cell));
+    writeAttributes(network_->attributeMap(cell));
+    std::vector<const Port*> ports;
+    CellPortIterator *port_iter = network_->portIterator(cell);
+    while (port_iter->hasNext())
+      ports.push_back(port_iter->next());
+    delete port_iter;
+
+    writeValue<uint32_t>(ports.size());
+    for (const Port *port : ports) {
+      writeString(network_->name(port));
+      writeString(network_->direction(port)->name());
+      if (network_->isBus(port)) {
+        writeValue(SnapshotPort::bus);
+        writeValue<int32_t>(network_->fromIndex(port));
+        writeValue<int32_t>(network_->toIndex(port));
+      }
+      else if (network_->isBundle(port)) {
+        writeValue(SnapshotPort::bundle);
+        writeValue<uint32_t>(network_->size(port));
+        PortMemberIterator *member_iter = network_->memberIterator(port);
+        while (member_iter->hasNext())
+          writeString(network_->name(member_iter->next()));
+        delete member_iter;
+      }
+      else
+        writeValue(SnapshotPort::scalar);
+    }
+  }
+}
+
+void
+NetlistSnapshotWriter::writeInstance(const Instance *inst)
+{
+  writeValue<uint32_t>(cell_index_[network_->cell(inst)]);
+  writeString(network_->name(inst));
+  writeAttributes(network_->attributeMap(inst));
+
+  const ConcreteInstance *cinst = reinterpret_cast<const ConcreteInstance*>(inst);
+  if (cinst->nets_) {
+    writeValue<uint32_t>(cinst->nets_->size());
+    for (const auto &[net_name, cnet] : *cinst->nets_) {
+      const Net *net = reinterpret_cast<const Net*>(cnet);
+      writeString(cnet->name());
+      LogicValue value = LogicValue::unknown;
+      if (network_->constant_nets_[static_cast<int>(LogicValue::zero)].contains(net))
+        value = LogicValue::zero;
+      else if (network_->constant_nets_[static_cast<int>(LogicValue::one)].contains(net))
+        value = LogicValue::one;
+      writeValue(value);
+      ConcreteNet *into_net = cnet->mergedInto();
+      if (into_net)
+        merged_nets_.emplace_back(cnet, into_net);
+    }
+  }
+  else
+    writeValue<uint32_t>(0);
+  instance_count_++;
+
+  InstanceSeq children;
+  InstanceChildIterator *child_iter = network_->childIterator(inst);
+  while (child_iter->hasNext())
+    children.push_back(child_iter->next());
+  delete child_iter;
+  writeValue<uint32_t>(children.size());
+  for (const Instance *child : children)
+    writeInstance(child);
+}
+
+void
+NetlistSnapshotWriter::writeInstancePins(const Instance *inst)
+{
+  const std::unordered_map<const Port*, uint32_t> &port_bits =
+    cell_port_bits_[cell_index_[network_->cell(inst)]];
+  PinSeq pins;
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext())
+    pins.push_back(pin_iter->next());
+  delete pin_iter;
+
+  writeValue<uint32_t>(pins.size());
+  for (const Pin *pin : pins) {
+    writeValue<uint32_t>(port_bits.at(network_->port(pin)));
+    writeValue<uint32_t>(netIndex(network_->net(pin)));
+    Term *term = network_->term(pin);
+    writeValue<uint32_t>(term ? netIndex(network_->net(term)) : snapshot_no_term);
+  }
+
+  InstanceChildIterator *child_iter = network_->childIterator(inst);
+  while (child_iter->hasNext())
+    writeInstancePins(child_iter->next());
+  delete child_iter;
+}
+
+void
+NetlistSnapshotWriter::writeMergedNets()
+{
+  writeValue<uint32_t>(merged_nets_.size());
+  for (const auto &[net, into_net] : merged_nets_) {
+    writeValue<uint32_t>(net_index_.at(net));
+    writeValue<uint32_t>(net_index_.at(into_net));
+  }
+}
+
+void
+NetlistSnapshotWriter::writeAttributes(const AttributeMap &attrs)
+{
+  writeValue<uint32_t>(attrs.size());
+  for (const auto &[key, value] : attrs) {
+    writeString(key);
+    writeString(value);
+  }
+}
+
+uint32_t
+NetlistSnapshotWriter::netIndex(const Net *net) const
+{
+  if (net)
+    return net_index_.at(reinterpret_cast<const ConcreteNet*>(net));
+  else
+    return snapshot_no_net;
+}
+
+template <class VALUE>
+void
+NetlistSnapshotWriter::writeValue(VALUE value)
+{
+  stream_.write(reinterpret_cast<const char*>(&value), sizeof(VALUE));
+}
+
+void
+NetlistSnapshotWriter::writeString(std::string_view str)
+{
+  auto [itr, inserted] = string_index_.try_emplace(std::string(str),
+                                                   string_index_.size());
+  writeValue<uint32_t>(itr->second);
+  if (inserted) {
+    writeValue<uint32_t>(str.size());
+    stream_.write(str.data(), str.size());
+  }
+}
+
+////////////////////////////////////////////////////////////////
+
+bool
+readNetlistSnapshot(std::string_view filename,
+                    ConcreteNetwork *network)
+{
+  NetlistSnapshotReader reader(filename, network);
+  return reader.read();
+}
+
+NetlistSnapshotReader::NetlistSnapshotReader(std::string_view filename,
+                                             ConcreteNetwork *network) :
+  filename_(filename),
+  network_(network),
+  report_(network->report())
+{
+}
+
+bool
+NetlistSnapshotReader::read()
+{
+  Stats stats(network_->debug(), report_);
+  stream_.open(filename_, std::ios::binary);
+  if (!stream_.is_open())
+    throw FileNotReadable(filename_);
+  stream_.exceptions(std::ios::failbit | std::ios::badbit);
+  try {
+    readHeader();
+    readCells();
+    readInstance(nullptr);
+    for (size_t i = 0; i < instances_.size(); i++)
+      readInstancePins(i);
+    readMergedNets();
+  }
+  catch (const std::ios::failure &) {
+    deleteInstances();
+    formatError();
+  }
+  catch (...) {
+    deleteInstances();
+    throw;
+  }
+  network_->setTopInstance(instances_[0]);
+  network_->checkNetworkLibertyScenes();
+  debugPrint(network_->debug(), "netlist_snapshot", 1,
+             "read {} instances {} nets from {}",
+             instances_.size(), nets_.size(), filename_);
+  stats.report("Read netlist snapshot");
+  return true;
+}
+
+void
+NetlistSnapshotReader::readHeader()
+{
+  char magic[sizeof(snapshot_magic)];
+  stream_.read(magic, sizeof(magic));
+  if (!std::equal(magic, magic + sizeof(magic), snapshot_magic)
+      || readValue<uint32_t>() != snapshot_version)
+    formatError();
+}
+
+void
+NetlistSnapshotReader::readCells()
+{
+  uint32_t library_count = readValue<uint32_t>();
+  for (uint32_t i = 0; i < library_count; i++) {
+    const std::string &library_name = readString();
+    Library *library = network_->findLibrary(library_name);
+    if (library == nullptr)
+      // Libraries of netlist cells such as verilog modules.
+      library = network_->makeLibrary(library_name, "");
+    libraries_.push_back(library);
+  }
+
+  uint32_t cell_count = readValue<uint32_t>();
+  for (uint32_t i = 0; i < cell_count; i++) {
+    Cell *cell = readCell();
+    cells_.push_back(cell);
+    std::vector<Port*> &port_bits = cell_port_bits_.emplace_back();
+    CellPortBitIterator *port_iter = network_->portBitIterator(cell);
+    while (port_iter->hasNext())
+      port_bits.push_back(port_iter->next());
+    delete port_iter;
+  }
+}
+
+Cell *
+NetlistSnapshotReader::readCell()
+{
+  uint32_t library_index = readValue<uint32_t>();
+  if (library_index >= libraries_.size())
+    formatError();
+  Library *library = libraries_[library_index];
+  const std::string &cell_name = readString();
+  bool is_liberty = readValue<uint8_t>();
+  if (is_liberty) {
+    Cell *cell = network_->findCell(library, cell_name);
+    if (cell == nullptr || network_->libertyCell(cell) == nullptr)
+      report_->error(2124, "netlist snapshot {} liberty cell {}/{} not found.",
+                     filename_, network_->name(library), cell_name);
+    return cell;
+  }
+  else
+    return readNetlistCell(library, cell_name);
+}
+
+Cell *
+NetlistSnapshotReader::readNetlistCell(Library *library,
+                                       const std::string &cell_name)
+{
+  bool is_leaf = readValue<uint8_t>();
+  const std::string &filename = readString();
+  Cell *cell = network_->findCell(library, cell_name);
+  if (cell) {
+    // Cell from a prior read of the netlist.
+    uint32_t attr_count = readValue<uint32_t>();
+    for (uint32_t i = 0; i < attr_count * 2; i++)
+      readString();
+    checkCellPorts(cell);
+  }
+  else {
+    cell = network_->makeCell(library, cell_name, is_leaf, filename);
+    uint32_t attr_count = readValue<uint32_t>();
+    for (uint32_t i = 0; i < attr_count; i++) {
+      const std::string &key = readString();
+      const std::string &value = readString();
+      network_->setAttribute(cell, key, value);
+    }
+    uint32_t port_count = readValue<uint32_t>();
+    for (uint32_t i = 0; i < port_count; i++) {
+      const std::string &port_name = readString();
+      PortDirection *dir = PortDirection::find(readString().c_str());
+      Port *port = nullptr;
+      switch (readValue<SnapshotPort>()) {
+      case SnapshotPort::scalar:
+        port = network_->makePort(cell, port_name);
+        break;
+      case SnapshotPort::bus: {
+        int from_index = readValue<int32_t>();
+        int to_index = readValue<int32_t>();
+        port = network_->makeBusPort(cell, port_name, from_index, to_index);
+        break;
+      }
+      case SnapshotPort::bundle: {
+        uint32_t member_count = readValue<uint32_t>();
+        PortSeq *members = new PortSeq;
+        for (uint32_t j = 0; j < member_count; j++) {
+          Port *member = network_->findPort(cell, readString());
+          if (member == nullptr)
+            formatError();
+          members->push_back(member);
+        }
+        port = network_->makeBundlePort(cell, port_name, members);
+        break;
+      }
+      default:
+        formatError();
+      }
+      if (dir)
+        network_->setDirection(port, dir);
+    }
+  }
+  return cell;
+}
+
+// The existing cell must have the same ports in the same order for
+// the snapshot port bit indices to be valid.
+void
+NetlistSnapshotReader::checkCellPorts(Cell *cell)
+{
+  std::vector<Port*> ports;
+  CellPortIterator *port_iter = network_->portIterator(cell);
+  while (port_iter->hasNext())
+    ports.push_back(port_iter->next());
+  delete port_iter;
+
+  uint32_t port_count = readValue<uint32_t>();
+  bool match = port_count == ports.size();
+  for (uint32_t i = 0; i < port_count; i++) {
+    const std::string &port_name = readString();
+    readString();
+    SnapshotPort port_kind = readValue<SnapshotPort>();
+    if (port_kind == SnapshotPort::bus) {
+      readValue<int32_t>();
+      readValue<int32_t>();
+    }
+    else if (port_kind == SnapshotPort::bundle) {
+      uint32_t member_count = readValue<uint32_t>();
+      for (uint32_t j = 0; j < member_count; j++)
+        readString();
+    }
+    match &= i < ports.size() && network_->name(ports[i]) == port_name;
+  }
+  if (!match)
+    report_->error(2125, "netlist snapshot {} cell {} does not match the existing cell.",
+                   filename_, network_->name(cell));
+}
+
+Instance *
+NetlistSnapshotReader::readInstance(Instance *parent)
+{
+  uint32_t cell_index = readValue<uint32_t>();
+  if (cell_index >= cells_.size())
+    formatError();
+  const std::string &inst_name = readString();
+  Instance *inst = network_->makeInstance(cells_[cell_index], inst_name, parent);
+  instances_.push_back(inst);
+  instance_cells_.push_back(cell_index);
+  uint32_t attr_count = readValue<uint32_t>();
+  for (uint32_t i = 0; i < attr_count; i++) {
+    const std::string &key = readString();
+    const std::string &value = readString();
+    network_->setAttribute(inst, key, value);
+  }
+
+  uint32_t net_count = readValue<uint32_t>();
+  for (uint32_t i = 0; i < net_count; i++) {
+    const std::string &net_name = readString();
+    LogicValue value = readValue<LogicValue>();
+    Net *net = network_->makeNet(net_name, inst);
+    network_->addConstantNet(net, value);
+    nets_.push_back(net);
+  }
+
+  uint32_t child_count = readValue<uint32_t>();
+  for (uint32_t i = 0; i < child_count; i++)
+    readInstance(inst);
+  return inst;
+}
+
+void
+NetlistSnapshotReader::readInstancePins(size_t inst_index)
+{
+  Instance *inst = instances_[inst_index];
+  const std::vector<Port*> &port_bits =
+    cell_port_bits_[instance_cells_[inst_index]];
+  uint32_t pin_count = readValue<uint32_t>();
+  for (uint32_t i = 0; i < pin_count; i++) {
+    uint32_t port_index = readValue<uint32_t>();
+    if (port_index >= port_bits.size())
+      formatError();
+    Net *net = readNet();
+    Pin *pin = network_->makePin(inst, port_bits[port_index], net);
+    uint32_t term_index = readValue<uint32_t>();
+    if (term_index != snapshot_no_term) {
+      Net *term_net = nullptr;
+      if (term_index != snapshot_no_net) {
+        if (term_index >= nets_.size())
+          formatError();
+        term_net = nets_[term_index];
+      }
+      network_->makeTerm(pin, term_net);
+    }
+  }
+}
+
+void
+NetlistSnapshotReader::readMergedNets()
+{
+  uint32_t merged_count = readValue<uint32_t>();
+  for (uint32_t i = 0; i < merged_count; i++) {
+    Net *net = readNet();
+    Net *into_net = readNet();
+    if (net == nullptr || into_net == nullptr)
+      formatError();
+    network_->mergeInto(net, into_net);
+  }
+}
+
+void
+NetlistSnapshotReader::deleteInstances()
+{
+  if (!instances_.empty()) {
+    network_->clearConstantNets();
+    network_->deleteInstance(instances_[0]);
+    instances_.clear();
+  }
+}
+
+Net *
+NetlistSnapshotReader::readNet()
+{
+  uint32_t net_index = readValue<uint32_t>();
+  if (net_index == snapshot_no_net)
+    return nullptr;
+  if (net_index >= nets_.size())
+    formatError();
+  return nets_[net_index];
+}
+
+template <class VALUE>
+VALUE
+NetlistSnapshotReader::readValue()
+{
+  VALUE value;
+  stream_.read(reinterpret_cast<char*>(&value), sizeof(VALUE));
+  return value;
+}
+
+const std::string &
+NetlistSnapshotReader::readString()
+{
+  uint32_t index = readValue<uint32_t>();
+  if (index == strings_.size()) {
+    // First reference to the string.
+    uint32_t length = readValue<uint32_t>();
+    std::string &str = strings_.emplace_back(length, '\0');
+    stream_.read(str.data(), length);
+    return str;
+  }
+  if (index > strings_.size())
+    formatError();
+  return strings_[index];
+}
+
+void
+NetlistSnapshotReader::formatError()
+{
+  report_->error(2126, "{} is not a netlist snapshot or is truncated.",
+                 filename_);
+}
+
+} // namespace sta
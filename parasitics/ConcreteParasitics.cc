@@ -492,51 +492,74 @@ ConcreteParasiticNetwork::ConcreteParasiticNetwork(ConcreteParasiticNetwork &&pa
   net_(parasitic.net_),
   sub_nodes_(std::move(parasitic.sub_nodes_)),
   pin_nodes_(std::move(parasitic.pin_nodes_)),
+  node_pool_(std::move(parasitic.node_pool_)),
+  resistor_pool_(std::move(parasitic.resistor_pool_)),
+  capacitor_pool_(std::move(parasitic.capacitor_pool_)),
   max_node_id_(parasitic.max_node_id_),
   includes_pin_caps_(parasitic.includes_pin_caps_)
 {
 }
 
-ConcreteParasiticNetwork::~ConcreteParasiticNetwork()
+// The pools destroy the nodes and devices.
+ConcreteParasiticNetwork::~ConcreteParasiticNetwork() = default;
+
+ConcreteParasiticNode *
+ConcreteParasiticNetwork::makeNode(const Net *net,
+                                   uint32_t id,
+                                   bool is_external)
 {
-  deleteDevices();
-  deleteNodes();
+  uint32_t index = node_pool_.size();
+  ConcreteParasiticNode *node = node_pool_.make(net, id, is_external);
+  node->index_ = index;
+  return node;
 }
 
-void
-ConcreteParasiticNetwork::deleteNodes()
+ConcreteParasiticNode *
+ConcreteParasiticNetwork::makeNode(const Pin *pin,
+                                   bool is_external)
 {
-  for (const auto& [id, node] : sub_nodes_)
-    delete node;
-  for (const auto& [pin, node] : pin_nodes_)
-    delete node;
+  uint32_t index = node_pool_.size();
+  ConcreteParasiticNode *node = node_pool_.make(pin, is_external);
+  node->index_ = index;
+  return node;
 }
 
-void
-ConcreteParasiticNetwork::deleteDevices()
+ConcreteParasiticResistor *
+ConcreteParasiticNetwork::makeResistor(uint32_t id,
+                                       float value,
+                                       ConcreteParasiticNode *node1,
+                                       ConcreteParasiticNode *node2)
 {
-  for (ParasiticResistor *resistor : resistors_) {
-    ConcreteParasiticResistor *cresistor =
-      reinterpret_cast<ConcreteParasiticResistor*>(resistor);
-    delete cresistor;
-  }
-  for (ParasiticCapacitor *capacitor : capacitors_) {
-    ConcreteParasiticCapacitor *ccapacitor =
-      reinterpret_cast<ConcreteParasiticCapacitor*>(capacitor);
-    delete ccapacitor;
-  }
+  return resistor_pool_.make(id, value, node1, node2);
 }
 
-void
-ConcreteParasiticNetwork::addResistor(ParasiticResistor *resistor)
+ConcreteParasiticCapacitor *
+ConcreteParasiticNetwork::makeCapacitor(uint32_t id,
+                                        float value,
+                                        ConcreteParasiticNode *node1,
+                                        ConcreteParasiticNode *node2)
 {
-  resistors_.push_back(resistor);
+  return capacitor_pool_.make(id, value, node1, node2);
 }
 
-void
-ConcreteParasiticNetwork::addCapacitor(ParasiticCapacitor *capacitor)
+ParasiticResistorSeq
+ConcreteParasiticNetwork::resistors() const
+{
+  ParasiticResistorSeq resistors;
+  resistors.reserve(resistor_pool_.size());
+  for (uint32_t i = 0; i < resistor_pool_.size(); i++)
+    resistors.push_back(resistor_pool_[i]);
+  return resistors;
+}
+
+ParasiticCapacitorSeq
+ConcreteParasiticNetwork::capacitors() const
 {
-  capacitors_.push_back(capacitor);
+  ParasiticCapacitorSeq capacitors;
+  capacitors.reserve(capacitor_pool_.size());
+  for (uint32_t i = 0; i < capacitor_pool_.size(); i++)
+    capacitors.push_back(capacitor_pool_[i]);
+  return capacitors;
 }
 
 ParasiticNodeSeq
@@ -564,11 +587,8 @@ ConcreteParasiticNetwork::capacitance() const
       cap += node->capacitance();
   }
 
-  for (ParasiticCapacitor *capacitor : capacitors_) {
-    ConcreteParasiticCapacitor *ccap =
-      static_cast<ConcreteParasiticCapacitor*>(capacitor);
-    cap += ccap->value();
-  }
+  for (uint32_t i = 0; i < capacitor_pool_.size(); i++)
+    cap += capacitor_pool_[i]->value();
 
   return cap;
 }
@@ -606,7 +626,7 @@ ConcreteParasiticNetwork::ensureParasiticNode(const Net *net,
   auto id_node = sub_nodes_.find(net_id);
   if (id_node == sub_nodes_.end()) {
     Net *net1 = network->highestNetAbove(const_cast<Net*>(net));
-    node = new ConcreteParasiticNode(net, id, network->highestNetAbove(net1) != net_);
+    node = makeNode(net, id, network->highestNetAbove(net1) != net_);
     sub_nodes_[net_id] = node;
     if (net == net_)
       max_node_id_ = std::max(max_node_id_, id);
@@ -633,7 +653,7 @@ ConcreteParasiticNetwork::ensureParasiticNode(const Pin *pin,
     }
     else if (net)
       net = network->highestNetAbove(net);
-    node = new ConcreteParasiticNode(pin, net != net_);
+    node = makeNode(pin, net != net_);
     pin_nodes_[pin] = node;
   }
   else
@@ -648,12 +668,11 @@ ConcreteParasiticNetwork::unannotatedLoads(const Pin *drvr_pin,
   PinSet loads = parasitics->loads(drvr_pin);
   ParasiticNode *drvr_node = findParasiticNode(drvr_pin);
   if (drvr_node) {
-    ParasiticNodeResistorMap resistor_map =
-      parasitics->parasiticNodeResistorMap(this);
-    ParasiticNodeSet visited_nodes;
+    ParasiticResistorAdjacency adjacency(this, parasitics);
+    std::vector<bool> visited_nodes(nodeCount());
     ParasiticResistorSet loop_resistors;
     unannotatedLoads(drvr_node, nullptr, loads, visited_nodes,
-                     loop_resistors, resistor_map, parasitics);
+                     loop_resistors, adjacency, parasitics);
   }
   return loads;
 }
@@ -662,33 +681,33 @@ void
 ConcreteParasiticNetwork::unannotatedLoads(ParasiticNode *node,
                                            ParasiticResistor *from_res,
                                            PinSet &loads,
-                                           ParasiticNodeSet &visited_nodes,
+                                           std::vector<bool> &visited_nodes,
                                            ParasiticResistorSet &loop_resistors,
-                                           ParasiticNodeResistorMap &resistor_map,
+                                           const ParasiticResistorAdjacency &adjacency,
                                            const Parasitics *parasitics) const
 {
   const Pin *pin = parasitics->pin(node);
   if (pin)
     loads.erase(const_cast<Pin*>(pin));
 
-  visited_nodes.insert(node);
-  ParasiticResistorSeq &resistors = resistor_map[node];
-  for (ParasiticResistor *resistor : resistors) {
+  uint32_t node_index = parasitics->nodeIndex(node);
+  visited_nodes[node_index] = true;
+  for (ParasiticResistor *resistor : adjacency.devices(node)) {
     if (!loop_resistors.contains(resistor)) {
       ParasiticNode *onode = parasitics->otherNode(resistor, node);
       // One commercial extractor creates resistors with identical from/to nodes.
       if (onode != node
           && resistor != from_res) {
-        if (!visited_nodes.contains(onode))
+        if (!visited_nodes[parasitics->nodeIndex(onode)])
           unannotatedLoads(onode, resistor, loads, visited_nodes,
-                           loop_resistors, resistor_map, parasitics);
+                           loop_resistors, adjacency, parasitics);
         else
           // resistor loop
           loop_resistors.insert(resistor);
       }
     }
   }
-  visited_nodes.erase(node);
+  visited_nodes[node_index] = false;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -705,19 +724,13 @@ ConcreteParasiticNetwork::disconnectPin(const Pin *pin,
     ConcreteParasiticNode *subnode = ensureParasiticNode(net,max_node_id_+1,
                                                          network);
     // Hand over the devices.
-    for (ParasiticResistor *resistor : resistors_) {
-      ConcreteParasiticResistor *cresistor =
-        reinterpret_cast<ConcreteParasiticResistor*>(resistor);
-      cresistor->replaceNode(node, subnode);
-    }
-    for (ParasiticCapacitor *capacitor : capacitors_) {
-      ConcreteParasiticCapacitor *ccapacitor =
-        reinterpret_cast<ConcreteParasiticCapacitor*>(capacitor);
-      ccapacitor->replaceNode(node, subnode);
-    }
+    for (uint32_t i = 0; i < resistor_pool_.size(); i++)
+      resistor_pool_[i]->replaceNode(node, subnode);
+    for (uint32_t i = 0; i < capacitor_pool_.size(); i++)
+      capacitor_pool_[i]->replaceNode(node, subnode);
 
+    // The node stays in the pool until the network is deleted.
     pin_nodes_.erase(pin_node);
-    delete node;
   }
 }
 
@@ -788,6 +801,14 @@ ConcreteParasitics::deleteParasiticsImpl()
 
 void
 ConcreteParasitics::deleteParasitics(const Pin *drvr_pin)
+{
+  LockGuard lock(lock_);
+  deleteDrvrParasitics(drvr_pin);
+}
+
+// Caller holds lock_.
+void
+ConcreteParasitics::deleteDrvrParasitics(const Pin *drvr_pin)
 {
   auto itr = drvr_parasitic_map_.find(drvr_pin);
   if (itr != drvr_parasitic_map_.end()) {
@@ -801,9 +822,12 @@ ConcreteParasitics::deleteParasitics(const Pin *drvr_pin)
 void
 ConcreteParasitics::deleteParasitics(const Net *net)
 {
+  // The network driver cache is filled under lock_ because spef
+  // sections are read in parallel.
+  LockGuard lock(lock_);
   PinSet *drivers = network_->drivers(net);
   for (auto drvr_pin : *drivers)
-    deleteParasitics(drvr_pin);
+    deleteDrvrParasitics(drvr_pin);
 
   parasitic_network_map_.erase(net);
 }
@@ -863,11 +887,12 @@ ConcreteParasitics::loadPinCapacitanceChanged(const Pin *pin)
 void
 ConcreteParasitics::deleteReducedParasitics(const Net *net)
 {
+  LockGuard lock(lock_);
   if (!drvr_parasitic_map_.empty()) {
     PinSet *drivers = network_->drivers(net);
     if (drivers) {
       for (auto drvr_pin : *drivers)
-        deleteDrvrReducedParasitics(drvr_pin);
+        deleteDrvrParasitics(drvr_pin);
     }
   }
 }
@@ -876,11 +901,12 @@ ConcreteParasitics::deleteReducedParasitics(const Net *net)
 void
 ConcreteParasitics::deleteReducedParasitics(const Pin *pin)
 {
+  LockGuard lock(lock_);
   if (!drvr_parasitic_map_.empty()) {
     PinSet *drivers = network_->drivers(pin);
     if (drivers) {
       for (auto drvr_pin : *drivers)
-        deleteDrvrReducedParasitics(drvr_pin);
+        deleteDrvrParasitics(drvr_pin);
     }
   }
 }
@@ -888,7 +914,8 @@ ConcreteParasitics::deleteReducedParasitics(const Pin *pin)
 void
 ConcreteParasitics::deleteDrvrReducedParasitics(const Pin *drvr_pin)
 {
-  deleteParasitics(drvr_pin);
+  LockGuard lock(lock_);
+  deleteDrvrParasitics(drvr_pin);
 }
 
 ////////////////////////////////////////////////////////////////
@@ -1174,7 +1201,7 @@ ConcreteParasitics::makeParasiticNetwork(const Net *net,
   if (itr != parasitic_network_map_.end()) {
     parasitic_network_map_.erase(itr);
     for (const Pin *drvr_pin : *network_->drivers(net))
-      deleteParasitics(drvr_pin);
+      deleteDrvrParasitics(drvr_pin);
   }
   parasitic_network_map_.emplace(net, ConcreteParasiticNetwork(net, includes_pin_caps,
                                                                network_));
@@ -1265,11 +1292,9 @@ ConcreteParasitics::makeCapacitor(Parasitic *parasitic,
 {
   ConcreteParasiticNode *cnode1 = static_cast<ConcreteParasiticNode*>(node1);
   ConcreteParasiticNode *cnode2 = static_cast<ConcreteParasiticNode*>(node2);
-  ConcreteParasiticCapacitor *capacitor =
-    new ConcreteParasiticCapacitor(id, cap, cnode1, cnode2);
   ConcreteParasiticNetwork *cparasitic =
     static_cast<ConcreteParasiticNetwork*>(parasitic);
-  cparasitic->addCapacitor(capacitor);
+  cparasitic->makeCapacitor(id, cap, cnode1, cnode2);
 }
 
 void
@@ -1281,11 +1306,9 @@ ConcreteParasitics::makeResistor(Parasitic *parasitic,
 {
   ConcreteParasiticNode *cnode1 = static_cast<ConcreteParasiticNode*>(node1);
   ConcreteParasiticNode *cnode2 = static_cast<ConcreteParasiticNode*>(node2);
-  ParasiticResistor *resistor = new ConcreteParasiticResistor(id, res,
-                                                              cnode1, cnode2);
   ConcreteParasiticNetwork *cparasitic =
     static_cast<ConcreteParasiticNetwork*>(parasitic);
-  cparasitic->addResistor(resistor);
+  cparasitic->makeResistor(id, res, cnode1, cnode2);
 }
 
 ParasiticNodeSeq
@@ -1296,6 +1319,22 @@ ConcreteParasitics::nodes(const Parasitic *parasitic) const
   return cparasitic->nodes();
 }
 
+size_t
+ConcreteParasitics::nodeCount(const Parasitic *parasitic) const
+{
+  const ConcreteParasiticNetwork *cparasitic =
+    static_cast<const ConcreteParasiticNetwork*>(parasitic);
+  return cparasitic->nodeCount();
+}
+
+uint32_t
+ConcreteParasitics::nodeIndex(const ParasiticNode *node) const
+{
+  const ConcreteParasiticNode *cnode =
+    static_cast<const ConcreteParasiticNode*>(node);
+  return cnode->index();
+}
+
 ParasiticResistorSeq
 ConcreteParasitics::resistors(const Parasitic *parasitic) const
 {
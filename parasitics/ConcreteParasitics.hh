@@ -142,6 +142,8 @@ public:
                                      const Pin *pin,
                                      const Network *network) override;
   ParasiticNodeSeq nodes(const Parasitic *parasitic) const override;
+  size_t nodeCount(const Parasitic *parasitic) const override;
+  uint32_t nodeIndex(const ParasiticNode *node) const override;
   void incrCap(ParasiticNode *node,
                float cap) override;
   std::string name(const ParasiticNode *node) const override;
@@ -185,6 +187,7 @@ public:
 
 protected:
   void deleteParasiticsImpl();
+  void deleteDrvrParasitics(const Pin *drvr_pin);
   Parasitic *ensureRspf(const Pin *drvr_pin);
   void makeAnalysisPtAfter();
   void deleteReducedParasitics(const Pin *pin);
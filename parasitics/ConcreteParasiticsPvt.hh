@@ -24,9 +24,14 @@
 
 #pragma once
 
+#include <bit>
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "Parasitics.hh"
 
@@ -35,6 +40,8 @@ namespace sta {
 class ConcretePoleResidue;
 class ConcreteParasiticDevice;
 class ConcreteParasiticNode;
+class ConcreteParasiticResistor;
+class ConcreteParasiticCapacitor;
 
 using NetIdPair = std::pair<const Net*, int>;
 
@@ -209,6 +216,32 @@ private:
   ConcretePoleResidueMap load_pole_residue_;
 };
 
+// Network nodes and devices are allocated from per-network pools.
+// Pool blocks double in size so small networks stay small and object
+// addresses are stable. Objects are referenced by their 32 bit index
+// in the pool and are destroyed with the pool.
+template <class TYPE>
+class ConcreteParasiticPool
+{
+public:
+  ConcreteParasiticPool() = default;
+  ConcreteParasiticPool(ConcreteParasiticPool &&pool) noexcept;
+  ~ConcreteParasiticPool();
+  template <class... ARGS>
+  TYPE *make(ARGS &&...args);
+  TYPE *operator[](uint32_t index) const;
+  uint32_t size() const { return size_; }
+
+private:
+  static uint32_t blockIndex(uint32_t index);
+  static uint32_t blockBegin(uint32_t block);
+  static uint32_t blockSize(uint32_t block) { return first_block_size << block; }
+
+  static constexpr uint32_t first_block_size = 4;
+  std::vector<TYPE*> blocks_;
+  uint32_t size_{0};
+};
+
 class ConcreteParasiticNetwork : public ParasiticNetwork,
                                  public ConcreteParasitic
 {
@@ -232,13 +265,21 @@ public:
                                              const Network *network);
   float capacitance() const override;
   ParasiticNodeSeq nodes() const;
+  // Node count including disconnected pin nodes.
+  uint32_t nodeCount() const { return node_pool_.size(); }
   void disconnectPin(const Pin *pin,
                      const Net *net,
                      const Network *network);
-  ParasiticResistorSeq resistors() const { return resistors_; }
-  void addResistor(ParasiticResistor *resistor);
-  ParasiticCapacitorSeq capacitors() const { return capacitors_; }
-  void addCapacitor(ParasiticCapacitor *capacitor);
+  ParasiticResistorSeq resistors() const;
+  ConcreteParasiticResistor *makeResistor(uint32_t id,
+                                          float value,
+                                          ConcreteParasiticNode *node1,
+                                          ConcreteParasiticNode *node2);
+  ParasiticCapacitorSeq capacitors() const;
+  ConcreteParasiticCapacitor *makeCapacitor(uint32_t id,
+                                            float value,
+                                            ConcreteParasiticNode *node1,
+                                            ConcreteParasiticNode *node2);
   PinSet unannotatedLoads(const Pin *drvr_pin,
                           const Parasitics *parasitics) const override;
 
@@ -246,19 +287,22 @@ private:
   void unannotatedLoads(ParasiticNode *node,
                         ParasiticResistor *from_res,
                         PinSet &loads,
-                        ParasiticNodeSet &visited_nodes,
+                        std::vector<bool> &visited_nodes,
                         ParasiticResistorSet &loop_resistors,
-                        ParasiticNodeResistorMap &resistor_map,
+                        const ParasiticResistorAdjacency &adjacency,
                         const Parasitics *parasitics) const;
-
-  void deleteNodes();
-  void deleteDevices();
+  ConcreteParasiticNode *makeNode(const Net *net,
+                                  uint32_t id,
+                                  bool is_external);
+  ConcreteParasiticNode *makeNode(const Pin *pin,
+                                  bool is_external);
 
   const Net *net_;
   ConcreteParasiticSubNodeMap sub_nodes_;
   ConcreteParasiticPinNodeMap pin_nodes_;
-  ParasiticResistorSeq resistors_;
-  ParasiticCapacitorSeq capacitors_;
+  ConcreteParasiticPool<ConcreteParasiticNode> node_pool_;
+  ConcreteParasiticPool<ConcreteParasiticResistor> resistor_pool_;
+  ConcreteParasiticPool<ConcreteParasiticCapacitor> capacitor_pool_;
   unsigned max_node_id_:31{0};
   bool includes_pin_caps_:1;
 };
@@ -275,6 +319,8 @@ public:
   std::string name(const Network *network) const;
   const Net *net(const Network *network) const;
   unsigned id() const { return id_; }
+  // Index of the node in the network node pool.
+  uint32_t index() const { return index_; }
   bool isExternal() const { return is_external_; }
   const Pin *pin() const;
   void incrCapacitance(float cap);
@@ -290,6 +336,7 @@ protected:
   bool is_external_:1;
   unsigned id_:30;
   float cap_;
+  uint32_t index_{0};
 
   friend class ConcreteParasiticNetwork;
 };
@@ -335,4 +382,63 @@ public:
                              ConcreteParasiticNode *node2);
 };
 
+////////////////////////////////////////////////////////////////
+
+template <class TYPE>
+ConcreteParasiticPool<TYPE>::ConcreteParasiticPool(ConcreteParasiticPool &&pool)
+  noexcept :
+  blocks_(std::move(pool.blocks_)),
+  size_(pool.size_)
+{
+  pool.blocks_.clear();
+  pool.size_ = 0;
+}
+
+template <class TYPE>
+ConcreteParasiticPool<TYPE>::~ConcreteParasiticPool()
+{
+  for (uint32_t index = 0; index < size_; index++)
+    std::destroy_at((*this)[index]);
+  std::allocator<TYPE> allocator;
+  for (uint32_t block = 0; block < blocks_.size(); block++)
+    allocator.deallocate(blocks_[block], blockSize(block));
+}
+
+template <class TYPE>
+template <class... ARGS>
+TYPE *
+ConcreteParasiticPool<TYPE>::make(ARGS &&...args)
+{
+  uint32_t block = blockIndex(size_);
+  if (block == blocks_.size())
+    blocks_.push_back(std::allocator<TYPE>().allocate(blockSize(block)));
+  TYPE *object = blocks_[block] + (size_ - blockBegin(block));
+  std::construct_at(object, std::forward<ARGS>(args)...);
+  size_++;
+  return object;
+}
+
+template <class TYPE>
+TYPE *
+ConcreteParasiticPool<TYPE>::operator[](uint32_t index) const
+{
+  uint32_t block = blockIndex(index);
+  return blocks_[block] + (index - blockBegin(block));
+}
+
+template <class TYPE>
+uint32_t
+ConcreteParasiticPool<TYPE>::blockIndex(uint32_t index)
+{
+  return std::bit_width(index / first_block_size + 1) - 1;
+}
+
+// Index of the first object in block.
+template <class TYPE>
+uint32_t
+ConcreteParasiticPool<TYPE>::blockBegin(uint32_t block)
+{
+  return first_block_size * ((1u << block) - 1);
+}
+
 } // namespace sta
@@ -29,6 +29,7 @@
 #include "EstimateParasitics.hh"
 #include "Liberty.hh"
 #include "Network.hh"
+#include "ParasiticsCache.hh"
 #include "PortDirection.hh"
 #include "ReduceParasitics.hh"
 #include "Scene.hh"
@@ -141,6 +142,70 @@ Parasitics::parasiticNodeCapacitorMap(const Parasitic *parasitic) const
   return capacitor_map;
 }
 
+////////////////////////////////////////////////////////////////
+
+template <class DEVICE>
+static std::vector<DEVICE*>
+networkDevices(const Parasitic *parasitic,
+               const Parasitics *parasitics);
+
+template <>
+std::vector<ParasiticResistor*>
+networkDevices(const Parasitic *parasitic,
+               const Parasitics *parasitics)
+{
+  return parasitics->resistors(parasitic);
+}
+
+template <>
+std::vector<ParasiticCapacitor*>
+networkDevices(const Parasitic *parasitic,
+               const Parasitics *parasitics)
+{
+  return parasitics->capacitors(parasitic);
+}
+
+template <class DEVICE>
+ParasiticDeviceAdjacency<DEVICE>::ParasiticDeviceAdjacency(const Parasitic *parasitic,
+                                                           const Parasitics *parasitics) :
+  parasitics_(parasitics)
+{
+  std::vector<DEVICE*> devices = networkDevices<DEVICE>(parasitic, parasitics);
+  size_t node_count = parasitics->nodeCount(parasitic);
+  offsets_.assign(node_count + 1, 0);
+  // A device with identical nodes appears twice in the node's devices
+  // like it does in the node device maps.
+  for (DEVICE *device : devices) {
+    offsets_[parasitics->nodeIndex(parasitics->node1(device)) + 1]++;
+    offsets_[parasitics->nodeIndex(parasitics->node2(device)) + 1]++;
+  }
+  for (size_t i = 0; i < node_count; i++)
+    offsets_[i + 1] += offsets_[i];
+  devices_.resize(offsets_[node_count]);
+  std::vector<uint32_t> next(offsets_.begin(), offsets_.end() - 1);
+  for (DEVICE *device : devices) {
+    devices_[next[parasitics->nodeIndex(parasitics->node1(device))]++] = device;
+    devices_[next[parasitics->nodeIndex(parasitics->node2(device))]++] = device;
+  }
+}
+
+template <class DEVICE>
+std::span<DEVICE* const>
+ParasiticDeviceAdjacency<DEVICE>::devices(const ParasiticNode *node) const
+{
+  uint32_t index = parasitics_->nodeIndex(node);
+  if (index + 1 < offsets_.size())
+    return std::span<DEVICE* const>(devices_.data() + offsets_[index],
+                                    offsets_[index + 1] - offsets_[index]);
+  else
+    return {};
+}
+
+template class ParasiticDeviceAdjacency<ParasiticResistor>;
+template class ParasiticDeviceAdjacency<ParasiticCapacitor>;
+
+////////////////////////////////////////////////////////////////
+
 ParasiticNode *
 Parasitics::otherNode(const ParasiticResistor *resistor,
                       ParasiticNode *node) const
@@ -346,6 +411,36 @@ Parasitics::setCouplingCapFactor(float factor)
   coupling_cap_factor_ = factor;
 }
 
+void
+Parasitics::setSpefFile(std::string_view filename,
+                        size_t hash)
+{
+  // A cache can only be checked against one spef file.
+  if (spef_filename_.empty() || spef_filename_ == filename) {
+    spef_filename_ = filename;
+    spef_hash_ = hash;
+  }
+  else
+    spefFileInvalid();
+}
+
+void
+Parasitics::spefFileInvalid()
+{
+  spef_hash_ = 0;
+  spef_file_valid_ = false;
+}
+
+size_t
+Parasitics::spefHash() const
+{
+  if (spef_hash_ == 0
+      && spef_file_valid_
+      && !spef_filename_.empty())
+    spef_hash_ = sta::spefHash(spef_filename_);
+  return spef_hash_;
+}
+
 ////////////////////////////////////////////////////////////////
 
 ParasiticNodeLess::ParasiticNodeLess() :
@@ -23,6 +23,12 @@
 // This notice may not be removed or altered from any source distribution.
 
 %{
+#include <algorithm>
+#include <cctype>
+
+#include "Network.hh"
+#include "Parasitics.hh"
+#include "Report.hh"
 #include "Sta.hh"
 
 using sta::Sta;
@@ -30,6 +36,55 @@ using sta::Instance;
 using sta::MinMaxAll;
 using sta::RiseFall;
 using sta::Pin;
+using sta::Net;
+using sta::Parasitic;
+using sta::Parasitics;
+using sta::ParasiticNode;
+
+// Parasitic ECO node names are pin path names or subnode ids of the net.
+static bool
+isEcoSubnodeName(const std::string &name)
+{
+  return !name.empty()
+    && std::ranges::all_of(name, [](unsigned char ch) { return std::isdigit(ch); });
+}
+
+static void
+checkEcoNodeNames(const StringSeq &names,
+                  const Net *net,
+                  const Parasitics *parasitics,
+                  Sta *sta)
+{
+  for (const std::string &name : names) {
+    if (!name.empty()
+        && !isEcoSubnodeName(name)) {
+      const Pin *pin = sta->sdcNetwork()->findPin(name);
+      if (pin == nullptr)
+        sta->report()->error(1667, "parasitic node pin {} not found.", name);
+      // Pins below the net in the hierarchy and top level ports
+      // without a net are on the highest connected net.
+      if (parasitics->findParasiticNet(pin) != net)
+        sta->report()->error(1671, "parasitic node pin {} is not on net {}.",
+                             name, sta->network()->pathName(net));
+    }
+  }
+}
+
+static ParasiticNode *
+ensureEcoNode(const std::string &name,
+              Parasitics *parasitics,
+              Parasitic *parasitic,
+              const Net *net,
+              Sta *sta)
+{
+  if (isEcoSubnodeName(name))
+    return parasitics->ensureParasiticNode(parasitic, net, std::stoul(name),
+                                           sta->network());
+  else {
+    const Pin *pin = sta->sdcNetwork()->findPin(name);
+    return parasitics->ensureParasiticNode(parasitic, pin, sta->network());
+  }
+}
 
 %}
 
@@ -52,6 +107,21 @@ read_spef_cmd(const char *name,
                               coupling_cap_factor, reduce);
 }
 
+void
+write_parasitics_cache_cmd(const char *name,
+                           const char *filename)
+{
+  Sta::sta()->writeParasiticsCache(name, filename);
+}
+
+bool
+read_parasitics_cache_cmd(const char *name,
+                          const char *filename,
+                          const char *spef_filename)
+{
+  return Sta::sta()->readParasiticsCache(name, filename, spef_filename);
+}
+
 void
 report_parasitic_annotation_cmd(const char *spef_name,
                                 bool report_unannotated)
@@ -109,4 +179,76 @@ set_elmore_cmd(Pin *drvr_pin,
   Sta::sta()->setElmore(drvr_pin, load_pin, rf, min_max, elmore);
 }
 
+// resistor_nodes has two nodes for each resistance.
+// capacitor_nodes has two nodes for each capacitance. The second node
+// of a grounded capacitance is empty.
+void
+set_net_parasitics_cmd(Net *cmd_net,
+                       const char *name,
+                       bool pin_cap_included,
+                       bool edit,
+                       bool reduce,
+                       StringSeq resistor_nodes,
+                       FloatSeq resistances,
+                       StringSeq capacitor_nodes,
+                       FloatSeq capacitances)
+{
+  Sta *sta = Sta::sta();
+  // Parasitic networks are kept on the highest connected net.
+  const Net *net = sta->network()->highestConnectedNet(cmd_net);
+  std::vector<Parasitics*> parasitics_seq;
+  if (name[0] != '\0') {
+    Parasitics *parasitics = sta->findParasitics(name);
+    if (parasitics == nullptr)
+      sta->report()->error(1668, "parasitics {} not found.", name);
+    parasitics_seq.push_back(parasitics);
+  }
+  else {
+    const Scene *scene = sta->cmdScene();
+    for (const MinMax *min_max : MinMax::range()) {
+      Parasitics *parasitics = scene->parasitics(min_max);
+      if (std::ranges::find(parasitics_seq, parasitics) == parasitics_seq.end())
+        parasitics_seq.push_back(parasitics);
+    }
+  }
+  // Check the nodes before editing so errors do not leave a partial network.
+  checkEcoNodeNames(resistor_nodes, net, parasitics_seq[0], sta);
+  checkEcoNodeNames(capacitor_nodes, net, parasitics_seq[0], sta);
+  if (edit) {
+    for (Parasitics *parasitics : parasitics_seq) {
+      if (parasitics->findParasiticNetwork(net) == nullptr)
+        sta->report()->error(1672, "net {} has no parasitic network to edit.",
+                             sta->network()->pathName(net));
+    }
+  }
+
+  for (Parasitics *parasitics : parasitics_seq) {
+    Parasitic *parasitic = sta->beginParasiticEco(net, parasitics,
+                                                  pin_cap_included, !edit);
+    uint32_t res_id = parasitics->resistors(parasitic).size() + 1;
+    for (size_t i = 0; i < resistances.size(); i++) {
+      ParasiticNode *node1 = ensureEcoNode(resistor_nodes[i * 2], parasitics,
+                                           parasitic, net, sta);
+      ParasiticNode *node2 = ensureEcoNode(resistor_nodes[i * 2 + 1], parasitics,
+                                           parasitic, net, sta);
+      parasitics->makeResistor(parasitic, res_id++, resistances[i], node1, node2);
+    }
+    uint32_t cap_id = parasitics->capacitors(parasitic).size() + 1;
+    for (size_t i = 0; i < capacitances.size(); i++) {
+      ParasiticNode *node1 = ensureEcoNode(capacitor_nodes[i * 2], parasitics,
+                                           parasitic, net, sta);
+      const std::string &node2_name = capacitor_nodes[i * 2 + 1];
+      if (node2_name.empty())
+        parasitics->incrCap(node1, capacitances[i]);
+      else {
+        ParasiticNode *node2 = ensureEcoNode(node2_name, parasitics,
+                                             parasitic, net, sta);
+        parasitics->makeCapacitor(parasitic, cap_id++, capacitances[i],
+                                  node1, node2);
+      }
+    }
+    sta->finishParasiticEco(net, parasitics, reduce);
+  }
+}
+
 %} // inline
@@ -72,6 +72,39 @@ proc_redirect read_spef {
             $coupling_reduction_factor $reduce]
 }
 
+define_cmd_args "write_parasitics_cache" {[-name spef_name] filename}
+
+proc_redirect write_parasitics_cache {
+  parse_key_args "write_parasitics_cache" args keys {-name} flags {}
+  check_argc_eq1 "write_parasitics_cache" $args
+
+  set name ""
+  if { [info exists keys(-name)] } {
+    set name $keys(-name)
+  }
+  set filename [file nativename [lindex $args 0]]
+  write_parasitics_cache_cmd $name $filename
+}
+
+define_cmd_args "read_parasitics_cache" {[-name spef_name]\
+                                          [-spef spef_file] filename}
+
+proc_redirect read_parasitics_cache {
+  parse_key_args "read_parasitics_cache" args keys {-name -spef} flags {}
+  check_argc_eq1 "read_parasitics_cache" $args
+
+  set name ""
+  if { [info exists keys(-name)] } {
+    set name $keys(-name)
+  }
+  set spef_filename ""
+  if { [info exists keys(-spef)] } {
+    set spef_filename [file nativename $keys(-spef)]
+  }
+  set filename [file nativename [lindex $args 0]]
+  return [read_parasitics_cache_cmd $name $filename $spef_filename]
+}
+
 define_cmd_args "report_parasitic_annotation" {[-name spef_name]\
                                                [-report_unannotated]}
 
@@ -132,5 +165,67 @@ proc set_elmore { args } {
   set_elmore_cmd $drvr_pin $load_pin "fall" $min_max $elmore
 }
 
+define_cmd_args "set_net_parasitics" \
+  {[-name spef_name]\
+     [-pin_cap_included]\
+     [-edit]\
+     [-reduce]\
+     [-resistors {{node1 node2 res}...}]\
+     [-capacitors {{node cap}|{node1 node2 cap}...}]\
+     net}
+
+# Replace or edit the parasitic network of one net.
+# Nodes are pin names or integer subnode ids of the net.
+proc_redirect set_net_parasitics {
+  parse_key_args "set_net_parasitics" args \
+    keys {-name -resistors -capacitors} \
+    flags {-pin_cap_included -edit -reduce}
+  check_argc_eq1 "set_net_parasitics" $args
+
+  set net [get_net_arg "net" [lindex $args 0]]
+  if { $net == "NULL" } {
+    return
+  }
+  set name ""
+  if { [info exists keys(-name)] } {
+    set name $keys(-name)
+  }
+  set resistor_nodes {}
+  set resistances {}
+  if { [info exists keys(-resistors)] } {
+    foreach resistor $keys(-resistors) {
+      if { [llength $resistor] != 3 } {
+        sta_error 277 "-resistors '$resistor' is not {node1 node2 res}."
+      }
+      lassign $resistor node1 node2 res
+      check_positive_float "resistance" $res
+      lappend resistor_nodes $node1 $node2
+      lappend resistances [resistance_ui_sta $res]
+    }
+  }
+  set capacitor_nodes {}
+  set capacitances {}
+  if { [info exists keys(-capacitors)] } {
+    foreach capacitor $keys(-capacitors) {
+      if { [llength $capacitor] == 2 } {
+        lassign $capacitor node1 cap
+        set node2 ""
+      } elseif { [llength $capacitor] == 3 } {
+        lassign $capacitor node1 node2 cap
+      } else {
+        sta_error 278 "-capacitors '$capacitor' is not {node cap} or {node1 node2 cap}."
+      }
+      check_positive_float "capacitance" $cap
+      lappend capacitor_nodes $node1 $node2
+      lappend capacitances [capacitance_ui_sta $cap]
+    }
+  }
+  set_net_parasitics_cmd $net $name \
+    [info exists flags(-pin_cap_included)] \
+    [info exists flags(-edit)] \
+    [info exists flags(-reduce)] \
+    $resistor_nodes $resistances $capacitor_nodes $capacitances
+}
+
 # sta namespace end
 }
@@ -0,0 +1,637 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+
+#include "ParasiticsCache.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "ArcDelayCalc.hh"
+#include "Debug.hh"
+#include "Error.hh"
+#include "Hash.hh"
+#include "MinMax.hh"
+#include "Network.hh"
+#include "Parasitics.hh"
+#include "Report.hh"
+#include "Scene.hh"
+#include "StaState.hh"
+#include "Stats.hh"
+#include "Transition.hh"
+
+namespace sta {
+
+// File layout (native byte order):
+//  magic, version
+//  netlist hash, spef hash
+//  spef filename, delay calculator name
+//  driver records terminated by an empty driver pin name
+//    driver pin path name, model count
+//      min/max index, rise/fall index, model kind, is reduced
+//      c2, rpi, c1
+//      load count
+//        load pin path name
+//        elmore | pole/residue count, (pole, residue)...
+static constexpr char cache_magic[8] = {'S','T','A','P','A','R','C','\0'};
+static constexpr uint32_t cache_version = 1;
+
+enum class CacheModel : uint8_t { pi_elmore, pi_pole_residue };
+
+// Cache records are read and checked before any model is made so a
+// bad cache file leaves the parasitics unchanged.
+class CacheLoad
+{
+public:
+  const Pin *pin;
+  float elmore;
+  ComplexFloatSeq poles;
+  ComplexFloatSeq residues;
+};
+
+class CacheDrvrModel
+{
+public:
+  const MinMax *min_max;
+  const RiseFall *rf;
+  CacheModel model;
+  bool is_reduced;
+  float c2;
+  float rpi;
+  float c1;
+  std::vector<CacheLoad> loads;
+};
+
+class CacheDrvr
+{
+public:
+  const Pin *pin;
+  std::vector<CacheDrvrModel> models;
+};
+
+class ParasiticsCacheWriter : public StaState
+{
+public:
+  ParasiticsCacheWriter(std::string_view filename,
+                        Parasitics *parasitics,
+                        StaState *sta);
+  void write();
+
+private:
+  void findDrvrPins(PinSeq &drvr_pins) const;
+  void ensureReduced(const Pin *drvr_pin);
+  void writeDrvr(const Pin *drvr_pin);
+  const Parasitic *findModel(const Pin *drvr_pin,
+                             const RiseFall *rf,
+                             const MinMax *min_max,
+                             CacheModel &model) const;
+  void writeModel(const Parasitic *parasitic,
+                  CacheModel model,
+                  const Pin *drvr_pin,
+                  const RiseFall *rf,
+                  const MinMax *min_max);
+  template <class VALUE>
+  void writeValue(VALUE value);
+  void writeString(std::string_view str);
+
+  std::string filename_;
+  Parasitics *parasitics_;
+  std::ofstream stream_;
+  std::vector<std::pair<const Scene*, const MinMax*>> reduce_aps_;
+  size_t drvr_count_{0};
+};
+
+class ParasiticsCacheReader : public StaState
+{
+public:
+  ParasiticsCacheReader(std::string_view filename,
+                        std::string_view spef_filename,
+                        Parasitics *parasitics,
+                        StaState *sta);
+  bool read();
+
+private:
+  bool readHeader();
+  bool readDrvr();
+  void readModel(CacheDrvrModel &model);
+  void makeModels();
+  template <class VALUE>
+  VALUE readValue();
+  uint32_t readCount(size_t record_size);
+  std::string readString();
+  [[noreturn]] void badCache();
+
+  std::string filename_;
+  std::string spef_filename_;
+  size_t spef_hash_{0};
+  Parasitics *parasitics_;
+  std::ifstream stream_;
+  std::streamoff file_size_{0};
+  std::vector<CacheDrvr> drvrs_;
+};
+
+////////////////////////////////////////////////////////////////
+
+void
+writeParasiticsCache(std::string_view filename,
+                     Parasitics *parasitics,
+                     StaState *sta)
+{
+  ParasiticsCacheWriter writer(filename, parasitics, sta);
+  writer.write();
+}
+
+ParasiticsCacheWriter::ParasiticsCacheWriter(std::string_view filename,
+                                             Parasitics *parasitics,
+                                             StaState *sta) :
+  StaState(sta),
+  filename_(filename),
+  parasitics_(parasitics)
+{
+  for (const Scene *scene : scenes_) {
+    for (const MinMax *min_max : MinMax::range()) {
+      if (scene->parasitics(min_max) == parasitics_)
+        reduce_aps_.emplace_back(scene, min_max);
+    }
+  }
+}
+
+void
+ParasiticsCacheWriter::write()
+{
+  Stats stats(debug_, report_);
+  if (parasitics_->spefHash() == 0)
+    report_->error(1669, "parasitics {} were not read from one spef file.",
+                   parasitics_->name());
+  stream_.open(filename_, std::ios::binary);
+  if (!stream_.is_open())
+    throw FileNotWritable(filename_);
+
+  stream_.write(cache_magic, sizeof(cache_magic));
+  writeValue(cache_version);
+  writeValue<uint64_t>(netlistHash(network_));
+  writeValue<uint64_t>(parasitics_->spefHash());
+  writeString(parasitics_->spefFilename());
+  writeString(arc_delay_calc_->name());
+
+  PinSeq drvr_pins;
+  findDrvrPins(drvr_pins);
+  for (const Pin *drvr_pin : drvr_pins) {
+    ensureReduced(drvr_pin);
+    writeDrvr(drvr_pin);
+  }
+  writeString("");
+  stream_.close();
+  if (stream_.fail())
+    throw FileNotWritable(filename_);
+  debugPrint(debug_, "parasitics_cache", 1, "wrote {} drivers to {}",
+             drvr_count_, filename_);
+  stats.report("Write parasitics cache");
+}
+
+void
+ParasiticsCacheWriter::findDrvrPins(PinSeq &drvr_pins) const
+{
+  InstancePinIterator *top_pin_iter =
+    network_->pinIterator(network_->topInstance());
+  while (top_pin_iter->hasNext()) {
+    const Pin *pin = top_pin_iter->next();
+    if (network_->isDriver(pin))
+      drvr_pins.push_back(pin);
+  }
+  delete top_pin_iter;
+
+  LeafInstanceIterator *leaf_iter = network_->leafInstanceIterator();
+  while (leaf_iter->hasNext()) {
+    const Instance *inst = leaf_iter->next();
+    InstancePinIterator *pin_iter = network_->pinIterator(inst);
+    while (pin_iter->hasNext()) {
+      const Pin *pin = pin_iter->next();
+      if (network_->isDriver(pin))
+        drvr_pins.push_back(pin);
+    }
+    delete pin_iter;
+  }
+  delete leaf_iter;
+}
+
+// Reduce parasitic networks that dcalc has not visited yet.
+void
+ParasiticsCacheWriter::ensureReduced(const Pin *drvr_pin)
+{
+  if (arc_delay_calc_->reduceSupported()) {
+    const Parasitic *parasitic_network =
+      parasitics_->findParasiticNetwork(drvr_pin);
+    if (parasitic_network) {
+      for (const RiseFall *rf : RiseFall::range()) {
+        for (auto [scene, min_max] : reduce_aps_) {
+          if (parasitics_->findPiElmore(drvr_pin, rf, min_max) == nullptr
+              && parasitics_->findPiPoleResidue(drvr_pin, rf, min_max) == nullptr)
+            arc_delay_calc_->reduceParasitic(parasitic_network, drvr_pin, rf,
+                                             scene, min_max);
+        }
+      }
+    }
+  }
+}
+
+const Parasitic *
+ParasiticsCacheWriter::findModel(const Pin *drvr_pin,
+                                 const RiseFall *rf,
+                                 const MinMax *min_max,
+                                 CacheModel &model) const
+{
+  const Parasitic *parasitic = parasitics_->findPiElmore(drvr_pin, rf, min_max);
+  if (parasitic)
+    model = CacheModel::pi_elmore;
+  else {
+    parasitic = parasitics_->findPiPoleResidue(drvr_pin, rf, min_max);
+    model = CacheModel::pi_pole_residue;
+  }
+  return parasitic;
+}
+
+void
+ParasiticsCacheWriter::writeDrvr(const Pin *drvr_pin)
+{
+  uint8_t model_count = 0;
+  for (const MinMax *min_max : MinMax::range()) {
+    for (const RiseFall *rf : RiseFall::range()) {
+      CacheModel model;
+      if (findModel(drvr_pin, rf, min_max, model))
+        model_count++;
+    }
+  }
+  if (model_count > 0) {
+    writeString(network_->pathName(drvr_pin));
+    writeValue(model_count);
+    for (const MinMax *min_max : MinMax::range()) {
+      for (const RiseFall *rf : RiseFall::range()) {
+        CacheModel model;
+        const Parasitic *parasitic = findModel(drvr_pin, rf, min_max, model);
+        if (parasitic)
+          writeModel(parasitic, model, drvr_pin, rf, min_max);
+      }
+    }
+    drvr_count_++;
+  }
+}
+
+void
+ParasiticsCacheWriter::writeModel(const Parasitic *parasitic,
+                                  CacheModel model,
+                                  const Pin *drvr_pin,
+                                  const RiseFall *rf,
+                                  const MinMax *min_max)
+{
+  writeValue<uint8_t>(min_max->index());
+  writeValue<uint8_t>(rf->index());
+  writeValue(model);
+  writeValue<uint8_t>(parasitics_->isReducedParasiticNetwork(parasitic));
+  float c2, rpi, c1;
+  parasitics_->piModel(parasitic, c2, rpi, c1);
+  writeValue(c2);
+  writeValue(rpi);
+  writeValue(c1);
+
+  PinSeq loads;
+  for (const Pin *load_pin : parasitics_->loads(drvr_pin)) {
+    if (model == CacheModel::pi_elmore) {
+      float elmore;
+      bool exists;
+      parasitics_->findElmore(parasitic, load_pin, elmore, exists);
+      if (exists)
+        loads.push_back(load_pin);
+    }
+    else if (parasitics_->findPoleResidue(parasitic, load_pin))
+      loads.push_back(load_pin);
+  }
+  writeValue<uint32_t>(loads.size());
+  for (const Pin *load_pin : loads) {
+    writeString(network_->pathName(load_pin));
+    if (model == CacheModel::pi_elmore) {
+      float elmore;
+      bool exists;
+      parasitics_->findElmore(parasitic, load_pin, elmore, exists);
+      writeValue(elmore);
+    }
+    else {
+      const Parasitic *pole_residue = parasitics_->findPoleResidue(parasitic,
+                                                                   load_pin);
+      size_t count = parasitics_->poleResidueCount(pole_residue);
+      writeValue<uint32_t>(count);
+      for (size_t i = 0; i < count; i++) {
+        ComplexFloat pole, residue;
+        parasitics_->poleResidue(pole_residue, i, pole, residue);
+        writeValue(pole.real());
+        writeValue(pole.imag());
+        writeValue(residue.real());
+        writeValue(residue.imag());
+      }
+    }
+  }
+}
+
+template <class VALUE>
+void
+ParasiticsCacheWriter::writeValue(VALUE value)
+{
+  stream_.write(reinterpret_cast<const char*>(&value), sizeof(VALUE));
+}
+
+void
+ParasiticsCacheWriter::writeString(std::string_view str)
+{
+  writeValue<uint32_t>(str.size());
+  stream_.write(str.data(), str.size());
+}
+
+////////////////////////////////////////////////////////////////
+
+bool
+readParasiticsCache(std::string_view filename,
+                    std::string_view spef_filename,
+                    Parasitics *parasitics,
+                    StaState *sta)
+{
+  ParasiticsCacheReader reader(filename, spef_filename, parasitics, sta);
+  return reader.read();
+}
+
+ParasiticsCacheReader::ParasiticsCacheReader(std::string_view filename,
+                                             std::string_view spef_filename,
+                                             Parasitics *parasitics,
+                                             StaState *sta) :
+  StaState(sta),
+  filename_(filename),
+  spef_filename_(spef_filename),
+  parasitics_(parasitics)
+{
+}
+
+bool
+ParasiticsCacheReader::read()
+{
+  Stats stats(debug_, report_);
+  stream_.open(filename_, std::ios::binary);
+  if (!stream_.is_open())
+    throw FileNotReadable(filename_);
+  stream_.exceptions(std::ios::failbit | std::ios::badbit);
+  try {
+    stream_.seekg(0, std::ios::end);
+    file_size_ = stream_.tellg();
+    stream_.seekg(0, std::ios::beg);
+    if (!readHeader())
+      return false;
+    while (readDrvr()) {}
+  }
+  catch (const std::ios::failure &) {
+    badCache();
+  }
+  makeModels();
+  parasitics_->setSpefFile(spef_filename_, spef_hash_);
+  debugPrint(debug_, "parasitics_cache", 1, "read {} drivers from {}",
+             drvrs_.size(), filename_);
+  stats.report("Read parasitics cache");
+  return true;
+}
+
+void
+ParasiticsCacheReader::badCache()
+{
+  report_->error(1661, "{} is not a parasitics cache or is truncated.",
+                 filename_);
+}
+
+bool
+ParasiticsCacheReader::readHeader()
+{
+  char magic[sizeof(cache_magic)];
+  stream_.read(magic, sizeof(magic));
+  if (!std::equal(magic, magic + sizeof(magic), cache_magic)
+      || readValue<uint32_t>() != cache_version)
+    badCache();
+
+  uint64_t netlist_hash = readValue<uint64_t>();
+  uint64_t spef_hash = readValue<uint64_t>();
+  std::string spef_filename = readString();
+  std::string dcalc_name = readString();
+  if (spef_filename_.empty())
+    spef_filename_ = spef_filename;
+
+  if (netlist_hash != netlistHash(network_)) {
+    report_->warn(1662, "parasitics cache {} does not match the netlist.",
+                  filename_);
+    return false;
+  }
+  // Unreadable spef files hash to zero.
+  spef_hash_ = spefHash(spef_filename_);
+  if (spef_hash == 0
+      || spef_hash != spef_hash_) {
+    report_->warn(1663, "parasitics cache {} does not match spef file {}.",
+                  filename_, spef_filename_);
+    return false;
+  }
+  if (dcalc_name != arc_delay_calc_->name()) {
+    report_->warn(1664, "parasitics cache {} was reduced for delay calculator {}.",
+                  filename_, dcalc_name);
+    return false;
+  }
+  return true;
+}
+
+bool
+ParasiticsCacheReader::readDrvr()
+{
+  std::string drvr_name = readString();
+  if (drvr_name.empty())
+    return false;
+  const Pin *drvr_pin = network_->findPin(drvr_name);
+  if (drvr_pin == nullptr)
+    report_->error(1665, "parasitics cache {} driver pin {} not found.",
+                   filename_, drvr_name);
+  CacheDrvr &drvr = drvrs_.emplace_back();
+  drvr.pin = drvr_pin;
+  uint8_t model_count = readValue<uint8_t>();
+  drvr.models.resize(model_count);
+  for (CacheDrvrModel &model : drvr.models)
+    readModel(model);
+  return true;
+}
+
+void
+ParasiticsCacheReader::readModel(CacheDrvrModel &model)
+{
+  model.min_max = MinMax::find(readValue<uint8_t>());
+  model.rf = RiseFall::find(readValue<uint8_t>());
+  model.model = readValue<CacheModel>();
+  model.is_reduced = readValue<uint8_t>();
+  model.c2 = readValue<float>();
+  model.rpi = readValue<float>();
+  model.c1 = readValue<float>();
+  if (model.min_max == nullptr
+      || model.rf == nullptr
+      || (model.model != CacheModel::pi_elmore
+          && model.model != CacheModel::pi_pole_residue))
+    badCache();
+
+  // Load pin name length and elmore or pole/residue count.
+  uint32_t load_count = readCount(sizeof(uint32_t) + sizeof(float));
+  model.loads.resize(load_count);
+  for (CacheLoad &load : model.loads) {
+    std::string load_name = readString();
+    load.pin = network_->findPin(load_name);
+    if (load.pin == nullptr)
+      report_->error(1666, "parasitics cache {} load pin {} not found.",
+                     filename_, load_name);
+    if (model.model == CacheModel::pi_elmore)
+      load.elmore = readValue<float>();
+    else {
+      uint32_t count = readCount(4 * sizeof(float));
+      load.poles.resize(count);
+      load.residues.resize(count);
+      for (uint32_t j = 0; j < count; j++) {
+        float pole_real = readValue<float>();
+        float pole_imag = readValue<float>();
+        float residue_real = readValue<float>();
+        float residue_imag = readValue<float>();
+        load.poles[j] = ComplexFloat(pole_real, pole_imag);
+        load.residues[j] = ComplexFloat(residue_real, residue_imag);
+      }
+    }
+  }
+}
+
+void
+ParasiticsCacheReader::makeModels()
+{
+  for (CacheDrvr &drvr : drvrs_) {
+    for (CacheDrvrModel &model : drvr.models) {
+      Parasitic *parasitic = (model.model == CacheModel::pi_elmore)
+        ? parasitics_->makePiElmore(drvr.pin, model.rf, model.min_max,
+                                    model.c2, model.rpi, model.c1)
+        : parasitics_->makePiPoleResidue(drvr.pin, model.rf, model.min_max,
+                                         model.c2, model.rpi, model.c1);
+      parasitics_->setIsReducedParasiticNetwork(parasitic, model.is_reduced);
+      for (CacheLoad &load : model.loads) {
+        if (model.model == CacheModel::pi_elmore)
+          parasitics_->setElmore(parasitic, load.pin, load.elmore);
+        else
+          parasitics_->setPoleResidue(parasitic, load.pin,
+                                      new ComplexFloatSeq(std::move(load.poles)),
+                                      new ComplexFloatSeq(std::move(load.residues)));
+      }
+    }
+  }
+  drvrs_.clear();
+}
+
+template <class VALUE>
+VALUE
+ParasiticsCacheReader::readValue()
+{
+  VALUE value;
+  stream_.read(reinterpret_cast<char*>(&value), sizeof(VALUE));
+  return value;
+}
+
+// Read a count of records that are at least record_size bytes and
+// check that they fit in the rest of the file before they are allocated.
+uint32_t
+ParasiticsCacheReader::readCount(size_t record_size)
+{
+  uint32_t count = readValue<uint32_t>();
+  if (static_cast<std::streamoff>(count * record_size)
+      > file_size_ - stream_.tellg())
+    badCache();
+  return count;
+}
+
+std::string
+ParasiticsCacheReader::readString()
+{
+  uint32_t length = readCount(1);
+  std::string str(length, '\0');
+  stream_.read(str.data(), length);
+  return str;
+}
+
+////////////////////////////////////////////////////////////////
+
+static size_t
+pinsHash(const Network *network,
+         const Instance *inst)
+{
+  size_t hash = hash_init_value;
+  InstancePinIterator *pin_iter = network->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    const Pin *pin = pin_iter->next();
+    hashIncr(hash, hashString(network->portName(pin)));
+    const Net *net = network->net(pin);
+    if (net)
+      hashIncr(hash, hashString(network->pathName(net)));
+  }
+  delete pin_iter;
+  return hash;
+}
+
+// Instance hashes are summed so the result does not depend on the
+// leaf instance iteration order.
+size_t
+netlistHash(const Network *network)
+{
+  size_t hash = pinsHash(network, network->topInstance());
+  LeafInstanceIterator *leaf_iter = network->leafInstanceIterator();
+  while (leaf_iter->hasNext()) {
+    const Instance *inst = leaf_iter->next();
+    size_t inst_hash = hashString(network->pathName(inst));
+    hashIncr(inst_hash, hashString(network->name(network->cell(inst))));
+    hashIncr(inst_hash, pinsHash(network, inst));
+    hash += inst_hash;
+  }
+  delete leaf_iter;
+  return hash;
+}
+
+size_t
+spefHash(std::string_view filename)
+{
+  size_t hash = 0;
+  std::ifstream stream(std::string(filename), std::ios::binary);
+  if (stream.is_open()) {
+    hash = hash_init_value;
+    char buffer[65536];
+    do {
+      stream.read(buffer, sizeof(buffer));
+      for (std::streamsize i = 0; i < stream.gcount(); i++)
+        hashIncr(hash, buffer[i]);
+    } while (stream);
+  }
+  return hash;
+}
+
+} // namespace sta
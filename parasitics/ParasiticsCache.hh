@@ -0,0 +1,64 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace sta {
+
+class Network;
+class Parasitics;
+class StaState;
+
+// Write the reduced driver models (pi/elmore, pi/pole residue) of
+// parasitics to a binary cache file keyed by the netlist, spef file and
+// delay calculator. Parasitic networks that have not been reduced are
+// reduced for every scene that uses parasitics before writing.
+void
+writeParasiticsCache(std::string_view filename,
+                     Parasitics *parasitics,
+                     StaState *sta);
+
+// Read reduced driver models from a parasitics cache file.
+// spef_filename defaults to the spef file recorded in the cache.
+// Return false without changing parasitics if the cache does not match
+// the netlist, spef file or delay calculator.
+bool
+readParasiticsCache(std::string_view filename,
+                    std::string_view spef_filename,
+                    Parasitics *parasitics,
+                    StaState *sta);
+
+// Order independent hash of the linked netlist connectivity.
+size_t
+netlistHash(const Network *network);
+
+// Hash of the spef file bytes. Unreadable files hash to zero.
+size_t
+spefHash(std::string_view filename);
+
+} // namespace sta
@@ -27,6 +27,7 @@
 #include <algorithm>
 #include <map>
 #include <set>
+#include <vector>
 
 #include "Debug.hh"
 #include "Error.hh"
@@ -39,10 +40,10 @@
 
 namespace sta {
 
-using ParasiticNodeValueMap = std::map<ParasiticNode *, double>;
+// Per node values indexed by Parasitics::nodeIndex.
+using ParasiticNodeValues = std::vector<double>;
 using ResistorCurrentMap = std::map<ParasiticResistor *, double>;
 using ParasiticResistorSet = std::set<ParasiticResistor *>;
-using ParasiticNodeSet = std::set<ParasiticNode *>;
 
 class ReduceToPi : public StaState
 {
@@ -86,11 +87,11 @@ protected:
   const RiseFall *rf_ {nullptr};
   const Scene *scene_ {nullptr};
   const MinMax *min_max_ {nullptr};
-  ParasiticNodeResistorMap resistor_map_;
-  ParasiticNodeCapacitorMap capacitor_map_;
+  ParasiticResistorAdjacency resistor_adjacency_;
+  ParasiticCapacitorAdjacency capacitor_adjacency_;
 
-  ParasiticNodeSet visited_nodes_;
-  ParasiticNodeValueMap node_values_;
+  std::vector<bool> visited_nodes_;
+  ParasiticNodeValues node_values_;
   ParasiticResistorSet loop_resistors_;
   bool pin_caps_one_value_ {true};
 };
@@ -122,8 +123,11 @@ ReduceToPi::reduceToPi(const Parasitic *parasitic_network,
   min_max_ = min_max;
   parasitics_ = scene_->parasitics(min_max);
   includes_pin_caps_ = parasitics_->includesPinCaps(parasitic_network),
-  resistor_map_ = parasitics_->parasiticNodeResistorMap(parasitic_network);
-  capacitor_map_ = parasitics_->parasiticNodeCapacitorMap(parasitic_network);
+  resistor_adjacency_ = ParasiticResistorAdjacency(parasitic_network, parasitics_);
+  capacitor_adjacency_ = ParasiticCapacitorAdjacency(parasitic_network, parasitics_);
+  size_t node_count = parasitics_->nodeCount(parasitic_network);
+  visited_nodes_.assign(node_count, false);
+  node_values_.assign(node_count, 0.0);
 
   double y1, y2, y3, dcap;
   double max_resistance = 0.0;
@@ -159,8 +163,7 @@ ReduceToPi::reducePiDfs(const Pin *drvr_pin,
                         double &max_resistance)
 {
   double coupling_cap = 0.0;
-  ParasiticCapacitorSeq &capacitors = capacitor_map_[node];
-  for (ParasiticCapacitor *capacitor : capacitors)
+  for (ParasiticCapacitor *capacitor : capacitor_adjacency_.devices(node))
     coupling_cap += parasitics_->value(capacitor);
 
   dwn_cap = parasitics_->nodeGndCap(node)
@@ -171,8 +174,7 @@ ReduceToPi::reducePiDfs(const Pin *drvr_pin,
   max_resistance = std::max(max_resistance, src_resistance);
 
   visit(node);
-  ParasiticResistorSeq &resistors = resistor_map_[node];
-  for (ParasiticResistor *resistor : resistors) {
+  for (ParasiticResistor *resistor : resistor_adjacency_.devices(node)) {
     if (!isLoopResistor(resistor)) {
       ParasiticNode *onode = parasitics_->otherNode(resistor, node);
       // One commercial extractor creates resistors with identical from/to nodes.
@@ -231,19 +233,19 @@ ReduceToPi::pinCapacitance(ParasiticNode *node)
 void
 ReduceToPi::visit(ParasiticNode *node)
 {
-  visited_nodes_.insert(node);
+  visited_nodes_[parasitics_->nodeIndex(node)] = true;
 }
 
 bool
 ReduceToPi::isVisited(ParasiticNode *node)
 {
-  return visited_nodes_.contains(node);
+  return visited_nodes_[parasitics_->nodeIndex(node)];
 }
 
 void
 ReduceToPi::leave(ParasiticNode *node)
 {
-  visited_nodes_.erase(node);
+  visited_nodes_[parasitics_->nodeIndex(node)] = false;
 }
 
 bool
@@ -262,13 +264,13 @@ void
 ReduceToPi::setDownstreamCap(ParasiticNode *node,
                              float cap)
 {
-  node_values_[node] = cap;
+  node_values_[parasitics_->nodeIndex(node)] = cap;
 }
 
 float
 ReduceToPi::downstreamCap(ParasiticNode *node)
 {
-  return node_values_[node];
+  return node_values_[parasitics_->nodeIndex(node)];
 }
 
 ////////////////////////////////////////////////////////////////
@@ -358,8 +360,7 @@ ReduceToPiElmore::reduceElmoreDfs(const Pin *drvr_pin,
     }
   }
   visit(node);
-  ParasiticResistorSeq &resistors = resistor_map_[node];
-  for (ParasiticResistor *resistor : resistors) {
+  for (ParasiticResistor *resistor : resistor_adjacency_.devices(node)) {
     ParasiticNode *onode = parasitics_->otherNode(resistor, node);
     if (resistor != from_res
         && !isVisited(onode)
@@ -378,7 +379,6 @@ class ReduceToPiPoleResidue2 : public ReduceToPi
 {
 public:
   ReduceToPiPoleResidue2(StaState *sta);
-  ~ReduceToPiPoleResidue2() override;
   void findPolesResidues(const Parasitic *parasitic_network,
                          Parasitic *pi_pole_residue,
                          const Pin *drvr_pin,
@@ -419,7 +419,7 @@ private:
 
   // Resistor/capacitor currents.
   ResistorCurrentMap currents_;
-  ParasiticNodeValueMap *moments_ {nullptr};
+  ParasiticNodeValues moments_[4];
 };
 
 ReduceToPiPoleResidue2::ReduceToPiPoleResidue2(StaState *sta) :
@@ -481,18 +481,14 @@ ReduceToPiPoleResidue2::makePiPoleResidue2(const Parasitic *parasitic_network,
   return pi_pole_residue;
 }
 
-ReduceToPiPoleResidue2::~ReduceToPiPoleResidue2()
-{
-  delete [] moments_;
-}
-
 void
 ReduceToPiPoleResidue2::findPolesResidues(const Parasitic *parasitic_network,
                                           Parasitic *pi_pole_residue,
                                           const Pin *drvr_pin,
                                           ParasiticNode *drvr_node)
 {
-  moments_ = new ParasiticNodeValueMap[4];
+  for (ParasiticNodeValues &moments : moments_)
+    moments.assign(parasitics_->nodeCount(parasitic_network), 0.0);
   findMoments(drvr_pin, drvr_node, 4);
 
   PinConnectedPinIterator *pin_iter = network_->connectedPinIterator(drvr_pin);
@@ -536,8 +532,7 @@ ReduceToPiPoleResidue2::findBranchCurrents(const Pin *drvr_pin,
   visit(node);
   double branch_i = 0.0;
   double coupling_cap = 0.0;
-  ParasiticResistorSeq &resistors = resistor_map_[node];
-  for (ParasiticResistor *resistor : resistors) {
+  for (ParasiticResistor *resistor : resistor_adjacency_.devices(node)) {
     ParasiticNode *onode = parasitics_->otherNode(resistor, node);
     // One commercial extractor creates resistors with identical from/to nodes.
     if (onode != node
@@ -547,8 +542,7 @@ ReduceToPiPoleResidue2::findBranchCurrents(const Pin *drvr_pin,
       branch_i += findBranchCurrents(drvr_pin, onode, resistor, moment_index);
     }
   }
-  ParasiticCapacitorSeq &capacitors = capacitor_map_[node];
-  for (ParasiticCapacitor *capacitor : capacitors)
+  for (ParasiticCapacitor *capacitor : capacitor_adjacency_.devices(node))
     coupling_cap += parasitics_->value(capacitor);
 
   double cap = parasitics_->nodeGndCap(node)
@@ -571,8 +565,7 @@ ReduceToPiPoleResidue2::findMoments(const Pin *drvr_pin,
                                     int moment_index)
 {
   visit(node);
-  ParasiticResistorSeq &resistors = resistor_map_[node];
-  for (ParasiticResistor *resistor : resistors) {
+  for (ParasiticResistor *resistor : resistor_adjacency_.devices(node)) {
     ParasiticNode *onode = parasitics_->otherNode(resistor, node);
     // One commercial extractor creates resistors with identical from/to nodes.
     if (onode != node
@@ -601,8 +594,7 @@ ReduceToPiPoleResidue2::moment(ParasiticNode *node,
   if (moment_index == 0)
     return 1.0;
   else {
-    ParasiticNodeValueMap &map = moments_[moment_index];
-    return map[node];
+    return moments_[moment_index][parasitics_->nodeIndex(node)];
   }
 }
 
@@ -613,8 +605,7 @@ ReduceToPiPoleResidue2::setMoment(ParasiticNode *node,
 {
   // Zero'th moments are all 1.
   if (moment_index > 0) {
-    ParasiticNodeValueMap &map = moments_[moment_index];
-    map[node] = moment;
+    moments_[moment_index][parasitics_->nodeIndex(node)] = moment;
   }
 }
 
@@ -90,6 +90,14 @@ INDEX   "*"{POS_INTEGER}
 
 %%
 
+%{
+	if (start_token_) {
+	  int start_token = start_token_;
+	  start_token_ = 0;
+	  return start_token;
+	}
+%}
+
 "*BUS_DELIMITER" { return token::BUS_DELIMITER; }
 "*C2_R1_C1" { return token::C2_R1_C1; }
 "*C" { return token::KW_C; }
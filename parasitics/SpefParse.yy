@@ -86,6 +86,7 @@ class SpefTriple;
 %token D_NET D_PNET R_NET R_PNET END
 %token CONN CAP RES INDUC KW_P KW_I KW_N DRIVER CELL C2_R1_C1 LOADS
 %token RC KW_Q KW_K
+%token HEADER_SECTION NETS_SECTION
 
 %type <int> conf cap_id res_id induc_id cap_elem cap_elems
 %type <int> res_elem res_elems induc_elem induc_elems
@@ -123,15 +124,27 @@ class SpefTriple;
 
 %start file
 
+%initial-action
+{
+  // Sections of the file start on the scanner line.
+  @$.initialize(nullptr, scanner->line());
+}
+
 %%
 
 file:
+	header_sections internal_def
+	/* Parallel reader sections (see SpefReader::readParallel). */
+|	HEADER_SECTION header_sections
+|	NETS_SECTION internal_def
+;
+
+header_sections:
 	header_def
 	name_map
 	power_def
 	external_def
 	define_def
-	internal_def
 ;
 
 /****************************************************************/
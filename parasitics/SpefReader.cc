@@ -24,13 +24,20 @@
 
 #include "SpefReader.hh"
 
+#include <algorithm>
+#include <charconv>
+#include <exception>
+#include <iterator>
+#include <streambuf>
 #include <string>
 #include <string_view>
 #include <utility>
 
 #include "ArcDelayCalc.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Liberty.hh"
+#include "Mutex.hh"
 #include "Network.hh"
 #include "Parasitics.hh"
 #include "PortDirection.hh"
@@ -47,6 +54,15 @@
 
 namespace sta {
 
+// Minimum size of the net sections read in parallel.
+static size_t spef_section_size = 1 << 20;
+
+void
+setSpefSectionSize(size_t size)
+{
+  spef_section_size = std::max(size, size_t(1));
+}
+
 bool
 readSpefFile(std::string_view filename,
              Instance *instance,
@@ -89,6 +105,44 @@ SpefReader::SpefReader(std::string_view filename,
   parasitics->setCouplingCapFactor(coupling_cap_factor);
 }
 
+SpefReader::~SpefReader()
+{
+  // Section readers reduce with their own delay calculator copy.
+  if (header_reader_ && reduce_)
+    delete arc_delay_calc_;
+}
+
+SpefReader::SpefReader(SpefReader *header_reader,
+                       SpefWarningSeq *warnings) :
+  StaState(header_reader),
+  filename_(header_reader->filename_),
+  scanner_(nullptr),
+  instance_(header_reader->instance_),
+  pin_cap_included_(header_reader->pin_cap_included_),
+  keep_coupling_caps_(header_reader->keep_coupling_caps_),
+  coupling_cap_factor_(header_reader->coupling_cap_factor_),
+  reduce_(header_reader->reduce_),
+  scene_(header_reader->scene_),
+  min_max_(header_reader->min_max_),
+  divider_(header_reader->divider_),
+  delimiter_(header_reader->delimiter_),
+  bus_brkt_left_(header_reader->bus_brkt_left_),
+  bus_brkt_right_(header_reader->bus_brkt_right_),
+  triple_index_(header_reader->triple_index_),
+  time_scale_(header_reader->time_scale_),
+  cap_scale_(header_reader->cap_scale_),
+  res_scale_(header_reader->res_scale_),
+  induct_scale_(header_reader->induct_scale_),
+  parasitics_(header_reader->parasitics_),
+  reduce_aps_(header_reader->reduce_aps_),
+  keep_reason_(header_reader->keep_reason_),
+  header_reader_(header_reader),
+  warnings_(warnings)
+{
+  if (reduce_)
+    arc_delay_calc_ = header_reader->arc_delay_calc_->copy();
+}
+
 bool
 SpefReader::read()
 {
@@ -96,19 +150,260 @@ SpefReader::read()
   gzstream::igzstream stream(std::string(filename_).c_str());
   if (stream.is_open()) {
     Stats stats(debug_, report_);
-    SpefScanner scanner(&stream, filename_, this, report_);
-    scanner_ = &scanner;
-    SpefParse parser(&scanner, this);
-    // parser.set_debug_level(1);
-    //  yyparse returns 0 on success.
-    success = (parser.parse() == 0);
+    if (reduce_)
+      findReduceAnalysisPts();
+    // -path networks are completed by nets in other *D_NETs so they
+    // are read serially.
+    if (thread_count_ > 1 && network_->isTopInstance(instance_))
+      success = readParallel(&stream);
+    else
+      success = readSerial(&stream);
     stats.report("Read spef");
+    if (reduce_)
+      reportKeptNetworks();
   }
   else
     throw FileNotReadable(filename_);
   return success;
 }
 
+bool
+SpefReader::readSerial(std::istream *stream)
+{
+  SpefScanner scanner(stream, filename_, this, report_);
+  scanner_ = &scanner;
+  SpefParse parser(&scanner, this);
+  // parser.set_debug_level(1);
+  //  yyparse returns 0 on success.
+  bool success = (parser.parse() == 0);
+  scanner_ = nullptr;
+  return success;
+}
+
+////////////////////////////////////////////////////////////////
+
+// Read only stream buffer over a section of the file text.
+class SpefSectionBuf : public std::streambuf
+{
+public:
+  SpefSectionBuf(std::string_view text)
+  {
+    char *begin = const_cast<char*>(text.data());
+    setg(begin, begin, begin + text.size());
+  }
+};
+
+class SpefSection
+{
+public:
+  std::string text;
+  int line;
+  SpefWarningSeq warnings;
+  std::exception_ptr error;
+  bool success;
+  NetSeq kept_nets;
+  size_t reduced_net_count;
+};
+
+static bool
+isNetKeyword(std::string_view text,
+             size_t pos)
+{
+  std::string_view line = text.substr(pos, 7);
+  return line.starts_with("*D_NET")
+    || line.starts_with("*R_NET")
+    || line.starts_with("*D_PNET")
+    || line.starts_with("*R_PNET");
+}
+
+// Find the first line at or after pos that starts a net.
+static size_t
+findNetBegin(std::string_view text,
+             size_t pos)
+{
+  if (pos > 0) {
+    pos = text.find('\n', pos - 1);
+    if (pos == std::string_view::npos)
+      return text.size();
+    pos++;
+  }
+  while (pos < text.size()) {
+    size_t line_begin = text.find_first_not_of(" \t", pos);
+    if (line_begin != std::string_view::npos
+        && isNetKeyword(text, line_begin))
+      return line_begin;
+    pos = text.find('\n', pos);
+    if (pos == std::string_view::npos)
+      break;
+    pos++;
+  }
+  return text.size();
+}
+
+// Beginning of the last (possibly partial) line of text.
+static size_t
+lastLineBegin(std::string_view text)
+{
+  size_t pos = text.rfind('\n');
+  return (pos == std::string_view::npos) ? 0 : pos + 1;
+}
+
+// Append up to size bytes from stream to text.
+// Return true at the end of the stream.
+static bool
+readText(std::istream *stream,
+         size_t size,
+         std::string &text)
+{
+  size_t begin = text.size();
+  text.resize(begin + size);
+  stream->read(text.data() + begin, size);
+  text.resize(begin + stream->gcount());
+  return !stream->good();
+}
+
+// After the header and name map a spef file is a sequence of independent
+// *D_NET/*R_NET sections. The header is parsed first. The nets are then
+// split at net boundaries into sections that are parsed by section
+// readers in parallel. The file is read a batch of sections at a time so
+// only the header and one batch of text are in memory. Warnings, errors
+// and kept nets are reported in file order so the results match the
+// serial reader.
+bool
+SpefReader::readParallel(std::istream *stream)
+{
+  size_t section_size = spef_section_size;
+  std::string text;
+  bool eof = false;
+  size_t nets_begin = 0;
+  size_t scan_pos = 0;
+  while (true) {
+    eof = readText(stream, section_size, text);
+    nets_begin = findNetBegin(text, scan_pos);
+    if (nets_begin < text.size() || eof)
+      break;
+    scan_pos = lastLineBegin(text);
+  }
+  if (nets_begin == text.size()) {
+    SpefSectionBuf buf(text);
+    std::istream text_stream(&buf);
+    return readSerial(&text_stream);
+  }
+
+  std::string_view text_view(text);
+  if (!parseSection(text_view.substr(0, nets_begin),
+                    SpefParse::token::HEADER_SECTION, 1))
+    return false;
+  int line = std::count(text_view.begin(),
+                        text_view.begin() + nets_begin, '\n') + 1;
+  text.erase(0, nets_begin);
+
+  // Batches are a multiple of the thread count to balance nets with
+  // very different sizes.
+  size_t batch_size = thread_count_ * 4;
+  std::vector<SpefSection> batch;
+  bool success = true;
+  scan_pos = section_size;
+  while (success && !(eof && text.empty())) {
+    size_t section_end = text.size();
+    if (text.size() > section_size) {
+      section_end = findNetBegin(text, scan_pos);
+      if (section_end == text.size() && !eof) {
+        scan_pos = std::max(lastLineBegin(text), section_size);
+        eof = readText(stream, section_size, text);
+        continue;
+      }
+    }
+    else if (!eof) {
+      eof = readText(stream, section_size, text);
+      continue;
+    }
+    std::string section_text = text.substr(0, section_end);
+    text.erase(0, section_end);
+    scan_pos = section_size;
+    int section_line = line;
+    line += std::count(section_text.begin(), section_text.end(), '\n');
+    batch.push_back({std::move(section_text), section_line,
+                     {}, nullptr, false, {}, 0});
+    if (batch.size() == batch_size || (eof && text.empty())) {
+      success = readSections(batch);
+      batch.clear();
+    }
+  }
+  return success;
+}
+
+bool
+SpefReader::readSections(std::vector<SpefSection> &sections)
+{
+  debugPrint(debug_, "spef", 1, "parallel read {} sections", sections.size());
+  for (SpefSection &section : sections) {
+    dispatch_queue_->dispatch([this, &section](size_t) {
+      SpefReader section_reader(this, &section.warnings);
+      try {
+        section.success = section_reader.parseSection(section.text,
+                                                      SpefParse::token::NETS_SECTION,
+                                                      section.line);
+      }
+      catch (...) {
+        section.error = std::current_exception();
+      }
+      section.kept_nets = std::move(section_reader.kept_nets_);
+      section.reduced_net_count = section_reader.reduced_net_count_;
+    });
+  }
+  dispatch_queue_->finishTasks();
+  section_nets_.clear();
+
+  if (duplicate_net_) {
+    // A net has *D_NETs in more than one section so the sections are
+    // read again serially to keep the last definition.
+    debugPrint(debug_, "spef", 1, "serial read for multiple *D_NETs");
+    duplicate_net_ = false;
+    for (SpefSection &section : sections) {
+      if (!parseSection(section.text, SpefParse::token::NETS_SECTION,
+                        section.line))
+        return false;
+    }
+    return true;
+  }
+
+  for (SpefSection &section : sections) {
+    for (const SpefWarning &warning : section.warnings)
+      report_->fileWarn(warning.id, filename_, warning.line, "{}", warning.msg);
+    if (section.error)
+      std::rethrow_exception(section.error);
+    kept_nets_.insert(kept_nets_.end(), section.kept_nets.begin(),
+                      section.kept_nets.end());
+    reduced_net_count_ += section.reduced_net_count;
+    if (!section.success)
+      return false;
+  }
+  return true;
+}
+
+bool
+SpefReader::parseSection(std::string_view text,
+                         int start_token,
+                         int line)
+{
+  SpefSectionBuf buf(text);
+  std::istream stream(&buf);
+  SpefScanner scanner(&stream, filename_, this, report_);
+  scanner.setSection(start_token, line);
+  scanner_ = &scanner;
+  SpefParse parser(&scanner, this);
+  bool success = (parser.parse() == 0);
+  scanner_ = nullptr;
+  return success;
+}
+
+std::mutex &
+SpefReader::netLock()
+{
+  return header_reader_ ? header_reader_->net_lock_ : net_lock_;
+}
+
 void
 SpefReader::setDivider(char divider)
 {
@@ -263,27 +558,59 @@ SpefReader::setInductScale(float scale,
     warn(1644, "unknown units {}.", units);
 }
 
+// Parse the index of a *<index> name.
+static bool
+nameMapIndex(std::string_view name,
+             int &index)
+{
+  auto [ptr, ec] = std::from_chars(name.data() + 1, name.data() + name.size(),
+                                   index);
+  return ec == std::errc();
+}
+
 void
 SpefReader::makeNameMapEntry(std::string_view index,
                              std::string_view name)
 {
-  int i = std::stoi(std::string(index.substr(1)));
-  name_map_[i] = name;
+  int i;
+  if (nameMapIndex(index, i)) {
+    // The entry may name an instance, net or port, so resolve all of them.
+    SpefNameMapEntry entry;
+    entry.name = name;
+    entry.instance = findInstanceRelative(name);
+    entry.net = findNetRelative(name);
+    entry.port_pin = findPortPinRelative(name);
+    name_map_.insert(i, std::move(entry));
+  }
+}
+
+const SpefNameMapEntry *
+SpefReader::nameMapEntry(std::string_view name)
+{
+  const SpefNameMap &name_map = header_reader_
+    ? header_reader_->name_map_
+    : name_map_;
+  int index;
+  if (nameMapIndex(name, index)) {
+    const SpefNameMapEntry *entry = name_map.find(index);
+    if (entry)
+      return entry;
+    warn(1645, "no name map entry for {}.", index);
+  }
+  else
+    warn(1645, "no name map entry for {}.", name);
+  return nullptr;
 }
 
 std::string_view
 SpefReader::nameMapLookup(std::string_view name)
 {
   if (!name.empty() && name[0] == '*') {
-    std::string index_str(name.substr(1));
-    int index = std::stoi(index_str);
-    const auto &itr = name_map_.find(index);
-    if (itr != name_map_.end())
-      return itr->second;
-    else {
-      warn(1645, "no name map entry for {}.", index);
+    const SpefNameMapEntry *entry = nameMapEntry(name);
+    if (entry)
+      return entry->name;
+    else
       return "";
-    }
   }
   else
     return name;
@@ -304,6 +631,37 @@ SpefReader::portDirection(std::string_view spef_dir)
   return direction;
 }
 
+void
+SpefNameMap::insert(int index,
+                    SpefNameMapEntry &&entry)
+{
+  if (index >= 0
+      && static_cast<size_t>(index) < entry_count_ * 2 + 1024) {
+    if (static_cast<size_t>(index) >= entries_.size())
+      entries_.resize(index + 1);
+    entries_[index] = std::move(entry);
+  }
+  else
+    sparse_entries_[index] = std::move(entry);
+  entry_count_++;
+}
+
+const SpefNameMapEntry *
+SpefNameMap::find(int index) const
+{
+  if (index >= 0 && static_cast<size_t>(index) < entries_.size()) {
+    const SpefNameMapEntry &entry = entries_[index];
+    if (!entry.name.empty())
+      return &entry;
+  }
+  auto itr = sparse_entries_.find(index);
+  if (itr != sparse_entries_.end())
+    return &itr->second;
+  return nullptr;
+}
+
+////////////////////////////////////////////////////////////////
+
 void
 SpefReader::setDesignFlow(StringSeq *flow)
 {
@@ -318,21 +676,27 @@ SpefReader::findPin(std::string_view name)
   if (!name.empty()) {
     size_t delim = name.rfind(delimiter_);
     if (delim != std::string::npos) {
-      std::string inst_name_mapped(name.substr(0, delim));
-      std::string_view inst_name = nameMapLookup(inst_name_mapped);
-      if (!inst_name.empty()) {
-        Instance *inst = findInstanceRelative(inst_name);
-        std::string port_name(name.substr(delim + 1, std::string::npos));
-        if (inst) {
-          pin = network_->findPin(inst, port_name);
-          if (pin == nullptr)
-            warn(1647, "pin {}{}{} not found.",
-                 inst_name, delimiter_, port_name);
-        }
-        else
-          warn(1648, "instance {}{}{} not found.",
+      std::string_view inst_name = name.substr(0, delim);
+      std::string_view port_name = name.substr(delim + 1);
+      Instance *inst = nullptr;
+      if (inst_name.starts_with('*')) {
+        const SpefNameMapEntry *entry = nameMapEntry(inst_name);
+        if (entry == nullptr)
+          return nullptr;
+        inst_name = entry->name;
+        inst = entry->instance;
+      }
+      else
+        inst = findInstanceRelative(inst_name);
+      if (inst) {
+        pin = network_->findPin(inst, port_name);
+        if (pin == nullptr)
+          warn(1647, "pin {}{}{} not found.",
                inst_name, delimiter_, port_name);
       }
+      else
+        warn(1648, "instance {}{}{} not found.",
+             inst_name, delimiter_, port_name);
     }
     else {
       pin = findPortPinRelative(name);
@@ -347,11 +711,18 @@ Net *
 SpefReader::findNet(std::string_view name)
 {
   Net *net = nullptr;
-  std::string_view name1 = nameMapLookup(name);
-  if (!name1.empty()) {
-    net = findNetRelative(name1);
+  if (!name.empty() && name[0] == '*') {
+    const SpefNameMapEntry *entry = nameMapEntry(name);
+    if (entry) {
+      net = entry->net;
+      if (net == nullptr)
+        warn(1650, "net {} not found.", entry->name);
+    }
+  }
+  else if (!name.empty()) {
+    net = findNetRelative(name);
     if (net == nullptr)
-      warn(1650, "net {} not found.", name1);
+      warn(1650, "net {} not found.", name);
   }
   return net;
 }
@@ -360,8 +731,10 @@ void
 SpefReader::rspfBegin(Net *net,
                       SpefTriple *total_cap)
 {
-  if (net)
+  if (net) {
+    LockGuard lock(netLock());
     parasitics_->deleteParasitics(net);
+  }
   // Net total capacitance is ignored.
   delete total_cap;
 }
@@ -408,6 +781,14 @@ void
 SpefReader::dspfBegin(Net *net,
                       SpefTriple *total_cap)
 {
+  LockGuard lock(netLock());
+  if (net && header_reader_
+      && !header_reader_->section_nets_.insert(net).second) {
+    // Another section of the batch reads the net. The batch is read
+    // again serially so the last *D_NET replaces the others.
+    header_reader_->duplicate_net_ = true;
+    net = nullptr;
+  }
   if (net) {
     if (network_->isTopInstance(instance_)) {
       parasitics_->deleteReducedParasitics(net);
@@ -440,13 +821,72 @@ void
 SpefReader::dspfFinish()
 {
   if (parasitic_ && reduce_) {
-    arc_delay_calc_->reduceParasitic(parasitic_, net_, scene_, min_max_);
-    parasitics_->deleteParasiticNetwork(net_);
+    if (keep_reason_.empty()) {
+      reduceNetwork();
+      parasitics_->deleteParasiticNetwork(net_);
+      reduced_net_count_++;
+    }
+    else
+      kept_nets_.push_back(net_);
   }
   parasitic_ = nullptr;
   net_ = nullptr;
 }
 
+// Find the analysis points that can use reduced parasitics as each
+// net is read. The reduced parasitics are saved in the scene's parasitics,
+// so only scenes that use the parasitics being read are reduced.
+void
+SpefReader::findReduceAnalysisPts()
+{
+  for (const Scene *scene : scenes_) {
+    if (scene_ == nullptr || scene == scene_) {
+      for (const MinMax *min_max : min_max_->range()) {
+        if (scene->parasitics(min_max) == parasitics_)
+          reduce_aps_.emplace_back(scene, min_max);
+      }
+    }
+  }
+  if (!arc_delay_calc_->reduceSupported())
+    keep_reason_ = sta::format("delay calculator {} does not support reduction",
+                               arc_delay_calc_->name());
+  else if (!network_->isTopInstance(instance_))
+    keep_reason_ = "-path networks are completed by the parent net";
+  else if (reduce_aps_.empty())
+    keep_reason_ = sta::format("parasitics {} are not used by any scene",
+                               parasitics_->name());
+}
+
+void
+SpefReader::reduceNetwork()
+{
+  NetConnectedPinIterator *pin_iter = network_->connectedPinIterator(net_);
+  while (pin_iter->hasNext()) {
+    const Pin *pin = pin_iter->next();
+    if (network_->isDriver(pin)) {
+      for (const RiseFall *rf : RiseFall::range()) {
+        for (auto [scene, min_max] : reduce_aps_)
+          arc_delay_calc_->reduceParasitic(parasitic_, pin, rf, scene, min_max);
+      }
+    }
+  }
+  delete pin_iter;
+}
+
+void
+SpefReader::reportKeptNetworks()
+{
+  debugPrint(debug_, "spef_reduce", 1, "reduced {} nets kept {} nets",
+             reduced_net_count_, kept_nets_.size());
+  if (!kept_nets_.empty()) {
+    report_->warn(1659, "{} nets kept as parasitic networks because {}.",
+                  kept_nets_.size(), keep_reason_);
+    for (const Net *net : kept_nets_)
+      debugPrint(debug_, "spef_reduce", 1, " kept {}",
+                 sdc_network_->pathName(net));
+  }
+}
+
 ParasiticNode *
 SpefReader::findParasiticNode(std::string_view name,
                               bool local_only)
@@ -454,47 +894,71 @@ SpefReader::findParasiticNode(std::string_view name,
   if (!name.empty() && parasitic_) {
     size_t delim = name.rfind(delimiter_);
     if (delim != std::string::npos) {
-      std::string name1_mapped(name.substr(0, delim));
-      std::string name2(name.substr(delim + 1, std::string::npos));
-      std::string_view name1 = nameMapLookup(name1_mapped);
-      if (!name1.empty()) {
-        Instance *inst = findInstanceRelative(name1);
-        if (inst) {
-          // <instance>:<port>
-          Pin *pin = network_->findPin(inst, name2);
-          if (pin) {
-            if (local_only && !network_->isConnected(net_, pin))
-              warn(1651, "{} not connected to net {}.", name1,
-                   sdc_network_->pathName(net_));
-            return parasitics_->ensureParasiticNode(parasitic_, pin, network_);
-          }
-          else
-            warn(1652, "pin {}{}{} not found.",
-                 name1, delimiter_, name2);
+      std::string_view name1 = name.substr(0, delim);
+      std::string_view name2 = name.substr(delim + 1);
+      Instance *inst = nullptr;
+      Net *net = nullptr;
+      if (name1.starts_with('*')) {
+        const SpefNameMapEntry *entry = nameMapEntry(name1);
+        if (entry == nullptr)
+          return nullptr;
+        name1 = entry->name;
+        inst = entry->instance;
+        net = entry->net;
+      }
+      else {
+        inst = findInstanceRelative(name1);
+        if (inst == nullptr)
+          net = findNetRelative(name1);
+      }
+      if (inst) {
+        // <instance>:<port>
+        Pin *pin = network_->findPin(inst, name2);
+        if (pin) {
+          if (local_only && !network_->isConnected(net_, pin))
+            warn(1651, "{} not connected to net {}.", name1,
+                 sdc_network_->pathName(net_));
+          return parasitics_->ensureParasiticNode(parasitic_, pin, network_);
         }
-        else {
-          Net *net = findNet(name1);
-          if (net) {
-            // <net>:<subnode_id>
-            if (isDigits(name2)) {
-              uint32_t id = std::stoi(name2);
-              if (local_only && !network_->isConnected(net, net_))
-                warn(1653, "{}{}{} not connected to net {}.",
-                     name1, delimiter_, name2, network_->pathName(net_));
-              return parasitics_->ensureParasiticNode(parasitic_, net, id, network_);
-            }
-            else
-              warn(1654, "node {}{}{} not a pin or net:number",
-                   name1, delimiter_, name2);
-          }
+        else
+          warn(1652, "pin {}{}{} not found.",
+               name1, delimiter_, name2);
+      }
+      else if (net) {
+        // <net>:<subnode_id>
+        uint32_t id;
+        auto [ptr, ec] = std::from_chars(name2.data(),
+                                         name2.data() + name2.size(), id);
+        if (!name2.empty() && ec == std::errc()
+            && ptr == name2.data() + name2.size()) {
+          if (local_only && !network_->isConnected(net, net_))
+            warn(1653, "{}{}{} not connected to net {}.",
+                 name1, delimiter_, name2, network_->pathName(net_));
+          return parasitics_->ensureParasiticNode(parasitic_, net, id, network_);
         }
+        else
+          warn(1654, "node {}{}{} not a pin or net:number",
+               name1, delimiter_, name2);
       }
+      else
+        warn(1650, "net {} not found.", name1);
     }
     else {
       // <top_level_port>
-      std::string_view name1 = nameMapLookup(name);
+      Pin *pin = nullptr;
+      std::string_view name1 = name;
+      if (name[0] == '*') {
+        const SpefNameMapEntry *entry = nameMapEntry(name);
+        if (entry) {
+          name1 = entry->name;
+          pin = entry->port_pin;
+        }
+        else
+          name1 = "";
+      }
+      else
+        pin = findPortPinRelative(name);
       if (!name1.empty()) {
-        Pin *pin = findPortPinRelative(name1);
         if (pin) {
           if (local_only && !network_->isConnected(net_, pin))
             warn(1655, "{} not connected to net {}.", name1,
@@ -620,6 +1084,14 @@ SpefScanner::SpefScanner(std::istream *stream,
 {
 }
 
+void
+SpefScanner::setSection(int start_token,
+                        int line)
+{
+  start_token_ = start_token;
+  yylineno = line;
+}
+
 void
 SpefScanner::error(std::string_view msg)
 {
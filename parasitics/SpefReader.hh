@@ -55,4 +55,8 @@ readSpefFile(std::string_view filename,
              Parasitics *parasitics,
              StaState *sta);
 
+// Minimum size in bytes of the net sections that are read in parallel.
+void
+setSpefSectionSize(size_t size);
+
 } // namespace sta
@@ -24,9 +24,14 @@
 
 #pragma once
 
+#include <istream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "NetworkClass.hh"
 #include "ParasiticsClass.hh"
@@ -37,13 +42,52 @@
 namespace sta {
 
 class Report;
+class MinMax;
 class MinMaxAll;
 class SpefRspfPi;
 class SpefTriple;
 class Scene;
 class SpefScanner;
+class SpefSection;
 
-using SpefNameMap = std::map<int, std::string>;
+// *NAME_MAP entry with the instance, net and top level port pin
+// the name resolves to, looked up once when the entry is read.
+class SpefNameMapEntry
+{
+public:
+  std::string name;
+  Instance *instance{nullptr};
+  Net *net{nullptr};
+  Pin *port_pin{nullptr};
+};
+
+// *NAME_MAP indices are usually dense, so entries are indexed by a vector.
+// Sparse indices far beyond the entry count use a map.
+class SpefNameMap
+{
+public:
+  void insert(int index,
+              SpefNameMapEntry &&entry);
+  const SpefNameMapEntry *find(int index) const;
+
+private:
+  std::vector<SpefNameMapEntry> entries_;
+  std::map<int, SpefNameMapEntry> sparse_entries_;
+  size_t entry_count_{0};
+};
+using SpefReduceAnalysisPts = std::vector<std::pair<const Scene*, const MinMax*>>;
+using SpefNetSet = std::unordered_set<const Net*>;
+
+// Warning saved by a parallel section reader to report in file order.
+class SpefWarning
+{
+public:
+  int id;
+  int line;
+  std::string msg;
+};
+
+using SpefWarningSeq = std::vector<SpefWarning>;
 
 class SpefReader : public StaState
 {
@@ -58,7 +102,10 @@ public:
              const MinMaxAll *min_max,
              Parasitics *parasitics,
              StaState *sta);
-  ~SpefReader() override = default;
+  // Reader for a section of the nets in the file read by header_reader.
+  SpefReader(SpefReader *header_reader,
+             SpefWarningSeq *warnings);
+  ~SpefReader() override;
   bool read();
   char divider() const { return divider_; }
   void setDivider(char divider);
@@ -80,6 +127,8 @@ public:
   void makeNameMapEntry(std::string_view index,
                         std::string_view name);
   std::string_view nameMapLookup(std::string_view name);
+  // Name map entry for a *<index> name.
+  const SpefNameMapEntry *nameMapEntry(std::string_view name);
   void setDesignFlow(StringSeq *flow_keys);
   Pin *findPin(std::string_view name);
   Net *findNet(std::string_view name);
@@ -112,11 +161,24 @@ public:
             std::string_view fmt,
             Args &&...args)
   {
-    report_->fileWarn(id, filename_, warnLine(), fmt,
-                     std::forward<Args>(args)...);
+    if (warnings_) {
+      if (!report_->isSuppressed(id))
+        warnings_->emplace_back(id, warnLine(),
+                                sta::vformat(fmt, sta::make_format_args(args...)));
+    }
+    else
+      report_->fileWarn(id, filename_, warnLine(), fmt,
+                        std::forward<Args>(args)...);
   }
 
 private:
+  bool readSerial(std::istream *stream);
+  bool readParallel(std::istream *stream);
+  bool readSections(std::vector<SpefSection> &sections);
+  bool parseSection(std::string_view text,
+                    int start_token,
+                    int line);
+  std::mutex &netLock();
   Pin *findPinRelative(std::string_view name);
   Pin *findPortPinRelative(std::string_view name);
   Net *findNetRelative(std::string_view name);
@@ -124,6 +186,9 @@ private:
   std::string stripped(std::string_view spef_name) const;
   ParasiticNode *findParasiticNode(std::string_view name,
                                    bool local_only);
+  void findReduceAnalysisPts();
+  void reduceNetwork();
+  void reportKeptNetworks();
 
   std::string_view filename_;
   SpefScanner *scanner_;
@@ -150,6 +215,25 @@ private:
   StringSeq design_flow_;
   Parasitics *parasitics_;
   Parasitic *parasitic_{nullptr};
+  // Reduce on read state.
+  // Scene/min_max analysis points that use parasitics_.
+  SpefReduceAnalysisPts reduce_aps_;
+  // Why parasitic networks cannot be reduced as they are read.
+  std::string keep_reason_;
+  // Nets with -reduce that are kept as parasitic networks.
+  NetSeq kept_nets_;
+  size_t reduced_net_count_{0};
+
+  // Parallel read state.
+  // Section readers share the header reader's name map and net lock.
+  SpefReader *header_reader_{nullptr};
+  SpefWarningSeq *warnings_{nullptr};
+  // Serializes parasitics edits that use shared network/parasitics state.
+  std::mutex net_lock_;
+  // Nets read by the section readers of a batch, to catch nets with
+  // multiple *D_NETs.
+  SpefNetSet section_nets_;
+  bool duplicate_net_{false};
 };
 
 class SpefTriple
@@ -53,6 +53,11 @@ public:
 
   void error(std::string_view msg);
   int line() const {  return yylineno; }
+  // Scan a section of the file that starts at line.
+  // start_token is returned before the section tokens to select
+  // the section grammar.
+  void setSection(int start_token,
+                  int line);
 
   // Get rid of override virtual function warning.
   using FlexLexer::yylex;
@@ -62,6 +67,7 @@ private:
   SpefReader *reader_;
   Report *report_;
   std::string token_;
+  int start_token_{0};
 };
 
 } // namespace sta
@@ -1,3 +1,4 @@
+#include <cstdio>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -1372,7 +1373,7 @@ TEST_F(StaParasiticsTest, ParasiticNetworkIncludesPinCaps) {
   EXPECT_TRUE(pnet2.includesPinCaps());
 }
 
-// Test ConcreteParasiticNetwork addResistor/addCapacitor
+// Test ConcreteParasiticNetwork makeResistor/makeCapacitor
 TEST_F(StaParasiticsTest, ParasiticNetworkAddDevices) {
   const Network *network = sta_->network();
   ConcreteParasiticNetwork pnet(nullptr, false, network);
@@ -1381,13 +1382,11 @@ TEST_F(StaParasiticsTest, ParasiticNetworkAddDevices) {
   ConcreteParasiticNode *node2 = new ConcreteParasiticNode(static_cast<const Net*>(nullptr), 2, false);
 
   // We need to add nodes to the network; use sub_nodes_ directly is tricky
-  // Instead use the add methods for devices
-  ConcreteParasiticResistor *res = new ConcreteParasiticResistor(0, 100.0f, node1, node2);
-  pnet.addResistor(res);
+  // Instead use the make methods for devices
+  pnet.makeResistor(0, 100.0f, node1, node2);
   EXPECT_EQ(pnet.resistors().size(), 1u);
 
-  ConcreteParasiticCapacitor *cap = new ConcreteParasiticCapacitor(0, 5e-15f, node1, node2);
-  pnet.addCapacitor(cap);
+  pnet.makeCapacitor(0, 5e-15f, node1, node2);
   EXPECT_EQ(pnet.capacitors().size(), 1u);
 
   // Capacitance includes coupling capacitors
@@ -1636,8 +1635,7 @@ TEST_F(StaParasiticsTest, ParasiticNetworkCapacitanceMixed) {
   node2->incrCapacitance(7e-15f);
 
   // Add coupling cap
-  ConcreteParasiticCapacitor *cap = new ConcreteParasiticCapacitor(0, 2e-15f, node1, node2);
-  pnet.addCapacitor(cap);
+  pnet.makeCapacitor(0, 2e-15f, node1, node2);
 
   // Total capacitance = grounded caps on non-external nodes + coupling caps
   // But our nodes aren't in the network's node maps, so they won't be counted
@@ -1887,15 +1885,34 @@ TEST_F(ReduceParasiticsTest, DeleteParasiticsNetApt) {
 // Design-loading tests to exercise parasitic reduction and
 // functions that require a fully loaded design
 
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
+
 #include "Network.hh"
 #include "Graph.hh"
+#include "Error.hh"
 #include "Sdc.hh"
 #include "Search.hh"
 #include "StaState.hh"
 #include "parasitics/ReportParasiticAnnotation.hh"
+#include "parasitics/SpefReader.hh"
 
 namespace sta {
 
+// Make a unique temporary file name starting with prefix.
+static std::string
+makeTmpFilename(const char *prefix)
+{
+  std::filesystem::path path = std::filesystem::temp_directory_path()
+    / (std::string(prefix) + "XXXXXX");
+  std::string filename = path.string();
+  int fd = mkstemp(filename.data());
+  if (fd >= 0)
+    close(fd);
+  return filename;
+}
+
 // Test fixture that loads the ASAP7 reg1 design with SPEF
 class DesignParasiticsTest : public ::testing::Test {
 protected:
@@ -2375,27 +2392,25 @@ TEST_F(StaParasiticsTest, ParasiticNetworkFindNodeMissing) {
   EXPECT_EQ(node, nullptr);
 }
 
-// Test ConcreteParasiticNetwork addResistor with standalone nodes
-// Covers: ConcreteParasiticNetwork::addResistor
+// Test ConcreteParasiticNetwork makeResistor with standalone nodes
+// Covers: ConcreteParasiticNetwork::makeResistor
 TEST_F(StaParasiticsTest, ParasiticNetworkAddResistorStandalone) {
   const Network *network = sta_->network();
   ConcreteParasiticNetwork pnet(nullptr, false, network);
   ConcreteParasiticNode node1(static_cast<const Net*>(nullptr), 1, false);
   ConcreteParasiticNode node2(static_cast<const Net*>(nullptr), 2, false);
-  ConcreteParasiticResistor *res = new ConcreteParasiticResistor(0, 100.0f, &node1, &node2);
-  pnet.addResistor(res);
+  pnet.makeResistor(0, 100.0f, &node1, &node2);
   EXPECT_EQ(pnet.resistors().size(), 1u);
 }
 
-// Test ConcreteParasiticNetwork addCapacitor with standalone nodes
-// Covers: ConcreteParasiticNetwork::addCapacitor
+// Test ConcreteParasiticNetwork makeCapacitor with standalone nodes
+// Covers: ConcreteParasiticNetwork::makeCapacitor
 TEST_F(StaParasiticsTest, ParasiticNetworkAddCapacitorStandalone) {
   const Network *network = sta_->network();
   ConcreteParasiticNetwork pnet(nullptr, false, network);
   ConcreteParasiticNode node1(static_cast<const Net*>(nullptr), 1, false);
   ConcreteParasiticNode node2(static_cast<const Net*>(nullptr), 2, false);
-  ConcreteParasiticCapacitor *cap = new ConcreteParasiticCapacitor(0, 5e-15f, &node1, &node2);
-  pnet.addCapacitor(cap);
+  pnet.makeCapacitor(0, 5e-15f, &node1, &node2);
   EXPECT_EQ(pnet.capacitors().size(), 1u);
 }
 
@@ -2577,4 +2592,218 @@ TEST_F(DesignParasiticsTest, ReduceToPiElmoreWithNetwork) {
   EXPECT_TRUE(success);
 }
 
+// Test that the parallel spef reader builds the same networks as the serial reader.
+TEST_F(DesignParasiticsTest, ReadSpefParallelMatchesSerial) {
+  ASSERT_TRUE(design_loaded_);
+  Scene *corner = sta_->cmdScene();
+  Instance *top = sta_->network()->topInstance();
+  sta_->setThreadCount(1);
+  bool success = sta_->readSpef("serial", "test/reg1_asap7.spef", top, corner,
+                                MinMaxAll::all(), false, false, 1.0f, false);
+  ASSERT_TRUE(success);
+  sta_->setThreadCount(4);
+  // Small sections so the nets are split across sections and batches.
+  setSpefSectionSize(128);
+  success = sta_->readSpef("parallel", "test/reg1_asap7.spef", top, corner,
+                           MinMaxAll::all(), false, false, 1.0f, false);
+  setSpefSectionSize(1 << 20);
+  ASSERT_TRUE(success);
+
+  Parasitics *serial = sta_->findParasitics("serial");
+  Parasitics *parallel = sta_->findParasitics("parallel");
+  ASSERT_NE(serial, nullptr);
+  ASSERT_NE(parallel, nullptr);
+  Network *network = sta_->network();
+  NetIterator *net_iter = network->netIterator(top);
+  int network_count = 0;
+  while (net_iter->hasNext()) {
+    const Net *net = net_iter->next();
+    Parasitic *serial_network = serial->findParasiticNetwork(net);
+    Parasitic *parallel_network = parallel->findParasiticNetwork(net);
+    EXPECT_EQ(serial_network == nullptr, parallel_network == nullptr);
+    if (serial_network && parallel_network) {
+      EXPECT_EQ(serial->nodes(serial_network).size(),
+                parallel->nodes(parallel_network).size());
+      EXPECT_EQ(serial->resistors(serial_network).size(),
+                parallel->resistors(parallel_network).size());
+      EXPECT_FLOAT_EQ(serial->capacitance(serial_network),
+                      parallel->capacitance(parallel_network));
+      network_count++;
+    }
+  }
+  delete net_iter;
+  EXPECT_GT(network_count, 0);
+}
+
+// The last *D_NET of a net with multiple definitions is kept, like the
+// serial reader, when the definitions are read in parallel sections.
+TEST_F(DesignParasiticsTest, ReadSpefParallelDuplicateNet) {
+  ASSERT_TRUE(design_loaded_);
+  std::string filename = makeTmpFilename("sta_spef_dup");
+  {
+    std::ifstream spef("test/reg1_asap7.spef");
+    std::ofstream dup_spef(filename);
+    dup_spef << spef.rdbuf();
+    dup_spef << "\n*D_NET u1z 20.0\n"
+             << "*CONN\n"
+             << "*I u1:Y O\n"
+             << "*I u2:B I *L .0086\n"
+             << "*CAP\n"
+             << "1 u1:Y 10.0\n"
+             << "2 u2:B 10.0\n"
+             << "*RES\n"
+             << "3 u1:Y u2:B 5.0\n"
+             << "*END\n";
+  }
+  Scene *corner = sta_->cmdScene();
+  Instance *top = sta_->network()->topInstance();
+  sta_->setThreadCount(1);
+  bool success = sta_->readSpef("serial", filename, top, corner,
+                                MinMaxAll::all(), false, false, 1.0f, false);
+  ASSERT_TRUE(success);
+  sta_->setThreadCount(4);
+  setSpefSectionSize(128);
+  success = sta_->readSpef("parallel", filename, top, corner,
+                           MinMaxAll::all(), false, false, 1.0f, false);
+  setSpefSectionSize(1 << 20);
+  std::remove(filename.c_str());
+  ASSERT_TRUE(success);
+
+  Net *net = sta_->network()->findNet("u1z");
+  ASSERT_NE(net, nullptr);
+  Parasitics *serial = sta_->findParasitics("serial");
+  Parasitics *parallel = sta_->findParasitics("parallel");
+  Parasitic *serial_network = serial->findParasiticNetwork(net);
+  Parasitic *parallel_network = parallel->findParasiticNetwork(net);
+  ASSERT_NE(serial_network, nullptr);
+  ASSERT_NE(parallel_network, nullptr);
+  EXPECT_FLOAT_EQ(serial->capacitance(serial_network), 20e-15);
+  EXPECT_FLOAT_EQ(parallel->capacitance(parallel_network),
+                  serial->capacitance(serial_network));
+}
+
+// Test that reduced models read from a parasitics cache match the spef reduction.
+TEST_F(DesignParasiticsTest, ParasiticsCacheRoundTrip) {
+  ASSERT_TRUE(design_loaded_);
+  Scene *corner = sta_->cmdScene();
+  Instance *top = sta_->network()->topInstance();
+  // Parasitics that were not read from a spef file cannot be cached.
+  std::string cache_filename = makeTmpFilename("sta_parasitics_cache");
+  const char *filename = cache_filename.c_str();
+  EXPECT_THROW(sta_->writeParasiticsCache("", filename), Exception);
+
+  bool success = sta_->readSpef("", "test/reg1_asap7.spef", top, corner,
+                                MinMaxAll::all(), false, false, 1.0f, true);
+  ASSERT_TRUE(success);
+  EXPECT_NE(sta_->findParasitics("default")->spefHash(), 0u);
+  sta_->writeParasiticsCache("", filename);
+  success = sta_->readParasiticsCache("cached", filename, "");
+  ASSERT_TRUE(success);
+
+  Parasitics *spef = sta_->findParasitics("default");
+  Parasitics *cached = sta_->findParasitics("cached");
+  ASSERT_NE(cached, nullptr);
+  Network *network = sta_->network();
+  Pin *drvr_pin = network->findPin("u1/Y");
+  ASSERT_NE(drvr_pin, nullptr);
+  for (const MinMax *min_max : MinMax::range()) {
+    for (const RiseFall *rf : RiseFall::range()) {
+      Parasitic *spef_pi = spef->findPiElmore(drvr_pin, rf, min_max);
+      Parasitic *cached_pi = cached->findPiElmore(drvr_pin, rf, min_max);
+      ASSERT_NE(spef_pi, nullptr);
+      ASSERT_NE(cached_pi, nullptr);
+      float c2, rpi, c1, cached_c2, cached_rpi, cached_c1;
+      spef->piModel(spef_pi, c2, rpi, c1);
+      cached->piModel(cached_pi, cached_c2, cached_rpi, cached_c1);
+      EXPECT_FLOAT_EQ(c2, cached_c2);
+      EXPECT_FLOAT_EQ(rpi, cached_rpi);
+      EXPECT_FLOAT_EQ(c1, cached_c1);
+      for (const Pin *load_pin : spef->loads(drvr_pin)) {
+        float elmore, cached_elmore;
+        bool exists, cached_exists;
+        spef->findElmore(spef_pi, load_pin, elmore, exists);
+        cached->findElmore(cached_pi, load_pin, cached_elmore, cached_exists);
+        EXPECT_EQ(exists, cached_exists);
+        if (exists) {
+          EXPECT_FLOAT_EQ(elmore, cached_elmore);
+        }
+      }
+    }
+  }
+
+  // A file with different contents does not match the cache.
+  success = sta_->readParasiticsCache("stale", filename,
+                                      "test/reg1_asap7.v");
+  EXPECT_FALSE(success);
+
+  // A string length past the end of the file is not allocated.
+  std::string bad_filename = makeTmpFilename("sta_parasitics_cache_bad");
+  {
+    // magic, version, netlist hash, spef hash
+    char header[28];
+    std::ifstream in(cache_filename, std::ios::binary);
+    in.read(header, sizeof(header));
+    std::ofstream out(bad_filename, std::ios::binary);
+    out.write(header, sizeof(header));
+    uint32_t length = 0xffffffff;
+    out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+  }
+  EXPECT_THROW(sta_->readParasiticsCache("bad_length", bad_filename.c_str(), ""),
+               Exception);
+  std::remove(bad_filename.c_str());
+
+  // A truncated cache makes no models.
+  std::filesystem::resize_file(cache_filename,
+                               std::filesystem::file_size(cache_filename) - 8);
+  EXPECT_THROW(sta_->readParasiticsCache("truncated", filename, ""), Exception);
+  Parasitics *truncated = sta_->findParasitics("truncated");
+  ASSERT_NE(truncated, nullptr);
+  for (const RiseFall *rf : RiseFall::range()) {
+    EXPECT_EQ(truncated->findPiElmore(drvr_pin, rf, MinMax::max()), nullptr);
+    EXPECT_EQ(truncated->findPiPoleResidue(drvr_pin, rf, MinMax::max()), nullptr);
+  }
+  std::remove(filename);
+}
+
+// Test that pool allocated nodes have dense indices and that the
+// resistor adjacency matches the node resistor map.
+TEST_F(DesignParasiticsTest, ParasiticNetworkNodeIndexAdjacency) {
+  ASSERT_TRUE(design_loaded_);
+  Scene *corner = sta_->cmdScene();
+  Instance *top = sta_->network()->topInstance();
+  bool success = sta_->readSpef("", "test/reg1_asap7.spef", top, corner,
+                                MinMaxAll::all(), false, false, 1.0f, false);
+  ASSERT_TRUE(success);
+  Parasitics *parasitics = sta_->findParasitics("default");
+  Network *network = sta_->network();
+  NetIterator *net_iter = network->netIterator(top);
+  int network_count = 0;
+  while (net_iter->hasNext()) {
+    const Net *net = net_iter->next();
+    Parasitic *parasitic = parasitics->findParasiticNetwork(net);
+    if (parasitic) {
+      ParasiticNodeSeq nodes = parasitics->nodes(parasitic);
+      size_t node_count = parasitics->nodeCount(parasitic);
+      EXPECT_EQ(nodes.size(), node_count);
+      std::vector<bool> seen(node_count);
+      ParasiticNodeResistorMap resistor_map =
+        parasitics->parasiticNodeResistorMap(parasitic);
+      ParasiticResistorAdjacency adjacency(parasitic, parasitics);
+      for (ParasiticNode *node : nodes) {
+        uint32_t index = parasitics->nodeIndex(node);
+        ASSERT_LT(index, node_count);
+        EXPECT_FALSE(seen[index]);
+        seen[index] = true;
+        auto resistors = adjacency.devices(node);
+        ParasiticResistorSeq adjacency_resistors(resistors.begin(),
+                                                 resistors.end());
+        EXPECT_EQ(adjacency_resistors, resistor_map[node]);
+      }
+      network_count++;
+    }
+  }
+  delete net_iter;
+  EXPECT_GT(network_count, 0);
+}
+
 } // namespace sta
@@ -0,0 +1,79 @@
+# Test set_net_parasitics network edits and argument errors
+
+read_liberty ../../test/asap7/asap7sc7p5t_SEQ_RVT_FF_nldm_220123.lib
+read_liberty ../../test/asap7/asap7sc7p5t_INVBUF_RVT_FF_nldm_220122.lib.gz
+read_liberty ../../test/asap7/asap7sc7p5t_SIMPLE_RVT_FF_nldm_211120.lib.gz
+read_liberty ../../test/asap7/asap7sc7p5t_OA_RVT_FF_nldm_211120.lib.gz
+read_liberty ../../test/asap7/asap7sc7p5t_AO_RVT_FF_nldm_211120.lib.gz
+
+read_verilog ../../test/reg1_asap7.v
+link_design top
+
+create_clock -name clk -period 500 {clk1 clk2 clk3}
+set_input_delay -clock clk 1 {in1 in2}
+set_output_delay -clock clk 1 [get_ports out]
+set_input_transition 10 {in1 in2 clk1 clk2 clk3}
+
+# Return the message id of the error thrown by cmd.
+proc error_id { cmd } {
+  if { [catch { uplevel 1 $cmd } msg] } {
+    if { [regexp {Error:? ([0-9]+)} $msg ignore id] } {
+      return $id
+    }
+    return $msg
+  }
+  return "none"
+}
+
+#---------------------------------------------------------------
+# Replace the network of a net
+#---------------------------------------------------------------
+puts "--- set_net_parasitics r1q ---"
+set_net_parasitics -resistors {{r1/Q 1 0.01} {1 u2/A 0.02}} \
+  -capacitors {{1 0.5} {u2/A 0.2}} r1q
+report_parasitic_annotation
+
+# The load u2/B of u1z has no node.
+puts "--- set_net_parasitics u1z partial ---"
+set_net_parasitics -capacitors {{u1/Y 0.5}} u1z
+report_parasitic_annotation
+
+puts "--- set_net_parasitics -edit u1z ---"
+set_net_parasitics -edit -resistors {{u1/Y u2/B 0.01}} \
+  -capacitors {{u2/B 0.3}} u1z
+report_parasitic_annotation
+
+#---------------------------------------------------------------
+# Errors
+#---------------------------------------------------------------
+puts "--- set_net_parasitics errors ---"
+puts "bad resistor: [error_id {set_net_parasitics -resistors {{r1/Q 1}} r1q}]"
+puts "bad capacitor: [error_id {set_net_parasitics -capacitors {{r1/Q}} r1q}]"
+puts "unknown pin: [error_id {set_net_parasitics -capacitors {{nosuch/A 0.5}} r1q}]"
+puts "pin not on net: [error_id {set_net_parasitics -capacitors {{u1/A 0.5}} r1q}]"
+puts "unknown parasitics: [error_id {set_net_parasitics -name nosuch -capacitors {{r1/Q 0.5}} r1q}]"
+# Errors do not leave a partial network.
+report_parasitic_annotation
+
+#---------------------------------------------------------------
+# -reduce deletes the network so it cannot be edited
+#---------------------------------------------------------------
+puts "--- set_net_parasitics -reduce r2q ---"
+set_net_parasitics -reduce -resistors {{r2/Q u1/A 0.01}} \
+  -capacitors {{u1/A 0.4}} r2q
+puts "edit reduced: [error_id {set_net_parasitics -edit -capacitors {{r2/Q 0.1}} r2q}]"
+
+#---------------------------------------------------------------
+# Hierarchical nets
+#---------------------------------------------------------------
+puts "--- set_net_parasitics hierarchical ---"
+read_liberty ../../test/nangate45/Nangate45_typ.lib
+read_verilog ../../network/test/network_hier_test.v
+link_design network_hier_test
+
+# sub1/and_gate/A1 is on sub1/A, which is connected to w1.
+puts "lower pin: [error_id {set_net_parasitics -resistors {{buf_in/Z sub1/and_gate/A1 0.01}} -capacitors {{sub1/and_gate/A1 0.5}} w1}]"
+# The lower net names the network of its highest connected net.
+puts "edit lower net: [error_id {set_net_parasitics -edit -capacitors {{sub1/and_gate/A1 0.1}} sub1/A}]"
+puts "lower pin not on net: [error_id {set_net_parasitics -capacitors {{sub2/and_gate/A1 0.5}} w1}]"
+puts "top port: [error_id {set_net_parasitics -resistors {{in2 sub1/and_gate/A2 0.01}} in2}]"
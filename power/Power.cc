@@ -119,6 +119,11 @@ Power::clear()
   activity_map_.clear();
   activities_valid_ = false;
   instance_powers_.clear();
+  group_powers_.fill(PowerResult());
+  instance_powers_valid_ = false;
+  invalid_activity_pins_.clear();
+  invalid_regs_.clear();
+  invalid_power_insts_.clear();
 }
 
 void
@@ -126,6 +131,17 @@ Power::activitiesInvalid()
 {
   activities_valid_ = false;
   instance_powers_valid_ = false;
+  invalid_activity_pins_.clear();
+  invalid_regs_.clear();
+  invalid_power_insts_.clear();
+}
+
+// Propagate from pin when activities are updated.
+void
+Power::activityInvalid(const Pin *pin)
+{
+  if (activities_valid_)
+    invalid_activity_pins_.insert(pin);
 }
 
 void
@@ -167,7 +183,7 @@ Power::setInputPortActivity(const Port *input_port,
   const Pin *pin = network_->findPin(top_inst, input_port);
   if (pin) {
     user_activity_map_[pin] = {density, duty, PwrActivityOrigin::user};
-    activitiesInvalid();
+    activityInvalid(pin);
   }
 }
 
@@ -178,7 +194,7 @@ Power::unsetInputPortActivity(const Port *input_port)
   const Pin *pin = network_->findPin(top_inst, input_port);
   if (pin) {
     user_activity_map_.erase(pin);
-    activitiesInvalid();
+    activityInvalid(pin);
   }
 }
 
@@ -189,14 +205,14 @@ Power::setUserActivity(const Pin *pin,
                        PwrActivityOrigin origin)
 {
   user_activity_map_[pin] = {density, duty, origin};
-  activitiesInvalid();
+  activityInvalid(pin);
 }
 
 void
 Power::unsetUserActivity(const Pin *pin)
 {
   user_activity_map_.erase(pin);
-  activitiesInvalid();
+  activityInvalid(pin);
 }
 
 PwrActivity &
@@ -219,6 +235,9 @@ Power::setActivity(const Pin *pin,
              network_->pathName(pin), activity.density(), activity.duty(),
              pwr_activity_origin_map.find(activity.origin()));
   activity_map_[pin] = activity;
+  if (activities_valid_)
+    // Updating activities from edits.
+    invalid_power_insts_.insert(network_->instance(pin));
 }
 
 PwrActivity &
@@ -241,7 +260,8 @@ Power::setSeqActivity(const Instance *reg,
                       PwrActivity &activity)
 {
   seq_activity_map_[SeqPin(reg, output)] = activity;
-  activitiesInvalid();
+  if (activities_valid_)
+    invalid_power_insts_.insert(reg);
 }
 
 bool
@@ -424,32 +444,33 @@ Power::power(const Scene *scene,
              PowerResult &macro,
              PowerResult &pad)
 {
-  total.clear();
-  sequential.clear();
-  combinational.clear();
-  clock.clear();
-  macro.clear();
-  pad.clear();
-
   ensureActivities(scene);
   ensureInstPowers();
-  ClkNetwork *clk_network = scene_->mode()->clkNetwork();
-  for (auto [inst, inst_power] : instance_powers_) {
-    LibertyCell *cell = network_->libertyCell(inst);
-    if (cell) {
-      if (cell->isMacro() || cell->isMemory() || cell->interfaceTiming())
-        macro.incr(inst_power);
-      else if (cell->isPad())
-        pad.incr(inst_power);
-      else if (inClockNetwork(inst, clk_network))
-        clock.incr(inst_power);
-      else if (cell->isSequential())
-        sequential.incr(inst_power);
-      else
-        combinational.incr(inst_power);
-      total.incr(inst_power);
-    }
-  }
+  sequential = group_powers_[static_cast<size_t>(PowerGroup::sequential)];
+  combinational = group_powers_[static_cast<size_t>(PowerGroup::combinational)];
+  clock = group_powers_[static_cast<size_t>(PowerGroup::clock)];
+  macro = group_powers_[static_cast<size_t>(PowerGroup::macro)];
+  pad = group_powers_[static_cast<size_t>(PowerGroup::pad)];
+  total.clear();
+  for (const PowerResult &group_power : group_powers_)
+    total.incr(group_power);
+}
+
+PowerGroup
+Power::powerGroup(const Instance *inst,
+                  const LibertyCell *cell,
+                  const ClkNetwork *clk_network)
+{
+  if (cell->isMacro() || cell->isMemory() || cell->interfaceTiming())
+    return PowerGroup::macro;
+  else if (cell->isPad())
+    return PowerGroup::pad;
+  else if (inClockNetwork(inst, clk_network))
+    return PowerGroup::clock;
+  else if (cell->isSequential())
+    return PowerGroup::sequential;
+  else
+    return PowerGroup::combinational;
 }
 
 bool
@@ -479,8 +500,10 @@ Power::power(const Instance *inst,
     powerInside(inst, scene, result);
     return result;
   }
-  else
-    return instance_powers_[inst];
+  else {
+    const InstGroupPower *inst_power = findKeyValuePtr(instance_powers_, inst);
+    return inst_power ? inst_power->first : PowerResult();
+  }
 }
 
 void
@@ -493,8 +516,11 @@ Power::powerInside(const Instance *hinst,
     Instance *child = child_iter->next();
     if (network_->isHierarchical(child))
       powerInside(child, scene, result);
-    else
-      result.incr(instance_powers_[child]);
+    else {
+      const InstGroupPower *inst_power = findKeyValuePtr(instance_powers_, child);
+      if (inst_power)
+        result.incr(inst_power->first);
+    }
   }
   delete child_iter;
 }
@@ -788,8 +814,25 @@ Power::evalActivity(FuncExpr *expr,
                     const Instance *inst)
 {
   LibertyPort *func_port = expr->port();
+  const FuncTruthTable *truth_table = expr->truthTable();
+  std::array<float, FuncTruthTable::max_var_count> var_duties;
+  std::array<float, FuncTruthTable::max_var_count> var_densities;
   if (func_port && func_port->direction()->isInternal())
     return findSeqActivity(inst, func_port);
+  else if (truth_table
+           && findVarActivities(truth_table, inst, var_duties, var_densities)) {
+    float duty = truth_table->probability(truth_table->ones(),
+                                          var_duties.data());
+    float density = 0.0;
+    for (size_t var_index = 0; var_index < truth_table->varCount(); var_index++) {
+      if (var_densities[var_index] > 0.0) {
+        float diff_duty = truth_table->probability(truth_table->diff(var_index),
+                                                   var_duties.data());
+        density += var_densities[var_index] * diff_duty;
+      }
+    }
+    return PwrActivity(density, duty, PwrActivityOrigin::propagated);
+  }
   else {
     DdNode *bdd = bdd_.funcBdd(expr);
     float duty = evalBddDuty(bdd, inst);
@@ -807,6 +850,18 @@ Power::evalDiffDuty(FuncExpr *expr,
                     LibertyPort *from_port,
                     const Instance *inst)
 {
+  const FuncTruthTable *truth_table = expr->truthTable();
+  std::array<float, FuncTruthTable::max_var_count> var_duties;
+  std::array<float, FuncTruthTable::max_var_count> var_densities;
+  if (truth_table
+      && findVarActivities(truth_table, inst, var_duties, var_densities)) {
+    int var_index = truth_table->varIndex(from_port);
+    if (var_index >= 0)
+      return truth_table->probability(truth_table->diff(var_index),
+                                      var_duties.data());
+    else
+      return 0.0;
+  }
   DdNode *bdd = bdd_.funcBdd(expr);
   DdNode *var_node = bdd_.findNode(from_port);
   unsigned var_index = Cudd_NodeReadIndex(var_node);
@@ -820,6 +875,34 @@ Power::evalDiffDuty(FuncExpr *expr,
   return duty;
 }
 
+// Duty and density of the truth table vars.
+// Return false if a var has no pin, which the BDD evaluation
+// handles differently.
+bool
+Power::findVarActivities(const FuncTruthTable *truth_table,
+                         const Instance *inst,
+                         // Return values.
+                         std::array<float, FuncTruthTable::max_var_count> &var_duties,
+                         std::array<float, FuncTruthTable::max_var_count> &var_densities)
+{
+  for (size_t var_index = 0; var_index < truth_table->varCount(); var_index++) {
+    const LibertyPort *port = truth_table->var(var_index);
+    const Pin *pin = findLinkPin(inst, port);
+    PwrActivity pin_activity;
+    if (pin)
+      pin_activity = findActivity(pin);
+    if (port->direction()->isInternal())
+      var_duties[var_index] =
+        findSeqActivity(inst, const_cast<LibertyPort *>(port)).duty();
+    else if (pin)
+      var_duties[var_index] = pin_activity.duty();
+    else
+      return false;
+    var_densities[var_index] = pin ? pin_activity.density() : 0.0;
+  }
+  return true;
+}
+
 // As suggested by
 // https://stackoverflow.com/questions/63326728/cudd-printminterm-accessing-the-individual-minterms-in-the-sum-of-products
 float
@@ -892,11 +975,12 @@ Power::ensureActivities(const Scene *scene)
   Stats stats(debug_, report_);
   if (scene != scene_) {
     scene_ = scene;
-    activities_valid_ = false;
-    instance_powers_.clear();
+    activitiesInvalid();
   }
 
   if (!activities_valid_) {
+    invalid_activity_pins_.clear();
+    invalid_regs_.clear();
     // No need to propagate activites if global activity is set.
     if (!global_activity_.isSet()) {
       // Clear existing activities.
@@ -915,51 +999,103 @@ Power::ensureActivities(const Scene *scene)
       ActivitySrchPred activity_srch_pred(this);
       BfsFwdIterator bfs(BfsIndex::other, &activity_srch_pred, this);
       seedActivities(bfs);
-      PropActivityVisitor visitor(this, scene_->mode(), &bfs);
-      // Propagate activities through combinational logic.
-      bfs.visit(levelize_->maxLevel(), &visitor);
-      // Propagate activiities through registers.
-      InstanceSet regs = std::move(visitor.visitedRegs());
-      int pass = 1;
-      while (!regs.empty() && pass <= max_activity_passes_) {
-        visitor.init();
-        for (const Instance *reg : regs)
-          // Propagate activiities across register D->Q.
-          seedRegOutputActivities(reg, bfs);
-        // Propagate register output activities through
-        // combinational logic.
-        bfs.visit(levelize_->maxLevel(), &visitor);
-        regs = std::move(visitor.visitedRegs());
-        debugPrint(debug_, "power_activity", 1, "Pass {} change {:.2f} {}",
-                   pass,
-                   visitor.maxChange(),
-                   network_->pathName(visitor.maxChangePin()));
-        pass++;
-      }
+      propagateActivities(bfs, InstanceSet(network_));
     }
     activities_valid_ = true;
   }
+  else
+    updateActivities();
   stats.report("Power activities");
 }
 
+// Propagate activities from the edited pins and registers through
+// their fanout. Propagation stops where activities do not change.
+void
+Power::updateActivities()
+{
+  if (!invalid_activity_pins_.empty() || !invalid_regs_.empty()) {
+    debugPrint(debug_, "power_activity", 1, "update from {} pins {} regs",
+               invalid_activity_pins_.size(), invalid_regs_.size());
+    if (global_activity_.isSet()) {
+      for (const Pin *pin : invalid_activity_pins_)
+        invalid_power_insts_.insert(network_->instance(pin));
+    }
+    else {
+      ActivitySrchPred activity_srch_pred(this);
+      BfsFwdIterator bfs(BfsIndex::other, &activity_srch_pred, this);
+      for (const Pin *pin : invalid_activity_pins_) {
+        Vertex *vertex, *bidirect_drvr_vertex;
+        graph_->pinVertices(pin, vertex, bidirect_drvr_vertex);
+        if (vertex) {
+          // Use the edges after the edit rather than the levelized roots
+          // so the loads of a disconnected driver are seeded like inputs.
+          if (levelize_->isRoot(vertex))
+            seedActivity(pin, bfs);
+          else
+            bfs.enqueue(vertex);
+        }
+        if (bidirect_drvr_vertex)
+          bfs.enqueue(bidirect_drvr_vertex);
+        invalid_power_insts_.insert(network_->instance(pin));
+      }
+      propagateActivities(bfs, invalid_regs_);
+    }
+    invalid_activity_pins_.clear();
+    invalid_regs_.clear();
+  }
+}
+
+void
+Power::propagateActivities(BfsFwdIterator &bfs,
+                           const InstanceSet &seed_regs)
+{
+  PropActivityVisitor visitor(this, scene_->mode(), &bfs);
+  // Propagate activities through combinational logic.
+  bfs.visit(levelize_->maxLevel(), &visitor);
+  // Propagate activiities through registers.
+  InstanceSet regs = std::move(visitor.visitedRegs());
+  regs.insert(seed_regs.begin(), seed_regs.end());
+  int pass = 1;
+  while (!regs.empty() && pass <= max_activity_passes_) {
+    visitor.init();
+    for (const Instance *reg : regs)
+      // Propagate activiities across register D->Q.
+      seedRegOutputActivities(reg, bfs);
+    // Propagate register output activities through
+    // combinational logic.
+    bfs.visit(levelize_->maxLevel(), &visitor);
+    regs = std::move(visitor.visitedRegs());
+    debugPrint(debug_, "power_activity", 1, "Pass {} change {:.2f} {}",
+               pass,
+               visitor.maxChange(),
+               network_->pathName(visitor.maxChangePin()));
+    pass++;
+  }
+}
+
 void
 Power::seedActivities(BfsFwdIterator &bfs)
 {
-  for (Vertex *vertex : levelize_->roots()) {
-    const Pin *pin = vertex->pin();
-    // Clock activities are baked in.
-    if (!scene_->mode()->sdc()->isLeafPinClock(pin)
-        && !network_->direction(pin)->isInternal()) {
-      debugPrint(debug_, "power_activity", 3, "seed {}",
-                 vertex->to_string(this));
-      if (hasUserActivity(pin))
-        setActivity(pin, userActivity(pin));
-      else
-        // Default inputs without explicit activities to the input default.
-        setActivity(pin, input_activity_);
-      Vertex *vertex = graph_->pinDrvrVertex(pin);
-      bfs.enqueueAdjacentVertices(vertex, scene_->mode());
-    }
+  for (Vertex *vertex : levelize_->roots())
+    seedActivity(vertex->pin(), bfs);
+}
+
+void
+Power::seedActivity(const Pin *pin,
+                    BfsFwdIterator &bfs)
+{
+  // Clock activities are baked in.
+  if (!scene_->mode()->sdc()->isLeafPinClock(pin)
+      && !network_->direction(pin)->isInternal()) {
+    debugPrint(debug_, "power_activity", 3, "seed {}",
+               network_->pathName(pin));
+    if (hasUserActivity(pin))
+      setActivity(pin, userActivity(pin));
+    else
+      // Default inputs without explicit activities to the input default.
+      setActivity(pin, input_activity_);
+    Vertex *vertex = graph_->pinDrvrVertex(pin);
+    bfs.enqueueAdjacentVertices(vertex, scene_->mode());
   }
 }
 
@@ -1078,25 +1214,72 @@ Power::ensureInstPowers()
     findInstPowers();
     instance_powers_valid_ = true;
   }
+  else if (!invalid_power_insts_.empty())
+    updateInstPowers();
 }
 
 void
 Power::findInstPowers()
 {
   Stats stats(debug_, report_);
+  instance_powers_.clear();
+  group_powers_.fill(PowerResult());
+  invalid_power_insts_.clear();
+  const ClkNetwork *clk_network = scene_->mode()->clkNetwork();
   LeafInstanceIterator *inst_iter = network_->leafInstanceIterator();
   while (inst_iter->hasNext()) {
     Instance *inst = inst_iter->next();
     LibertyCell *cell = network_->libertyCell(inst);
-    if (cell) {
-      PowerResult inst_power = power(inst, cell, scene_);
-      instance_powers_[inst] = inst_power;
-    }
+    if (cell)
+      addInstPower(inst, cell, clk_network);
   }
   delete inst_iter;
   stats.report("Find power");
 }
 
+// Replace the powers of edited instances and the instances with
+// updated activities, adjusting the group totals by the difference.
+void
+Power::updateInstPowers()
+{
+  Stats stats(debug_, report_);
+  debugPrint(debug_, "power", 1, "update {} instance powers",
+             invalid_power_insts_.size());
+  const ClkNetwork *clk_network = scene_->mode()->clkNetwork();
+  for (const Instance *inst : invalid_power_insts_) {
+    removeInstPower(inst);
+    if (network_->isLeaf(inst)) {
+      LibertyCell *cell = network_->libertyCell(inst);
+      if (cell)
+        addInstPower(inst, cell, clk_network);
+    }
+  }
+  invalid_power_insts_.clear();
+  stats.report("Update power");
+}
+
+void
+Power::addInstPower(const Instance *inst,
+                    LibertyCell *cell,
+                    const ClkNetwork *clk_network)
+{
+  PowerResult inst_power = power(inst, cell, scene_);
+  PowerGroup group = powerGroup(inst, cell, clk_network);
+  instance_powers_[inst] = {inst_power, group};
+  group_powers_[static_cast<size_t>(group)].incr(inst_power);
+}
+
+void
+Power::removeInstPower(const Instance *inst)
+{
+  auto inst_itr = instance_powers_.find(inst);
+  if (inst_itr != instance_powers_.end()) {
+    const auto &[inst_power, group] = inst_itr->second;
+    group_powers_[static_cast<size_t>(group)].decr(inst_power);
+    instance_powers_.erase(inst_itr);
+  }
+}
+
 PowerResult
 Power::power(const Instance *inst,
              LibertyCell *cell,
@@ -1110,6 +1293,47 @@ Power::power(const Instance *inst,
   return result;
 }
 
+// The when condition duties and related pin weights of the internal
+// power use the current activities.
+PowerResult
+Power::pinEnergy(const Pin *pin,
+                 const Scene *scene)
+{
+  PowerResult energy;
+  const Instance *inst = network_->instance(pin);
+  LibertyCell *cell = network_->libertyCell(inst);
+  LibertyPort *port = network_->libertyPort(pin);
+  if (cell && port) {
+    ensureActivities(scene);
+    PwrActivity unit_activity(1.0, findActivity(pin).duty(),
+                              PwrActivityOrigin::user);
+    if (port->direction()->isAnyOutput()) {
+      float load_cap = graph_delay_calc_->loadCap(pin, scene, MinMax::max());
+      findOutputInternalPower(port, inst, cell, unit_activity, load_cap, scene,
+                              energy);
+      LibertyCell *scene_cell = cell->sceneCell(scene, MinMax::max());
+      energy.incrSwitching(switchingEnergy(pin, port, scene_cell, scene));
+    }
+    if (port->direction()->isAnyInput())
+      findInputInternalPower(pin, port, inst, cell, unit_activity, 0.0, scene,
+                             energy);
+  }
+  return energy;
+}
+
+PowerResult
+Power::leakagePower(const Instance *inst,
+                    const Scene *scene)
+{
+  PowerResult result;
+  LibertyCell *cell = network_->libertyCell(inst);
+  if (cell) {
+    ensureActivities(scene);
+    findLeakagePower(inst, cell, scene, result);
+  }
+  return result;
+}
+
 const Clock *
 Power::findInstClk(const Instance *inst)
 {
@@ -1451,19 +1675,15 @@ Power::findSwitchingPower(const Instance *inst,
     const Pin *to_pin = pin_iter->next();
     const LibertyPort *to_port = network_->libertyPort(to_pin);
     if (to_port) {
-      float load_cap = to_port->direction()->isAnyOutput()
-          ? graph_delay_calc_->loadCap(to_pin, scene, MinMax::max())
-          : 0.0;
       PwrActivity activity = findActivity(to_pin);
       if (to_port->direction()->isAnyOutput()) {
-        float volt = portVoltage(scene_cell, to_port, scene, MinMax::max());
-        float switching = .5 * load_cap * volt * volt * activity.density();
+        float switching = switchingEnergy(to_pin, to_port, scene_cell, scene)
+          * activity.density();
         debugPrint(debug_, "power", 2,
-                   "switching {}/{} activity = {:.2e} volt = {:.2f} {:.3e}",
+                   "switching {}/{} activity = {:.2e} {:.3e}",
                    cell->name(),
                    to_port->name(),
                    activity.density(),
-                   volt,
                    switching);
         result.incrSwitching(switching);
       }
@@ -1472,6 +1692,17 @@ Power::findSwitchingPower(const Instance *inst,
   delete pin_iter;
 }
 
+float
+Power::switchingEnergy(const Pin *to_pin,
+                       const LibertyPort *to_port,
+                       LibertyCell *scene_cell,
+                       const Scene *scene)
+{
+  float load_cap = graph_delay_calc_->loadCap(to_pin, scene, MinMax::max());
+  float volt = portVoltage(scene_cell, to_port, scene, MinMax::max());
+  return .5 * load_cap * volt * volt;
+}
+
 ////////////////////////////////////////////////////////////////
 
 // Leakage totals for one power/gnd pin.
@@ -1821,13 +2052,139 @@ Power::clockMinPeriod(const Sdc *sdc)
 void
 Power::powerInvalid()
 {
-  activities_valid_ = false;
+  activitiesInvalid();
   instance_powers_.clear();
   scene_ = nullptr;
 }
 
 ////////////////////////////////////////////////////////////////
 
+// Network edits.
+
+void
+Power::makeInstanceAfter(const Instance *inst)
+{
+  if (instance_powers_valid_)
+    invalid_power_insts_.insert(inst);
+}
+
+void
+Power::replaceCellAfter(const Instance *inst)
+{
+  if (activities_valid_) {
+    // The new cell changes the loads on the input nets and the
+    // output functions.
+    InstancePinIterator *pin_iter = network_->pinIterator(inst);
+    while (pin_iter->hasNext()) {
+      const Pin *pin = pin_iter->next();
+      netActivityInvalid(pin);
+    }
+    delete pin_iter;
+    invalid_power_insts_.insert(inst);
+    LibertyCell *cell = network_->libertyCell(inst);
+    if (cell) {
+      LibertyCell *test_cell = cell->testCell();
+      if (cell->isSequential()
+          || (test_cell && test_cell->isSequential())
+          || cell->isClockGate())
+        invalid_regs_.insert(inst);
+    }
+  }
+}
+
+void
+Power::connectPinAfter(const Pin *pin)
+{
+  if (activities_valid_) {
+    if (isClockNetEdit(pin))
+      powerInvalid();
+    else
+      netActivityInvalid(pin);
+  }
+}
+
+void
+Power::disconnectPinBefore(const Pin *pin)
+{
+  if (activities_valid_) {
+    if (isClockNetEdit(pin))
+      powerInvalid();
+    else
+      netActivityInvalid(pin);
+  }
+}
+
+void
+Power::deletePinBefore(const Pin *pin)
+{
+  disconnectPinBefore(pin);
+  invalid_activity_pins_.erase(pin);
+  activity_map_.erase(pin);
+  user_activity_map_.erase(pin);
+}
+
+void
+Power::deleteInstanceBefore(const Instance *inst)
+{
+  removeInstPower(inst);
+  invalid_power_insts_.erase(inst);
+  invalid_regs_.erase(inst);
+  LibertyCell *cell = network_->libertyCell(inst);
+  if (cell) {
+    for (const Sequential &seq : cell->sequentials()) {
+      seq_activity_map_.erase(SeqPin(inst, seq.output()));
+      seq_activity_map_.erase(SeqPin(inst, seq.outputInv()));
+    }
+    LibertyCell *test_cell = cell->testCell();
+    if (test_cell) {
+      for (const Sequential &seq : test_cell->sequentials()) {
+        seq_activity_map_.erase(SeqPin(inst, seq.output()));
+        seq_activity_map_.erase(SeqPin(inst, seq.outputInv()));
+      }
+    }
+  }
+}
+
+// Invalidate the activities and powers of the pins connected to pin.
+void
+Power::netActivityInvalid(const Pin *pin)
+{
+  PinConnectedPinIterator *pin_iter = network_->connectedPinIterator(pin);
+  while (pin_iter->hasNext()) {
+    const Pin *net_pin = pin_iter->next();
+    invalid_activity_pins_.insert(net_pin);
+    invalid_power_insts_.insert(network_->instance(net_pin));
+  }
+  delete pin_iter;
+  invalid_activity_pins_.insert(pin);
+  invalid_power_insts_.insert(network_->instance(pin));
+}
+
+// Connection edits that change the clock network are not updated
+// incrementally.
+bool
+Power::isClockNetEdit(const Pin *pin)
+{
+  const ClkNetwork *clk_network = scene_->mode()->clkNetwork();
+  if (!clk_network->clkPinsValid()
+      || network_->isHierarchical(pin)
+      || network_->isRegClkPin(pin))
+    return true;
+  bool is_clk = false;
+  PinConnectedPinIterator *pin_iter = network_->connectedPinIterator(pin);
+  while (pin_iter->hasNext()) {
+    const Pin *net_pin = pin_iter->next();
+    if (clk_network->isClock(net_pin)) {
+      is_clk = true;
+      break;
+    }
+  }
+  delete pin_iter;
+  return is_clk;
+}
+
+////////////////////////////////////////////////////////////////
+
 void
 PowerResult::clear()
 {
@@ -1861,13 +2218,21 @@ PowerResult::incrLeakage(float pwr)
 }
 
 void
-PowerResult::incr(PowerResult &result)
+PowerResult::incr(const PowerResult &result)
 {
   internal_ += result.internal_;
   switching_ += result.switching_;
   leakage_ += result.leakage_;
 }
 
+void
+PowerResult::decr(const PowerResult &result)
+{
+  internal_ -= result.internal_;
+  switching_ -= result.switching_;
+  leakage_ -= result.leakage_;
+}
+
 ////////////////////////////////////////////////////////////////
 
 PwrActivity::PwrActivity(float density,
@@ -24,11 +24,14 @@
 
 #pragma once
 
+#include <array>
+#include <map>
 #include <string>
 #include <unordered_map>
 #include <utility>
 
 #include "Bdd.hh"
+#include "FuncExpr.hh"
 #include "Network.hh"
 #include "PowerClass.hh"
 #include "SdcClass.hh"
@@ -70,6 +73,12 @@ using PwrActivityMap = std::unordered_map<const Pin*, PwrActivity>;
 using PwrSeqActivityMap = std::unordered_map<SeqPin, PwrActivity,
                                              SeqPinHash, SeqPinEqual>;
 
+// report_power instance groups.
+enum class PowerGroup { sequential, combinational, clock, macro, pad };
+constexpr size_t power_group_count = 5;
+using InstGroupPower = std::pair<PowerResult, PowerGroup>;
+using InstGroupPowerMap = std::map<const Instance*, InstGroupPower, InstanceIdLess>;
+
 // The Power class has access to Sta components directly for
 // convenience but also requires access to the Sta class member functions.
 class Power : public StaState
@@ -106,6 +115,12 @@ public:
 	     PowerResult &pad);
   PowerResult power(const Instance *inst,
                     const Scene *scene);
+  // Internal and switching energy of one transition of a leaf
+  // instance pin from the power models.
+  PowerResult pinEnergy(const Pin *pin,
+                        const Scene *scene);
+  PowerResult leakagePower(const Instance *inst,
+                           const Scene *scene);
 
   void setGlobalActivity(float density,
 			 float duty);
@@ -129,6 +144,16 @@ public:
   float clockMinPeriod(const Sdc *sdc);
   float clockMinPeriod();
   void powerInvalid();
+  // Network edit hooks.
+  // Edits update the activities in the fanout of the edited nets and
+  // the power of the instances they reach instead of invalidating
+  // all of them. Edits to the clock network invalidate everything.
+  void makeInstanceAfter(const Instance *inst);
+  void replaceCellAfter(const Instance *inst);
+  void connectPinAfter(const Pin *pin);
+  void disconnectPinBefore(const Pin *pin);
+  void deletePinBefore(const Pin *pin);
+  void deleteInstanceBefore(const Instance *inst);
 
 protected:
   PwrActivity &activity(const Pin *pin);
@@ -138,6 +163,12 @@ protected:
                    const Scene *scene,
                    PowerResult &result);
   void ensureActivities(const Scene *scene);
+  void propagateActivities(BfsFwdIterator &bfs,
+                           const InstanceSet &seed_regs);
+  void updateActivities();
+  void activityInvalid(const Pin *pin);
+  void netActivityInvalid(const Pin *pin);
+  bool isClockNetEdit(const Pin *pin);
   bool hasUserActivity(const Pin *pin);
   PwrActivity &userActivity(const Pin *pin);
   void setSeqActivity(const Instance *reg,
@@ -161,6 +192,14 @@ protected:
 
   void ensureInstPowers();
   void findInstPowers();
+  void updateInstPowers();
+  void addInstPower(const Instance *inst,
+                    LibertyCell *cell,
+                    const ClkNetwork *clk_network);
+  void removeInstPower(const Instance *inst);
+  PowerGroup powerGroup(const Instance *inst,
+                        const LibertyCell *cell,
+                        const ClkNetwork *clk_network);
   PowerResult power(const Instance *inst,
                     LibertyCell *cell,
                     const Scene *scene);
@@ -196,6 +235,10 @@ protected:
                           const Scene *scene,
                           // Return values.
                           PowerResult &result);
+  float switchingEnergy(const Pin *to_pin,
+                        const LibertyPort *to_port,
+                        LibertyCell *scene_cell,
+                        const Scene *scene);
   float getSlew(Vertex *vertex,
                 const RiseFall *rf,
                 const Scene *scene);
@@ -214,6 +257,8 @@ protected:
                       const Scene *scene,
                       const MinMax *min_max);
   void seedActivities(BfsFwdIterator &bfs);
+  void seedActivity(const Pin *pin,
+                    BfsFwdIterator &bfs);
   void seedRegOutputActivities(const Instance *reg,
 			       const Sequential &seq,
 			       LibertyPort *output,
@@ -228,6 +273,11 @@ protected:
                                    BfsFwdIterator &bfs);
   PwrActivity evalActivity(FuncExpr *expr,
 			   const Instance *inst);
+  bool findVarActivities(const FuncTruthTable *truth_table,
+                         const Instance *inst,
+                         // Return values.
+                         std::array<float, FuncTruthTable::max_var_count> &var_duties,
+                         std::array<float, FuncTruthTable::max_var_count> &var_densities);
   PwrActivity evalActivity(FuncExpr *expr,
 			   const Instance *inst,
 			   const LibertyPort *cofactor_port,
@@ -271,10 +321,18 @@ private:
                                         SeqPinHash(network_),
                                         SeqPinEqual()};
   bool activities_valid_{false};
+  // Pins with edited activities or connections to propagate from
+  // while activities_valid_.
+  PinSet invalid_activity_pins_{network_};
+  // Sequential instances with edited cells to propagate D->Q.
+  InstanceSet invalid_regs_{network_};
   Bdd bdd_;
-  std::map<const Instance*, PowerResult, InstanceIdLess> instance_powers_{
-      InstanceIdLess(network_)};
+  InstGroupPowerMap instance_powers_{InstanceIdLess(network_)};
+  // Sums of instance_powers_ by group.
+  std::array<PowerResult, power_group_count> group_powers_;
   bool instance_powers_valid_{false};
+  // Instances to update while instance_powers_valid_.
+  InstanceSet invalid_power_insts_{network_};
 
   static constexpr int max_activity_passes_ = 50;
 
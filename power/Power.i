@@ -216,6 +216,20 @@ read_vcd_file(const char *filename,
   readVcdActivities(filename, scope, mode_name, begin_time, end_time, sta);
 }
 
+void
+report_power_vcd_windows(const char *filename,
+                         const char *scope,
+                         double window,
+                         int inst_count,
+                         const Scene *scene,
+                         int digits)
+{
+  Sta *sta = Sta::sta();
+  sta->ensureLibLinked();
+  reportVcdPowerWindows(filename, scope, window, inst_count, scene, digits,
+                        sta);
+}
+
 ////////////////////////////////////////////////////////////////
 
 bool
@@ -33,6 +33,7 @@ namespace eval sta {
 define_cmd_args "report_power" \
   { [-instances instances]\
       [-highest_power_instances count]\
+      [-vcd vcd_file -window window [-scope scope]]\
       [-scene scene]\
       [-digits digits]\
       [-format format]\
@@ -42,7 +43,8 @@ proc_redirect report_power {
   global sta_report_default_digits
 
   parse_key_args "report_power" args \
-    keys {-instances -highest_power_instances -corner -scene -format -digits}\
+    keys {-instances -highest_power_instances -corner -scene -format -digits \
+            -vcd -window -scope} \
     flags {}
 
   check_argc_eq0 "report_power" $args
@@ -67,7 +69,25 @@ proc_redirect report_power {
     set format "text"
   }
 
-  if { [info exists keys(-instances)] } {
+  if { [info exists keys(-vcd)] } {
+    if { ![info exists keys(-window)] } {
+      sta_error 312 "report_power -vcd requires -window."
+    }
+    set window $keys(-window)
+    check_positive_float "-window" $window
+    set filename [file nativename $keys(-vcd)]
+    set scope ""
+    if { [info exists keys(-scope)] } {
+      set scope $keys(-scope)
+    }
+    set count 0
+    if { [info exists keys(-highest_power_instances)] } {
+      set count $keys(-highest_power_instances)
+      check_positive_integer "-highest_power_instances" $count
+    }
+    report_power_vcd_windows $filename $scope [time_ui_sta $window] \
+      $count $scene $digits
+  } elseif { [info exists keys(-instances)] } {
     set insts [get_instances_error "-instances" $keys(-instances)]
     if { $format == "json" } {
       report_power_insts_json $insts $scene $digits
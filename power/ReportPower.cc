@@ -30,6 +30,7 @@
 #include "Format.hh"
 #include "Network.hh"
 #include "Report.hh"
+#include "Units.hh"
 
 namespace sta {
 
@@ -93,6 +94,54 @@ ReportPower::reportInsts(const InstPowers &inst_pwrs,
   }
 }
 
+void
+ReportPower::reportWindowTitle(int digits)
+{
+  int field_width = std::max(digits + 6, 10);
+  report_->report(" {:>{}} {:>{}} {:>{}} {:>{}} {:>{}} {:>{}}",
+                  "Begin", field_width, "End", field_width,
+                  "Internal", field_width, "Switching", field_width,
+                  "Leakage", field_width, "Total", field_width);
+  report_->report(" {:>{}} {:>{}} {:>{}} {:>{}} {:>{}} {:>{}} ({}, Watts)",
+                  "Time", field_width, "Time", field_width,
+                  "Power", field_width, "Power", field_width,
+                  "Power", field_width, "Power", field_width,
+                  units_->timeUnit()->scaleAbbrevSuffix());
+  std::string dashes((field_width + 1) * 6, '-');
+  report_->reportLine(dashes);
+}
+
+void
+ReportPower::reportWindow(double begin,
+                          double end,
+                          const PowerResult &total,
+                          int digits)
+{
+  int field_width = std::max(digits + 6, 10);
+  const Unit *time_unit = units_->timeUnit();
+  std::string line = sta::format(" {:>{}}", time_unit->asString(begin, digits),
+                                 field_width);
+  line += sta::format(" {:>{}}", time_unit->asString(end, digits), field_width);
+  line += powerCol(total.internal(), field_width, digits);
+  line += powerCol(total.switching(), field_width, digits);
+  line += powerCol(total.leakage(), field_width, digits);
+  line += powerCol(total.total(), field_width, digits);
+  report_->reportLine(line);
+}
+
+void
+ReportPower::reportPeakWindow(double begin,
+                              double end,
+                              const PowerResult &total,
+                              int digits)
+{
+  const Unit *time_unit = units_->timeUnit();
+  report_->report("Peak window {} - {} total power {:.{}e}",
+                  time_unit->asString(begin, digits),
+                  time_unit->asString(end, digits),
+                  total.total(), digits);
+}
+
 void
 ReportPower::reportInst(const Instance *inst,
                         const PowerResult &power,
@@ -45,6 +45,15 @@ public:
                     int digits);
   void reportInsts(const InstPowers &inst_pwrs,
                    int digits);
+  void reportWindowTitle(int digits);
+  void reportWindow(double begin,
+                    double end,
+                    const PowerResult &total,
+                    int digits);
+  void reportPeakWindow(double begin,
+                        double end,
+                        const PowerResult &total,
+                        int digits);
 
 private:
   std::string powerCol(float pwr,
@@ -25,6 +25,8 @@
 #include "power/SaifReader.hh"
 
 #include <algorithm>
+#include <cctype>
+#include <charconv>
 #include <cinttypes>
 #include <string>
 #include <utility>
@@ -40,7 +42,6 @@
 #include "Sta.hh"
 #include "Stats.hh"
 #include "power/SaifReaderPvt.hh"
-#include "power/SaifScanner.hh"
 
 namespace sta {
 
@@ -67,29 +68,215 @@ SaifReader::SaifReader(const char *filename,
 bool
 SaifReader::read()
 {
-  gzstream::igzstream stream(filename_);
-  if (stream.is_open()) {
+  stream_ = gzopen(filename_, "r");
+  if (stream_) {
     Stats stats(debug_, report_);
-    SaifScanner scanner(&stream, filename_, this, report_);
-    SaifParse parser(&scanner, this);
-    // yyparse returns 0 on success.
-    bool success = (parser.parse() == 0);
+    buffer_.resize(buffer_size_);
+    try {
+      parseFile();
+    }
+    catch (...) {
+      gzclose(stream_);
+      stream_ = nullptr;
+      throw;
+    }
+    gzclose(stream_);
+    stream_ = nullptr;
+    buffer_.clear();
+    buffer_.shrink_to_fit();
+    stats.report("Read SAIF");
     report_->report("Annotated {} pin activities.", annotated_pins_.size());
-    return success;
+    return true;
   }
   else
     throw FileNotReadable(filename_);
 }
 
+////////////////////////////////////////////////////////////////
+
+// file: '(' SAIFILE header_stmt... instance ')'
+void
+SaifReader::parseFile()
+{
+  expect('(');
+  std::string_view token = getToken();
+  if (token != "SAIFILE")
+    syntaxError(token);
+  for (;;) {
+    expect('(');
+    std::string_view keyword = getToken();
+    if (keyword == "INSTANCE") {
+      parseInstance();
+      break;
+    }
+    parseHeaderStmt(keyword);
+  }
+  expect(')');
+}
+
+void
+SaifReader::parseHeaderStmt(std::string_view keyword)
+{
+  if (keyword == "SAIFVERSION"
+      || keyword == "DIRECTION"
+      || keyword == "DESIGN"
+      || keyword == "DATE"
+      || keyword == "VENDOR"
+      || keyword == "PROGRAM_NAME"
+      || keyword == "VERSION")
+    skipStmt();
+  else if (keyword == "DIVIDER") {
+    setDivider(getToken());
+    expect(')');
+  }
+  else if (keyword == "TIMESCALE") {
+    // The units may follow the multiplier without a blank (1ns).
+    std::string_view token = getToken();
+    size_t digits = 0;
+    while (digits < token.size()
+           && std::isdigit(static_cast<unsigned char>(token[digits])))
+      digits++;
+    uint64_t multiplier = parseUint(token.substr(0, digits));
+    // The multiplier is converted before the next token can move the buffer.
+    if (digits == token.size())
+      setTimescale(multiplier, getToken());
+    else
+      setTimescale(multiplier, token.substr(digits));
+    expect(')');
+  }
+  else if (keyword == "DURATION") {
+    setDuration(parseUint(getToken()));
+    expect(')');
+  }
+  else
+    syntaxError(keyword);
+}
+
+// instance: '(' INSTANCE [QSTRING] ID instance_content... ')'
+// The opening '(' INSTANCE has been read.
+void
+SaifReader::parseInstance()
+{
+  std::string_view name = getToken();
+  // Skip the optional quoted cell type.
+  if (token_quoted_)
+    name = getToken();
+  if (name.empty() || isToken(name, '(') || isToken(name, ')'))
+    syntaxError(name);
+  instancePush(name);
+  for (;;) {
+    std::string_view token = getToken();
+    if (isToken(token, ')'))
+      break;
+    if (!isToken(token, '('))
+      syntaxError(token);
+    std::string_view keyword = getToken();
+    if (keyword == "INSTANCE")
+      parseInstance();
+    else if (keyword == "NET")
+      parseNets(true);
+    else if (keyword == "PORT")
+      parseNets(false);
+    else
+      syntaxError(keyword);
+  }
+  instancePop();
+}
+
+// nets: '(' NET net... ')'
+// net: '(' ID state_durations ')'
+void
+SaifReader::parseNets(bool annotate)
+{
+  for (;;) {
+    std::string_view token = getToken();
+    if (isToken(token, ')'))
+      break;
+    if (!isToken(token, '('))
+      syntaxError(token);
+    std::string_view net_name = getToken();
+    if (net_name.empty() || isToken(net_name, '(') || isToken(net_name, ')'))
+      syntaxError(net_name);
+    // The name is only valid until the next token is read.
+    const Pin *pin = annotate ? findNetPin(net_name) : nullptr;
+    SaifStateDurations durations{};
+    parseStateDurations(durations);
+    if (pin)
+      setPinDurations(pin, durations);
+  }
+}
+
+// state_durations: '(' state UINT ')'... ')'
 void
-SaifReader::setDivider(char divider)
+SaifReader::parseStateDurations(SaifStateDurations &durations)
 {
-  divider_ = divider;
+  for (;;) {
+    std::string_view token = getToken();
+    if (isToken(token, ')'))
+      break;
+    if (!isToken(token, '('))
+      syntaxError(token);
+    std::string_view state_name = getToken();
+    SaifState state = SaifState::IG;
+    if (state_name == "T0")
+      state = SaifState::T0;
+    else if (state_name == "T1")
+      state = SaifState::T1;
+    else if (state_name == "TX")
+      state = SaifState::TX;
+    else if (state_name == "TZ")
+      state = SaifState::TZ;
+    else if (state_name == "TB")
+      state = SaifState::TB;
+    else if (state_name == "TC")
+      state = SaifState::TC;
+    else if (state_name == "IG")
+      state = SaifState::IG;
+    else
+      syntaxError(state_name);
+    durations[static_cast<int>(state)] = parseUint(getToken());
+    expect(')');
+  }
+}
+
+// Skip the remaining tokens of a header statement.
+void
+SaifReader::skipStmt()
+{
+  for (;;) {
+    std::string_view token = getToken();
+    if (isToken(token, ')'))
+      break;
+    if ((token.empty() && !token_quoted_) || isToken(token, '('))
+      syntaxError(token);
+  }
+}
+
+uint64_t
+SaifReader::parseUint(std::string_view token)
+{
+  uint64_t value = 0;
+  const char *end = token.data() + token.size();
+  auto [ptr, ec] = std::from_chars(token.data(), end, value);
+  if (token_quoted_ || token.empty() || ec != std::errc() || ptr != end)
+    syntaxError(token);
+  return value;
+}
+
+////////////////////////////////////////////////////////////////
+
+void
+SaifReader::setDivider(std::string_view divider)
+{
+  if (divider == "/" || divider == ".")
+    divider_ = divider[0];
+  else
+    syntaxError(divider);
 }
 
 void
 SaifReader::setTimescale(uint64_t multiplier,
-                         std::string &&units)
+                         std::string_view units)
 {
   if (multiplier == 1 || multiplier == 10 || multiplier == 100) {
     if (stringEqual(units, "us"))
@@ -114,24 +301,9 @@ SaifReader::setDuration(uint64_t duration)
 }
 
 void
-SaifReader::instancePush(std::string &&instance_name)
+SaifReader::instancePush(std::string_view instance_name)
 {
-  if (in_scope_level_ == 0) {
-    // Check for a match to the annotation scope.
-    saif_scope_.push_back(std::move(instance_name));
-
-    std::string saif_scope;
-    bool first = true;
-    for (std::string &inst : saif_scope_) {
-      if (!first)
-        saif_scope += sdc_network_->pathDivider();
-      saif_scope += inst;
-      first = false;
-    }
-    if (saif_scope == scope_)
-      in_scope_level_ = saif_scope_.size();
-  }
-  else {
+  if (in_scope_) {
     // Inside annotation scope.
     Instance *parent = path_.empty() ? sdc_network_->topInstance() : path_.back();
     Instance *child = parent
@@ -139,75 +311,266 @@ SaifReader::instancePush(std::string &&instance_name)
       : nullptr;
     path_.push_back(child);
   }
+  else if (out_of_scope_depth_ > 0)
+    out_of_scope_depth_++;
+  else {
+    // Check for a match to the annotation scope.
+    size_t scope_end = saif_scope_.size();
+    if (!saif_scope_.empty())
+      saif_scope_ += sdc_network_->pathDivider();
+    saif_scope_ += instance_name;
+    std::string_view scope(scope_);
+    if (scope == saif_scope_) {
+      saif_scope_ends_.push_back(scope_end);
+      in_scope_ = true;
+    }
+    else if (scope.size() > saif_scope_.size()
+             && scope.starts_with(saif_scope_)
+             && scope[saif_scope_.size()] == sdc_network_->pathDivider())
+      saif_scope_ends_.push_back(scope_end);
+    else {
+      // Nothing below this instance is in the annotation scope.
+      saif_scope_.resize(scope_end);
+      out_of_scope_depth_ = 1;
+    }
+  }
 }
 
 void
 SaifReader::instancePop()
 {
-  if (in_scope_level_ == 0)
-    saif_scope_.pop_back();
-  if (!path_.empty())
+  if (in_scope_ && !path_.empty())
     path_.pop_back();
-  if (saif_scope_.size() < in_scope_level_)
-    in_scope_level_ = 0;
+  else if (out_of_scope_depth_ > 0)
+    out_of_scope_depth_--;
+  else {
+    in_scope_ = false;
+    saif_scope_.resize(saif_scope_ends_.back());
+    saif_scope_ends_.pop_back();
+  }
+}
+
+const Pin *
+SaifReader::findNetPin(std::string_view net_name)
+{
+  if (!in_scope_)
+    return nullptr;
+  Instance *top_inst = sdc_network_->topInstance();
+  Instance *parent = path_.empty() ? top_inst : path_.back();
+  if (parent == nullptr)
+    return nullptr;
+  if (parent == top_inst) {
+    const Pin *pin = sdc_network_->findPin(parent, unescaped(net_name));
+    return (pin && annotatable(pin)) ? pin : nullptr;
+  }
+  // Hierarchical pins below the top are not annotated, so only
+  // leaf instance nets that are cell ports are looked up.
+  if (sdc_network_->isHierarchical(parent))
+    return nullptr;
+  SaifPortMap &port_map = cell_ports_[sdc_network_->cell(parent)];
+  auto itr = port_map.find(net_name);
+  const Port *port;
+  if (itr == port_map.end()) {
+    const Pin *pin = sdc_network_->findPin(parent, unescaped(net_name));
+    port = (pin && annotatable(pin)) ? sdc_network_->port(pin) : nullptr;
+    port_map.emplace(std::string(net_name), port);
+  }
+  else
+    port = itr->second;
+  return port ? sdc_network_->findPin(parent, port) : nullptr;
+}
+
+bool
+SaifReader::annotatable(const Pin *pin) const
+{
+  LibertyPort *liberty_port = sdc_network_->libertyPort(pin);
+  return !sdc_network_->isHierarchical(pin)
+    && !sdc_network_->direction(pin)->isInternal()
+    && !(liberty_port && liberty_port->isPwrGnd());
 }
 
 void
-SaifReader::setNetDurations(std::string &&net_name,
+SaifReader::setPinDurations(const Pin *pin,
                             const SaifStateDurations &durations)
 {
-  if (in_scope_level_ > 0) {
-    Instance *parent = path_.empty() ? sdc_network_->topInstance() : path_.back();
-    if (parent) {
-      std::string unescaped_name = unescaped(net_name);
-      const Pin *pin = sdc_network_->findPin(parent, unescaped_name);
-      LibertyPort *liberty_port = pin ? sdc_network_->libertyPort(pin) : nullptr;
-      if (pin && !sdc_network_->isHierarchical(pin)
-          && !sdc_network_->direction(pin)->isInternal()
-          && !(liberty_port && liberty_port->isPwrGnd())) {
-        double t1 = durations[static_cast<int>(SaifState::T1)];
-        float duty = t1 / duration_;
-        double tc = durations[static_cast<int>(SaifState::TC)];
-        float density = tc / (duration_ * timescale_);
-        debugPrint(debug_, "read_saif", 2,
-                   "{} duty {:.0f} / {} = {:.2f} tc {:.0f} density {:.2f}",
-                   sdc_network_->pathName(pin), t1, duration_, duty, tc, density);
-        power_->setUserActivity(pin, density, duty, PwrActivityOrigin::saif);
-        annotated_pins_.insert(pin);
-      }
-    }
-  }
+  double t1 = durations[static_cast<int>(SaifState::T1)];
+  float duty = t1 / duration_;
+  double tc = durations[static_cast<int>(SaifState::TC)];
+  float density = tc / (duration_ * timescale_);
+  debugPrint(debug_, "read_saif", 2,
+             "{} duty {:.0f} / {} = {:.2f} tc {:.0f} density {:.2f}",
+             sdc_network_->pathName(pin), t1, duration_, duty, tc, density);
+  power_->setUserActivity(pin, density, duty, PwrActivityOrigin::saif);
+  annotated_pins_.insert(pin);
 }
 
-std::string
-SaifReader::unescaped(const std::string &token)
+std::string_view
+SaifReader::unescaped(std::string_view token)
 {
-  std::string unescaped;
+  if (token.find(escape_) == std::string_view::npos)
+    return token;
+  unescaped_.clear();
   for (char ch : token) {
     if (ch != escape_)
-      unescaped += ch;
+      unescaped_ += ch;
   }
-  debugPrint(debug_, "saif_name", 1, "token {} -> {}", token, unescaped);
-  return unescaped;
+  debugPrint(debug_, "saif_name", 1, "token {} -> {}", token, unescaped_);
+  return unescaped_;
 }
 
 ////////////////////////////////////////////////////////////////
 
-SaifScanner::SaifScanner(std::istream *stream,
-                         const std::string &filename,
-                         SaifReader *reader,
-                         Report *report) :
-  yyFlexLexer(stream),
-  filename_(filename),
-  reader_(reader),
-  report_(report)
+// Return the next token as a view into the buffer that is valid
+// until the next call. Parens are single character tokens.
+// Returns an empty token at the end of the file.
+std::string_view
+SaifReader::getToken()
 {
+  token_quoted_ = false;
+  skipBlanks();
+  if (!available(1))
+    return {};
+  char ch = buffer_[buffer_pos_];
+  if (ch == '(' || ch == ')')
+    return std::string_view(&buffer_[buffer_pos_++], 1);
+  if (ch == '"')
+    return getQuotedString();
+  size_t token_begin = buffer_pos_;
+  for (;;) {
+    if (buffer_pos_ == buffer_end_
+        && !fillBuffer(token_begin))
+      break;
+    ch = buffer_[buffer_pos_];
+    if (std::isspace(static_cast<unsigned char>(ch))
+        || ch == '(' || ch == ')' || ch == '"')
+      break;
+    buffer_pos_++;
+  }
+  return std::string_view(&buffer_[token_begin], buffer_pos_ - token_begin);
 }
 
+// Quoted strings are only used in the header, so they are copied
+// to resolve escaped characters.
+std::string_view
+SaifReader::getQuotedString()
+{
+  token_quoted_ = true;
+  quoted_.clear();
+  // Skip the open quote.
+  buffer_pos_++;
+  for (;;) {
+    if (!available(1))
+      report_->fileError(1860, filename_, line_, "unterminated quoted string");
+    char ch = buffer_[buffer_pos_++];
+    if (ch == '"')
+      break;
+    if (ch == '\\') {
+      if (!available(1))
+        report_->fileError(1860, filename_, line_, "unterminated quoted string");
+      ch = buffer_[buffer_pos_++];
+    }
+    if (ch == '\n')
+      line_++;
+    quoted_ += ch;
+  }
+  return quoted_;
+}
+
+// Skip blanks and comments.
 void
-SaifScanner::error(const char *msg)
+SaifReader::skipBlanks()
 {
-  report_->fileError(1860, filename_, lineno(), "{}", msg);
+  while (available(1)) {
+    char ch = buffer_[buffer_pos_];
+    if (ch == '/' && available(2) && buffer_[buffer_pos_ + 1] == '*') {
+      buffer_pos_ += 2;
+      for (;;) {
+        if (!available(2))
+          report_->fileError(1863, filename_, line_, "unterminated comment");
+        ch = buffer_[buffer_pos_];
+        if (ch == '*' && buffer_[buffer_pos_ + 1] == '/') {
+          buffer_pos_ += 2;
+          break;
+        }
+        if (ch == '\n')
+          line_++;
+        buffer_pos_++;
+      }
+    }
+    else if (ch == '/' && available(2) && buffer_[buffer_pos_ + 1] == '/') {
+      while (available(1) && buffer_[buffer_pos_] != '\n')
+        buffer_pos_++;
+    }
+    else if (std::isspace(static_cast<unsigned char>(ch))) {
+      if (ch == '\n')
+        line_++;
+      buffer_pos_++;
+    }
+    else
+      break;
+  }
+}
+
+// Read more of the file until count characters are available
+// at the buffer position.
+bool
+SaifReader::available(size_t count)
+{
+  while (buffer_end_ - buffer_pos_ < count) {
+    size_t keep_begin = buffer_pos_;
+    if (!fillBuffer(keep_begin))
+      return false;
+  }
+  return true;
+}
+
+// Move the unread text from keep_begin to the front of the buffer
+// and read the next block of the file after it.
+bool
+SaifReader::fillBuffer(size_t &keep_begin)
+{
+  size_t keep_size = buffer_end_ - keep_begin;
+  if (keep_begin > 0)
+    std::copy(buffer_.begin() + keep_begin, buffer_.begin() + buffer_end_,
+              buffer_.begin());
+  else if (keep_size == buffer_.size())
+    // Token longer than the buffer.
+    buffer_.resize(buffer_.size() * 2);
+  buffer_pos_ -= keep_begin;
+  buffer_end_ = keep_size;
+  keep_begin = 0;
+  int length = gzread(stream_, buffer_.data() + buffer_end_,
+                      buffer_.size() - buffer_end_);
+  if (length <= 0)
+    return false;
+  buffer_end_ += length;
+  return true;
+}
+
+bool
+SaifReader::isToken(std::string_view token,
+                    char ch) const
+{
+  return !token_quoted_
+    && token.size() == 1
+    && token[0] == ch;
+}
+
+void
+SaifReader::expect(char ch)
+{
+  std::string_view token = getToken();
+  if (!isToken(token, ch))
+    syntaxError(token);
+}
+
+void
+SaifReader::syntaxError(std::string_view token)
+{
+  if (token.empty() && !token_quoted_)
+    report_->fileError(169, filename_, line_, "syntax error, unexpected end of file");
+  else
+    report_->fileError(169, filename_, line_, "syntax error, unexpected {}", token);
 }
 
 }  // namespace sta
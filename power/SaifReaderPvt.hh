@@ -26,28 +26,46 @@
 
 #include <array>
 #include <cstdint>
+#include <functional>
 #include <set>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "NetworkClass.hh"
 #include "StaState.hh"
 #include "Zlib.hh"
 
-// Header for SaifReader.cc to communicate with SaifLex.cc, SaifParse.cc
-
-// global namespace
-
 namespace sta {
 
 class Sta;
 class Power;
-class SaifScanner;
 
 enum class SaifState { T0, T1, TX, TZ, TB, TC, IG };
 
 using SaifStateDurations = std::array<uint64_t, static_cast<int>(SaifState::IG)+1>;
 
+class SaifNameHash
+{
+public:
+  using is_transparent = void;
+  size_t operator()(std::string_view name) const
+  {
+    return std::hash<std::string_view>()(name);
+  }
+};
+
+// SAIF net name -> annotated port of a leaf cell (null if not annotated).
+using SaifPortMap = std::unordered_map<std::string, const Port*,
+                                       SaifNameHash, std::equal_to<>>;
+using SaifCellPortMap = std::unordered_map<const Cell*, SaifPortMap>;
+
+// Streaming SAIF reader.
+// Tokens are views into the file buffer, so names are resolved
+// before the next token is read. INSTANCE names are resolved to
+// instances when the block begins and NET names are resolved
+// through a per-cell map of leaf cell port names.
 class SaifReader : public StaState
 {
 public:
@@ -55,19 +73,38 @@ public:
              const char *scope,
              Sta *sta);
   bool read();
+  const char *filename() { return filename_; }
 
-  void setDivider(char divider);
+private:
+  void parseFile();
+  void parseHeaderStmt(std::string_view keyword);
+  void parseInstance();
+  void parseNets(bool annotate);
+  void parseStateDurations(SaifStateDurations &durations);
+  void skipStmt();
+  uint64_t parseUint(std::string_view token);
+
+  void setDivider(std::string_view divider);
   void setTimescale(uint64_t multiplier,
-                    std::string &&units);
+                    std::string_view units);
   void setDuration(uint64_t duration);
-  void instancePush(std::string &&instance_name);
+  void instancePush(std::string_view instance_name);
   void instancePop();
-  void setNetDurations(std::string &&net_name,
+  const Pin *findNetPin(std::string_view net_name);
+  bool annotatable(const Pin *pin) const;
+  void setPinDurations(const Pin *pin,
                        const SaifStateDurations &durations);
-  const char *filename() { return filename_; }
-
-private:
-  std::string unescaped(const std::string &token);
+  std::string_view unescaped(std::string_view token);
+
+  std::string_view getToken();
+  std::string_view getQuotedString();
+  void skipBlanks();
+  bool available(size_t count);
+  bool fillBuffer(size_t &keep_begin);
+  bool isToken(std::string_view token,
+               char ch) const;
+  void expect(char ch);
+  void syntaxError(std::string_view token);
 
   const char *filename_;
   const char *scope_;           // Divider delimited scope to begin annotation.
@@ -77,11 +114,26 @@ private:
   double timescale_ = 1.0E-9;  // default units of ns
   int64_t duration_ = 0;
 
-  std::vector<std::string> saif_scope_;   // Scope during parsing.
-  size_t in_scope_level_ = 0;
+  gzFile stream_ = nullptr;
+  std::vector<char> buffer_;
+  size_t buffer_pos_ = 0;
+  size_t buffer_end_ = 0;
+  int line_ = 1;
+  bool token_quoted_ = false;
+  std::string quoted_;
+  std::string unescaped_;
+
+  std::string saif_scope_;              // Scope during parsing.
+  std::vector<size_t> saif_scope_ends_;
+  // Depth of INSTANCE blocks that cannot lead to the annotation scope.
+  size_t out_of_scope_depth_ = 0;
+  bool in_scope_ = false;
   std::vector<Instance*> path_;      // Path within scope.
+  SaifCellPortMap cell_ports_;
   std::set<const Pin*> annotated_pins_;
   Power *power_;
+
+  static constexpr size_t buffer_size_ = 1 << 20;
 };
 
 } // namespace sta
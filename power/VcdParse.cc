@@ -26,8 +26,12 @@
 
 #include <algorithm>
 #include <cctype>
+#include <charconv>
 #include <cinttypes>
+#include <exception>
 
+#include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "EnumNameMap.hh"
 #include "Error.hh"
 #include "Report.hh"
@@ -56,12 +60,16 @@ VcdParse::read(const char *filename,
     reader_ = reader;
     file_line_ = 0;
     stmt_line_ = 0;
+    buffer_.resize(buffer_size_);
+    buffer_pos_ = 0;
+    buffer_end_ = 0;
+    var_index_map_.clear();
 
     // If user specified a start time, set it now.
     if (begin_time != vcd_null_time) {
       reader_->setTimeMin(begin_time);
     }
-    std::string token = getToken();
+    std::string_view token = getToken();
     while (!token.empty()) {
       if (token == "$date")
         reader_->setDate(readStmtString());
@@ -88,15 +96,7 @@ VcdParse::read(const char *filename,
         // Initial values.
         parseVarValues();
       else if (token[0] == '#') {
-        try {
-          time_ = stoll(token.substr(1));
-        } catch (std::invalid_argument &error) {
-          report_->fileError(805, filename_, file_line_, "invalid time {}",
-                             token.substr(1));
-        } catch (std::out_of_range &error) {
-          report_->fileError(806, filename_, file_line_, "time out of range {}",
-                             token.substr(1));
-        }
+        time_ = parseTime(token.substr(1));
         // Set time min to start time if it is not set at beginning
         if (begin_time == vcd_null_time) {
           reader_->setTimeMin(time_);
@@ -111,6 +111,8 @@ VcdParse::read(const char *filename,
       token = getToken();
     }
     gzclose(stream_);
+    buffer_.clear();
+    buffer_.shrink_to_fit();
     stats.report("Read VCD");
   }
   else
@@ -124,6 +126,14 @@ VcdParse::VcdParse(Report *report,
 {
 }
 
+void
+VcdParse::setThreadCount(size_t thread_count,
+                         DispatchQueue *dispatch_queue)
+{
+  thread_count_ = thread_count;
+  dispatch_queue_ = dispatch_queue;
+}
+
 void
 VcdParse::parseTimescale()
 {
@@ -196,7 +206,7 @@ VcdParse::parseVar()
           name += ' ';
         name += tokens[4];
       }
-      reader_->makeVar(scope_, name, type, width, id);
+      reader_->makeVar(scope_, name, type, width, id, var_index_map_.makeIndex(id));
     }
   }
   else
@@ -221,51 +231,299 @@ VcdParse::parseUpscope()
 void
 VcdParse::parseVarValues()
 {
-  std::string token = getToken();
+  VcdReader *chunk_reader = (thread_count_ > 1 && stream_)
+    ? reader_->makeChunkReader()
+    : nullptr;
+  if (chunk_reader)
+    parseVarValuesChunks(chunk_reader);
+  else
+    parseVarValueTokens();
+
+  // Set time_max to end_time if specified, otherwise use actual parsed time
+  if (end_time_ != vcd_null_time) {
+    reader_->setTimeMax(end_time_);
+  } else {
+    reader_->setTimeMax(time_);
+  }
+}
+
+void
+VcdParse::parseVarValueTokens()
+{
+  std::string_view token = getToken();
   while (!token.empty()) {
     char char0 = toupper(token[0]);
     if (char0 == '#' && token.size() > 1) {
-      VcdTime time = std::stoll(token.substr(1));
+      VcdTime time = parseTime(token.substr(1));
       prev_time_ = time_;
       time_ = time;
-      if (time_ > prev_time_)
+      // Chunk parsers start with no time.
+      if (prev_time_ != vcd_null_time && time_ > prev_time_)
         reader_->varMinDeltaTime(time_ - prev_time_);
     }
     else if (char0 == '0' || char0 == '1' || char0 == 'X' || char0 == 'U'
              || char0 == 'Z') {
-      std::string id = token.substr(1);
-      if (!reader_->varIdValid(id))
+      std::string_view id = token.substr(1);
+      VcdVarIndex var_index = var_indices_->findIndex(id);
+      if (var_index != vcd_null_var_index)
+        reader_->varAppendValue(var_index, time_, char0);
+      else if (!reader_->varIdValid(id))
         report_->fileError(808, filename_, file_line_, "unknown variable {}", id);
-      reader_->varAppendValue(id, time_, char0);
     }
     else if (char0 == 'B') {
-      std::string bus_value = token.substr(1);
-      std::string id = getToken();
-      if (!reader_->varIdValid(id))
+      // Copy the bus value before the id token replaces it.
+      // Reverse the bus value to match the bit order in the VCD file.
+      bus_value_.assign(token.rbegin(), token.rend() - 1);
+      std::string_view id = getToken();
+      VcdVarIndex var_index = var_indices_->findIndex(id);
+      if (var_index != vcd_null_var_index)
+        reader_->varAppendBusValue(var_index, time_, bus_value_);
+      else if (!reader_->varIdValid(id))
         report_->fileError(807, filename_, file_line_, "unknown variable {}", id);
-      else {
-        // Reverse the bus value to match the bit order in the VCD file.
-        std::ranges::reverse(bus_value);
-        reader_->varAppendBusValue(id, time_, bus_value);
-      }
     }
     token = getToken();
   }
+}
 
-  // Set time_max to end_time if specified, otherwise use actual parsed time
-  if (end_time_ != vcd_null_time) {
-    reader_->setTimeMax(end_time_);
-  } else {
-    reader_->setTimeMax(time_);
+VcdTime
+VcdParse::parseTime(std::string_view time_str)
+{
+  VcdTime time = 0;
+  auto [ptr, ec] = std::from_chars(time_str.data(),
+                                   time_str.data() + time_str.size(), time);
+  if (ec == std::errc::invalid_argument)
+    report_->fileError(805, filename_, file_line_, "invalid time {}", time_str);
+  else if (ec == std::errc::result_out_of_range)
+    report_->fileError(806, filename_, file_line_, "time out of range {}",
+                       time_str);
+  return time;
+}
+
+////////////////////////////////////////////////////////////////
+
+// Text of the value changes parsed by a chunk parser.
+class VcdChunk
+{
+public:
+  std::vector<char> text;
+  int line = 0;
+  VcdTime time = vcd_null_time;
+  VcdTime prev_time = vcd_null_time;
+  VcdReader *reader = nullptr;
+  std::exception_ptr error;
+};
+
+// The value changes after the header are a time ordered stream, so they
+// are split into chunks that start at #time lines. Chunks are parsed
+// into chunk readers in parallel and merged into the reader in file
+// order. Chunks are read in batches of one per thread to limit the
+// memory used for the text.
+void
+VcdParse::parseVarValuesChunks(VcdReader *chunk_reader)
+{
+  Stats stats(debug_, report_);
+  // Start with the text remaining in the tokenizer buffer.
+  chunk_carry_.assign(buffer_.begin() + buffer_pos_,
+                      buffer_.begin() + buffer_end_);
+  buffer_pos_ = buffer_end_ = 0;
+  size_t chunk_count = 0;
+  bool more = true;
+  while (more) {
+    std::vector<VcdChunk> chunks(thread_count_);
+    size_t batch_count = 0;
+    for (VcdChunk &chunk : chunks) {
+      chunk.line = file_line_;
+      if (chunk_reader) {
+        // The first chunk continues the value changes at the current time.
+        chunk.reader = chunk_reader;
+        chunk.time = time_;
+        chunk.prev_time = prev_time_;
+        chunk_reader = nullptr;
+      }
+      else
+        chunk.reader = reader_->makeChunkReader();
+      more = readChunk(chunk);
+      file_line_ += std::count(chunk.text.begin(), chunk.text.end(), '\n');
+      batch_count++;
+      if (!more)
+        break;
+    }
+    chunks.resize(batch_count);
+
+    for (VcdChunk &chunk : chunks)
+      dispatch_queue_->dispatch([this, &chunk](size_t) {
+        parseChunk(chunk);
+      });
+    dispatch_queue_->finishTasks();
+
+    for (VcdChunk &chunk : chunks) {
+      if (chunk.error) {
+        for (VcdChunk &chunk1 : chunks)
+          delete chunk1.reader;
+        std::rethrow_exception(chunk.error);
+      }
+      reader_->mergeChunkReader(chunk.reader);
+      delete chunk.reader;
+      chunk.reader = nullptr;
+      if (chunk.time != vcd_null_time) {
+        time_ = chunk.time;
+        prev_time_ = chunk.prev_time;
+      }
+    }
+    chunk_count += chunks.size();
   }
+  chunk_carry_.clear();
+  chunk_carry_.shrink_to_fit();
+  debugPrint(debug_, "read_vcd", 1, "parsed {} value change chunks",
+             chunk_count);
+  stats.report("Read VCD value changes");
 }
 
+// Return the start of the last line in text after begin that starts
+// with #time, or 0 if there is none. A #time token after a bus value is
+// the bus id so it does not start a chunk.
+static size_t
+findChunkEnd(const std::vector<char> &text,
+             size_t begin)
+{
+  size_t pos = text.size();
+  while (pos > begin + 1) {
+    pos--;
+    if (text[pos - 1] == '\n'
+        && text[pos] == '#'
+        && pos + 1 < text.size()
+        && std::isdigit(static_cast<unsigned char>(text[pos + 1]))) {
+      size_t token_end = pos - 1;
+      while (token_end > 0
+             && std::isspace(static_cast<unsigned char>(text[token_end - 1])))
+        token_end--;
+      size_t token_begin = token_end;
+      while (token_begin > 0
+             && !std::isspace(static_cast<unsigned char>(text[token_begin - 1])))
+        token_begin--;
+      if (token_begin == token_end
+          || (text[token_begin] != 'b' && text[token_begin] != 'B'))
+        return pos;
+    }
+  }
+  return 0;
+}
+
+// Read the text of the next chunk. Return false at the end of the file.
+bool
+VcdParse::readChunk(VcdChunk &chunk)
+{
+  std::vector<char> &text = chunk.text;
+  text.swap(chunk_carry_);
+  chunk_carry_.clear();
+  size_t search_begin = 0;
+  for (;;) {
+    size_t text_size = text.size();
+    size_t read_size = std::max(chunk_size_, text_size);
+    text.resize(text_size + read_size);
+    int length = gzread(stream_, text.data() + text_size, read_size);
+    text.resize(text_size + std::max(length, 0));
+    if (length <= 0)
+      return false;
+    if (text.size() >= chunk_size_) {
+      size_t chunk_end = findChunkEnd(text, search_begin);
+      if (chunk_end > 0) {
+        chunk_carry_.assign(text.begin() + chunk_end, text.end());
+        text.resize(chunk_end);
+        return true;
+      }
+      search_begin = text_size;
+    }
+  }
+}
+
+void
+VcdParse::parseChunk(VcdChunk &chunk)
+{
+  VcdParse chunk_parse(report_, debug_);
+  chunk_parse.filename_ = filename_;
+  chunk_parse.reader_ = chunk.reader;
+  chunk_parse.begin_time_ = begin_time_;
+  chunk_parse.end_time_ = end_time_;
+  chunk_parse.var_indices_ = var_indices_;
+  chunk_parse.file_line_ = chunk.line;
+  chunk_parse.time_ = chunk.time;
+  chunk_parse.prev_time_ = chunk.prev_time;
+  chunk_parse.buffer_ = std::move(chunk.text);
+  chunk_parse.buffer_end_ = chunk_parse.buffer_.size();
+  try {
+    chunk_parse.parseVarValueTokens();
+  }
+  catch (...) {
+    chunk.error = std::current_exception();
+  }
+  chunk.time = chunk_parse.time_;
+  chunk.prev_time = chunk_parse.prev_time_;
+}
+
+////////////////////////////////////////////////////////////////
+
+bool
+VcdVarIndexMap::idCode(std::string_view id,
+                       size_t &code)
+{
+  if (id.empty() || id.size() > 4)
+    return false;
+  code = 0;
+  for (auto itr = id.rbegin(); itr != id.rend(); itr++) {
+    char ch = *itr;
+    if (ch < '!' || ch > '~')
+      return false;
+    code = code * 94 + (ch - '!' + 1);
+  }
+  return true;
+}
+
+VcdVarIndex
+VcdVarIndexMap::makeIndex(std::string_view id)
+{
+  VcdVarIndex next_index = indices_.size();
+  auto [itr, inserted] = indices_.try_emplace(std::string(id), next_index);
+  if (inserted) {
+    size_t code;
+    if (idCode(id, code) && code < code_indices_max_) {
+      if (code >= code_indices_.size())
+        code_indices_.resize(code + 1, vcd_null_var_index);
+      code_indices_[code] = itr->second;
+    }
+  }
+  return itr->second;
+}
+
+VcdVarIndex
+VcdVarIndexMap::findIndex(std::string_view id) const
+{
+  size_t code;
+  if (idCode(id, code) && code < code_indices_max_)
+    return (code < code_indices_.size())
+      ? code_indices_[code]
+      : vcd_null_var_index;
+  auto itr = indices_.find(std::string(id));
+  if (itr == indices_.end())
+    return vcd_null_var_index;
+  return itr->second;
+}
+
+void
+VcdVarIndexMap::clear()
+{
+  indices_.clear();
+  code_indices_.clear();
+}
+
+////////////////////////////////////////////////////////////////
+
 std::string
 VcdParse::readStmtString()
 {
   stmt_line_ = file_line_;
   std::string line;
-  std::string token = getToken();
+  std::string_view token = getToken();
   while (!token.empty() && token != "$end") {
     if (!line.empty())
       line += " ";
@@ -280,35 +538,71 @@ VcdParse::readStmtTokens()
 {
   stmt_line_ = file_line_;
   std::vector<std::string> tokens;
-  std::string token = getToken();
+  std::string_view token = getToken();
   while (!token.empty() && token != "$end") {
-    tokens.push_back(token);
+    tokens.emplace_back(token);
     token = getToken();
   }
   return tokens;
 }
 
-std::string
+std::string_view
 VcdParse::getToken()
 {
-  std::string token;
-  int ch = gzgetc(stream_);
   // skip whitespace
-  while (ch != EOF && std::isspace(ch)) {
+  for (;;) {
+    if (buffer_pos_ == buffer_end_) {
+      size_t keep_begin = buffer_pos_;
+      if (!fillBuffer(keep_begin))
+        return {};
+    }
+    char ch = buffer_[buffer_pos_];
+    if (!std::isspace(static_cast<unsigned char>(ch)))
+      break;
     if (ch == '\n')
       file_line_++;
-    ch = gzgetc(stream_);
+    buffer_pos_++;
   }
-  while (ch != EOF && !std::isspace(ch)) {
-    token.push_back(ch);
-    ch = gzgetc(stream_);
+  size_t token_begin = buffer_pos_;
+  for (;;) {
+    if (buffer_pos_ == buffer_end_
+        && !fillBuffer(token_begin))
+      // A token ended by the end of the file is ignored.
+      return {};
+    char ch = buffer_[buffer_pos_++];
+    if (std::isspace(static_cast<unsigned char>(ch))) {
+      if (ch == '\n')
+        file_line_++;
+      return std::string_view(&buffer_[token_begin],
+                              buffer_pos_ - token_begin - 1);
+    }
   }
-  if (ch == '\n')
-    file_line_++;
-  if (ch == EOF)
-    return "";
-  else
-    return token;
+}
+
+// Move the unread text from keep_begin to the front of the buffer
+// and read the next block of the file after it.
+bool
+VcdParse::fillBuffer(size_t &keep_begin)
+{
+  // Chunk parsers tokenize text that is already read.
+  if (stream_ == nullptr)
+    return false;
+  size_t keep_size = buffer_end_ - keep_begin;
+  if (keep_begin > 0)
+    std::copy(buffer_.begin() + keep_begin, buffer_.begin() + buffer_end_,
+              buffer_.begin());
+  else if (keep_size == buffer_.size())
+    // Token longer than the buffer.
+    buffer_.resize(buffer_.size() * 2);
+  buffer_pos_ -= keep_begin;
+  buffer_end_ = keep_size;
+  keep_begin = 0;
+  int length = gzread(stream_, buffer_.data() + buffer_end_,
+                      buffer_.size() - buffer_end_);
+  if (length <= 0)
+    return false;
+  buffer_end_ += length;
+  return true;
 }
 
 ////////////////////////////////////////////////////////////////
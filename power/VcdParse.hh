@@ -26,6 +26,8 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "StaState.hh"
@@ -38,6 +40,9 @@ using VcdScope = std::vector<std::string>;
 
 // Sentinel for an unset begin/end time window bound.
 constexpr VcdTime vcd_null_time = -1;
+// Dense index of a var id code assigned by VcdParse.
+using VcdVarIndex = uint32_t;
+constexpr VcdVarIndex vcd_null_var_index = UINT32_MAX;
 
 enum class VcdVarType {
   wire,
@@ -60,12 +65,38 @@ enum class VcdVarType {
 };
 
 class VcdReader;
+class VcdChunk;
+
+// Dense index of each var id code. Simulators assign id codes
+// sequentially from the printable characters '!' to '~', so the
+// bijective base 94 value of short id codes indexes a table and value
+// changes do not hash the id.
+class VcdVarIndexMap
+{
+public:
+  VcdVarIndex makeIndex(std::string_view id);
+  VcdVarIndex findIndex(std::string_view id) const;
+  void clear();
+
+private:
+  static bool idCode(std::string_view id,
+                     size_t &code);
+
+  std::unordered_map<std::string, VcdVarIndex> indices_;
+  std::vector<VcdVarIndex> code_indices_;
+
+  static constexpr size_t code_indices_max_ = 1 << 22;
+};
 
 class VcdParse : public StaState
 {
 public:
   VcdParse(Report *report,
            Debug *debug);
+  // Parse the value changes in parallel chunks when the reader
+  // makes chunk readers.
+  void setThreadCount(size_t thread_count,
+                      DispatchQueue *dispatch_queue);
   void read(const char *filename,
             VcdReader *reader,
             VcdTime begin_time,
@@ -79,13 +110,25 @@ private:
   void parseScope();
   void parseUpscope();
   void parseVarValues();
-  std::string getToken();
+  void parseVarValueTokens();
+  void parseVarValuesChunks(VcdReader *chunk_reader);
+  bool readChunk(VcdChunk &chunk);
+  void parseChunk(VcdChunk &chunk);
+  VcdTime parseTime(std::string_view time_str);
+  // Token is valid until the next call.
+  std::string_view getToken();
+  bool fillBuffer(size_t &keep_begin);
   std::string readStmtString();
   std::vector<std::string> readStmtTokens();
 
   VcdReader *reader_ = nullptr;
-  gzFile stream_;
-  std::string token_;
+  gzFile stream_ = nullptr;
+  // Block of the file being tokenized.
+  std::vector<char> buffer_;
+  size_t buffer_pos_ = 0;
+  size_t buffer_end_ = 0;
+  // Reversed bus value.
+  std::string bus_value_;
   const char *filename_;
   int file_line_ = 0;
   int stmt_line_ = 0;
@@ -99,6 +142,15 @@ private:
 
   VcdScope scope_;
 
+  VcdVarIndexMap var_index_map_;
+  // var_index_map_ or the map of the parser that made a chunk parser.
+  const VcdVarIndexMap *var_indices_ = &var_index_map_;
+  // Value changes read after the chunks being parsed.
+  std::vector<char> chunk_carry_;
+
+  static constexpr size_t buffer_size_ = 1 << 20;
+  static constexpr size_t chunk_size_ = 1 << 22;
+
   Report *report_;
   Debug *debug_;
 };
@@ -117,18 +169,27 @@ public:
   virtual void setTimeMin(VcdTime time) = 0;
   virtual void setTimeMax(VcdTime time) = 0;
   virtual void varMinDeltaTime(VcdTime min_delta_time) = 0;
+  // Called for value changes of ids without a $var.
   virtual bool varIdValid(std::string_view id) = 0;
+  // Vars with the same id share var_index.
   virtual void makeVar(const VcdScope &scope,
                        std::string_view name,
                        VcdVarType type,
                        size_t width,
-                       std::string_view id) = 0;
-  virtual void varAppendValue(const std::string &id,
+                       std::string_view id,
+                       VcdVarIndex var_index) = 0;
+  virtual void varAppendValue(VcdVarIndex var_index,
                               VcdTime time,
                               char value) = 0;
-  virtual void varAppendBusValue(const std::string &id,
+  virtual void varAppendBusValue(VcdVarIndex var_index,
                                  VcdTime time,
                                  std::string_view bus_value) = 0;
+  // Reader for the value changes in a chunk of the file that is parsed
+  // in parallel with other chunks, or nullptr to parse them serially.
+  // Chunk readers are merged in file order and deleted by VcdParse.
+  // varMinDeltaTime is not called across chunk boundaries.
+  virtual VcdReader *makeChunkReader() { return nullptr; }
+  virtual void mergeChunkReader(VcdReader *) {}
 };
 
 class VcdValue
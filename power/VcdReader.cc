@@ -24,11 +24,14 @@
 
 #include "VcdReader.hh"
 
+#include <algorithm>
 #include <cmath>
 #include <cinttypes>
+#include <functional>
 #include <unordered_map>
 #include <vector>
 
+#include "ContainerHelpers.hh"
 #include "Debug.hh"
 #include "Liberty.hh"
 #include "Mode.hh"
@@ -36,6 +39,8 @@
 #include "ParseBus.hh"
 #include "PortDirection.hh"
 #include "Power.hh"
+#include "ReportPower.hh"
+#include "Scene.hh"
 #include "Sdc.hh"
 #include "Sta.hh"
 #include "VcdParse.hh"
@@ -52,6 +57,16 @@ public:
   VcdTime highTime(VcdTime time_max) const;
   void incrCounts(VcdTime time,
                   char value);
+  // Add the counts of a later chunk of the value changes that starts
+  // with first_time/first_value.
+  void incrCounts(const VcdCount &chunk_count,
+                  VcdTime first_time,
+                  char first_value);
+  // Transition count and high time since the previous window end.
+  void windowCounts(VcdTime window_end,
+                    // Return values.
+                    double &transition_count,
+                    VcdTime &high_time);
   void addPin(const Pin *pin);
   const PinSeq &pins() const { return pins_; }
 
@@ -65,6 +80,8 @@ private:
   char prev_value_ = '\0';
   VcdTime high_time_ = 0;
   double transition_count_ = 0;
+  double window_transition_count_ = 0;
+  VcdTime window_high_time_ = 0;
 
   static VcdTime begin_time_;
   static VcdTime end_time_;
@@ -125,6 +142,22 @@ VcdCount::incrCounts(VcdTime time,
   }
 }
 
+void
+VcdCount::incrCounts(const VcdCount &chunk_count,
+                     VcdTime first_time,
+                     char first_value)
+{
+  // The first value change in the chunk did not count because the chunk
+  // does not know the previous value.
+  incrCounts(first_time, first_value);
+  high_time_ += chunk_count.high_time_;
+  transition_count_ += chunk_count.transition_count_;
+  if (chunk_count.prev_time_ != vcd_null_time) {
+    prev_time_ = chunk_count.prev_time_;
+    prev_value_ = chunk_count.prev_value_;
+  }
+}
+
 VcdTime
 VcdCount::highTime(VcdTime time_max) const
 {
@@ -139,12 +172,43 @@ VcdCount::highTime(VcdTime time_max) const
     return high_time_;
 }
 
+void
+VcdCount::windowCounts(VcdTime window_end,
+                       // Return values.
+                       double &transition_count,
+                       VcdTime &high_time)
+{
+  VcdTime window_high_time = highTime(window_end);
+  transition_count = transition_count_ - window_transition_count_;
+  high_time = window_high_time - window_high_time_;
+  window_transition_count_ = transition_count_;
+  window_high_time_ = window_high_time;
+}
+
 ////////////////////////////////////////////////////////////////
 
 // VcdCount[bit]
 using VcdCounts = std::vector<VcdCount>;
-// ID -> VcdCount[bit]
-using VcdIdCountsMap = std::unordered_map<std::string, VcdCounts>;
+// VcdVarIndex -> VcdCount[bit]
+using VcdVarCountsSeq = std::vector<VcdCounts>;
+using InstEnergyMap = std::unordered_map<const Instance*, PowerResult>;
+// Called with the begin/end times of each window of the value changes.
+using VcdWindowEnd = std::function<void (VcdTime begin,
+                                         VcdTime end)>;
+
+static char
+busBitValue(std::string_view bus_value,
+            size_t bit_idx)
+{
+  if (bus_value.size() == 1)
+    return bus_value[0];
+  else if (bit_idx < bus_value.size())
+    return bus_value[bit_idx];
+  else
+    return '0';
+}
+
+class VcdCountChunkReader;
 
 class VcdCountReader : public VcdReader
 {
@@ -155,8 +219,15 @@ public:
                  Debug *debug);
   VcdTime timeMax() const { return time_max_; }
   VcdTime timeMin() const { return time_min_; }
-  const VcdIdCountsMap &countMap() const { return vcd_count_map_; }
+  const VcdVarCountsSeq &varCounts() const { return var_counts_; }
+  VcdVarCountsSeq &varCounts() { return var_counts_; }
   double timeScale() const { return time_scale_; }
+  // Call window_end as the value changes pass each window
+  // of window seconds. The value changes are read serially.
+  void setWindow(double window,
+                 VcdWindowEnd window_end);
+  // Call window_end for the windows up to the max time.
+  void finishWindows();
 
   // VcdParse callbacks.
   void setDate(std::string_view ) override {}
@@ -173,26 +244,35 @@ public:
                std::string_view name,
                VcdVarType type,
                size_t width,
-               std::string_view id) override;
-  void varAppendValue(const std::string &id,
+               std::string_view id,
+               VcdVarIndex var_index) override;
+  void varAppendValue(VcdVarIndex var_index,
                       VcdTime time,
                       char value) override;
-  void varAppendBusValue(const std::string &id,
+  void varAppendBusValue(VcdVarIndex var_index,
                          VcdTime time,
                          std::string_view bus_value) override;
+  VcdReader *makeChunkReader() override;
+  void mergeChunkReader(VcdReader *chunk_reader) override;
 
 private:
   void addVarPin(std::string_view pin_name,
                  std::string_view id,
+                 VcdVarIndex var_index,
                  size_t width,
                  size_t bit_idx);
+  void closeWindows(VcdTime time);
 
   const std::string scope_;
 
   double time_scale_ = 1.0;
   VcdTime time_min_ = 0;
   VcdTime time_max_ = 0;
-  VcdIdCountsMap vcd_count_map_;
+  VcdVarCountsSeq var_counts_;
+  double window_ = 0.0;
+  VcdWindowEnd window_end_;
+  VcdTime window_ticks_ = 0;
+  VcdTime window_begin_ = 0;
 
   const Network *sdc_network_;
   Report *report_;
@@ -243,7 +323,8 @@ VcdCountReader::makeVar(const VcdScope &scope,
                         std::string_view name,
                         VcdVarType type,
                         size_t width,
-                        std::string_view id)
+                        std::string_view id,
+                        VcdVarIndex var_index)
 {
   if (type == VcdVarType::wire || type == VcdVarType::reg) {
     std::string path_name;
@@ -263,7 +344,7 @@ VcdCountReader::makeVar(const VcdScope &scope,
       std::string var_scoped = path_name.substr(scope_length + 1);
       if (width == 1) {
         std::string pin_name = netVerilogToSta(var_scoped);
-        addVarPin(pin_name, id, width, 0);
+        addVarPin(pin_name, id, var_index, width, 0);
       }
       else {
         bool is_bus, is_range, subscript_wild;
@@ -280,7 +361,7 @@ VcdCountReader::makeVar(const VcdScope &scope,
               pin_name += '[';
               pin_name += std::to_string(bus_bit);
               pin_name += ']';
-              addVarPin(pin_name, id, width, bit_idx);
+              addVarPin(pin_name, id, var_index, width, bit_idx);
               bit_idx++;
             }
           }
@@ -290,7 +371,7 @@ VcdCountReader::makeVar(const VcdScope &scope,
               pin_name += '[';
               pin_name += std::to_string(bus_bit);
               pin_name += ']';
-              addVarPin(pin_name, id, width, bit_idx);
+              addVarPin(pin_name, id, var_index, width, bit_idx);
               bit_idx++;
             }
           }
@@ -305,6 +386,7 @@ VcdCountReader::makeVar(const VcdScope &scope,
 void
 VcdCountReader::addVarPin(std::string_view pin_name,
                           std::string_view id,
+                          VcdVarIndex var_index,
                           size_t width,
                           size_t bit_idx)
 {
@@ -314,7 +396,9 @@ VcdCountReader::addVarPin(std::string_view pin_name,
       && !sdc_network_->direction(pin)->isInternal()
       && !sdc_network_->direction(pin)->isPowerGround()
       && !(liberty_port && liberty_port->isPwrGnd())) {
-    VcdCounts &vcd_counts = vcd_count_map_[std::string(id)];
+    if (var_index >= var_counts_.size())
+      var_counts_.resize(var_index + 1);
+    VcdCounts &vcd_counts = var_counts_[var_index];
     vcd_counts.resize(width);
     vcd_counts[bit_idx].addPin(pin);
     debugPrint(debug_, "read_vcd", 2, "id {} pin {}", id, pin_name);
@@ -322,13 +406,48 @@ VcdCountReader::addVarPin(std::string_view pin_name,
 }
 
 void
-VcdCountReader::varAppendValue(const std::string &id,
+VcdCountReader::setWindow(double window,
+                          VcdWindowEnd window_end)
+{
+  window_ = window;
+  window_end_ = std::move(window_end);
+  window_ticks_ = 0;
+}
+
+// Report the windows that end at or before time.
+void
+VcdCountReader::closeWindows(VcdTime time)
+{
+  if (window_ticks_ == 0) {
+    // The time scale is known once the value changes start.
+    window_ticks_ = std::max(std::llround(window_ / time_scale_), 1LL);
+    window_begin_ = time_min_;
+  }
+  while (time >= window_begin_ + window_ticks_) {
+    VcdTime window_end = window_begin_ + window_ticks_;
+    window_end_(window_begin_, window_end);
+    window_begin_ = window_end;
+  }
+}
+
+void
+VcdCountReader::finishWindows()
+{
+  closeWindows(time_max_);
+  // Partial window at the end.
+  if (time_max_ > window_begin_)
+    window_end_(window_begin_, time_max_);
+}
+
+void
+VcdCountReader::varAppendValue(VcdVarIndex var_index,
                                VcdTime time,
                                char value)
 {
-  const auto &itr = vcd_count_map_.find(id);
-  if (itr != vcd_count_map_.end()) {
-    VcdCounts &vcd_counts = itr->second;
+  if (window_end_)
+    closeWindows(time);
+  if (var_index < var_counts_.size()) {
+    VcdCounts &vcd_counts = var_counts_[var_index];
     if (debug_->check("read_vcd", 3)) {
       for (auto &vcd_count : vcd_counts) {
         for (const Pin *pin : vcd_count.pins()) {
@@ -344,21 +463,16 @@ VcdCountReader::varAppendValue(const std::string &id,
 }
 
 void
-VcdCountReader::varAppendBusValue(const std::string &id,
+VcdCountReader::varAppendBusValue(VcdVarIndex var_index,
                                   VcdTime time,
                                   std::string_view bus_value)
 {
-  const auto &itr = vcd_count_map_.find(id);
-  if (itr != vcd_count_map_.end()) {
-    VcdCounts &vcd_counts = itr->second;
+  if (window_end_)
+    closeWindows(time);
+  if (var_index < var_counts_.size()) {
+    VcdCounts &vcd_counts = var_counts_[var_index];
     for (size_t bit_idx = 0; bit_idx < vcd_counts.size(); bit_idx++) {
-      char bit_value;
-      if (bus_value.size() == 1)
-        bit_value = bus_value[0];
-      else if (bit_idx < bus_value.size())
-        bit_value = bus_value[bit_idx];
-      else
-        bit_value = '0';
+      char bit_value = busBitValue(bus_value, bit_idx);
       VcdCount &vcd_count = vcd_counts[bit_idx];
       vcd_count.incrCounts(time, bit_value);
       if (debug_->check("read_vcd", 3)) {
@@ -373,6 +487,139 @@ VcdCountReader::varAppendBusValue(const std::string &id,
 
 ////////////////////////////////////////////////////////////////
 
+// Counts of one var bit for a chunk of the value changes.
+class VcdChunkCount
+{
+public:
+  VcdVarIndex var_index;
+  size_t bit_idx;
+  VcdTime first_time;
+  char first_value;
+  VcdCount count;
+};
+
+// Counts the value changes in a chunk of the file for the var bits
+// that change in the chunk.
+class VcdCountChunkReader : public VcdReader
+{
+public:
+  VcdCountChunkReader(const VcdVarCountsSeq &var_counts);
+  const std::vector<VcdChunkCount> &counts() const { return counts_; }
+
+  void setDate(std::string_view ) override {}
+  void setComment(std::string_view ) override {}
+  void setVersion(std::string_view ) override {}
+  void setTimeUnit(std::string_view ,
+                   double ,
+                   double ) override {}
+  void setTimeMin(VcdTime ) override {}
+  void setTimeMax(VcdTime ) override {}
+  void varMinDeltaTime(VcdTime) override {}
+  bool varIdValid(std::string_view ) override { return true; }
+  void makeVar(const VcdScope &,
+               std::string_view ,
+               VcdVarType ,
+               size_t ,
+               std::string_view ,
+               VcdVarIndex ) override {}
+  void varAppendValue(VcdVarIndex var_index,
+                      VcdTime time,
+                      char value) override;
+  void varAppendBusValue(VcdVarIndex var_index,
+                         VcdTime time,
+                         std::string_view bus_value) override;
+
+private:
+  void incrCounts(VcdVarIndex var_index,
+                  size_t bit_idx,
+                  VcdTime time,
+                  char value);
+
+  const VcdVarCountsSeq &var_counts_;
+  // Index of the counts_ for the first bit of each var.
+  std::vector<size_t> var_count_indices_;
+  std::vector<VcdChunkCount> counts_;
+
+  static constexpr size_t null_count_index_ = SIZE_MAX;
+};
+
+VcdCountChunkReader::VcdCountChunkReader(const VcdVarCountsSeq &var_counts) :
+  var_counts_(var_counts),
+  var_count_indices_(var_counts.size(), null_count_index_)
+{
+}
+
+void
+VcdCountChunkReader::varAppendValue(VcdVarIndex var_index,
+                                    VcdTime time,
+                                    char value)
+{
+  if (var_index < var_counts_.size()) {
+    size_t width = var_counts_[var_index].size();
+    for (size_t bit_idx = 0; bit_idx < width; bit_idx++)
+      incrCounts(var_index, bit_idx, time, value);
+  }
+}
+
+void
+VcdCountChunkReader::varAppendBusValue(VcdVarIndex var_index,
+                                       VcdTime time,
+                                       std::string_view bus_value)
+{
+  if (var_index < var_counts_.size()) {
+    size_t width = var_counts_[var_index].size();
+    for (size_t bit_idx = 0; bit_idx < width; bit_idx++)
+      incrCounts(var_index, bit_idx, time, busBitValue(bus_value, bit_idx));
+  }
+}
+
+void
+VcdCountChunkReader::incrCounts(VcdVarIndex var_index,
+                                size_t bit_idx,
+                                VcdTime time,
+                                char value)
+{
+  size_t &count_index = var_count_indices_[var_index];
+  if (count_index == null_count_index_) {
+    count_index = counts_.size();
+    size_t width = var_counts_[var_index].size();
+    for (size_t bit = 0; bit < width; bit++)
+      counts_.push_back({var_index, bit, vcd_null_time, '\0', VcdCount()});
+  }
+  VcdChunkCount &chunk_count = counts_[count_index + bit_idx];
+  if (chunk_count.first_time == vcd_null_time) {
+    chunk_count.first_time = time;
+    chunk_count.first_value = value;
+  }
+  chunk_count.count.incrCounts(time, value);
+}
+
+VcdReader *
+VcdCountReader::makeChunkReader()
+{
+  // Debug traces of the value changes are reported in file order
+  // and windows are reported as the value changes pass them.
+  if (debug_->check("read_vcd", 3) || window_end_)
+    return nullptr;
+  return new VcdCountChunkReader(var_counts_);
+}
+
+void
+VcdCountReader::mergeChunkReader(VcdReader *chunk_reader)
+{
+  VcdCountChunkReader *count_reader =
+    static_cast<VcdCountChunkReader*>(chunk_reader);
+  for (const VcdChunkCount &chunk_count : count_reader->counts()) {
+    if (chunk_count.first_time != vcd_null_time) {
+      VcdCount &vcd_count = var_counts_[chunk_count.var_index][chunk_count.bit_idx];
+      vcd_count.incrCounts(chunk_count.count, chunk_count.first_time,
+                           chunk_count.first_value);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////
+
 class ReadVcdActivities : public StaState
 {
 public:
@@ -383,9 +630,21 @@ public:
                     const Sdc *sdc,
                     Sta *sta);
   void readActivities();
+  void reportPowerWindows(double window,
+                          size_t inst_count,
+                          const Scene *scene,
+                          int digits);
 
 private:
   void setActivities();
+  void findCountEnergies(const Scene *scene);
+  void addCountEnergies(const Pin *pin,
+                        const Scene *scene,
+                        PinSet &energy_pins,
+                        InstEnergyMap &energies);
+  void windowEnergies(VcdTime end,
+                      // Return value.
+                      InstEnergyMap &inst_energies);
   void checkClkPeriod(const Pin *pin,
                       double transition_count);
 
@@ -394,6 +653,8 @@ private:
   VcdTime end_time_;
 
   std::set<const Pin *> annotated_pins_;
+  // Energy of one transition of a vcd count for each instance it reaches.
+  std::unordered_map<const VcdCount*, InstEnergyMap> count_energies_;
   VcdCountReader vcd_reader_;
   VcdParse vcd_parse_;
   const Sdc *sdc_;
@@ -416,6 +677,21 @@ readVcdActivities(std::string_view filename,
   reader.readActivities();
 }
 
+void
+reportVcdPowerWindows(std::string_view filename,
+                      std::string_view scope,
+                      double window,
+                      size_t inst_count,
+                      const Scene *scene,
+                      int digits,
+                      Sta *sta)
+{
+  const Sdc *sdc = scene->mode()->sdc();
+  ReadVcdActivities reader(filename, scope, vcd_null_time, vcd_null_time,
+                           sdc, sta);
+  reader.reportPowerWindows(window, inst_count, scene, digits);
+}
+
 ReadVcdActivities::ReadVcdActivities(std::string_view filename,
                                      std::string_view scope,
                                      VcdTime begin_time,
@@ -446,6 +722,7 @@ ReadVcdActivities::readActivities()
 
   // Set the time window filter once globally
   VcdCount::setFilter(begin_time_, end_time_);
+  vcd_parse_.setThreadCount(thread_count_, dispatch_queue_);
   vcd_parse_.read(filename_.c_str(), &vcd_reader_, begin_time_, end_time_);
 
   if (vcd_reader_.timeMax() > 0)
@@ -455,6 +732,154 @@ ReadVcdActivities::readActivities()
   report_->report("Annotated {} pin activities.", annotated_pins_.size());
 }
 
+// Report the design power of each window from the internal and
+// switching energy of the window value changes in one pass over the
+// vcd. Only the counts and instance energies of the current window are
+// kept, so memory does not grow with the length of the vcd. The
+// activities of the whole vcd are annotated at the end.
+void
+ReadVcdActivities::reportPowerWindows(double window,
+                                      size_t inst_count,
+                                      const Scene *scene,
+                                      int digits)
+{
+  ReportPower report_power(this);
+  report_power.reportWindowTitle(digits);
+  PowerResult leakage;
+  LeafInstanceIterator *leaf_iter = network_->leafInstanceIterator();
+  while (leaf_iter->hasNext()) {
+    const Instance *inst = leaf_iter->next();
+    leakage.incr(power_->leakagePower(inst, scene));
+  }
+  delete leaf_iter;
+
+  VcdTime peak_begin = 0;
+  VcdTime peak_end = 0;
+  PowerResult peak;
+  bool have_peak = false;
+  InstEnergyMap inst_energies;
+  vcd_reader_.setWindow(window, [&] (VcdTime begin,
+                                     VcdTime end) {
+    // The vars are all defined before the first value change.
+    if (count_energies_.empty())
+      findCountEnergies(scene);
+    windowEnergies(end, inst_energies);
+    double time_scale = vcd_reader_.timeScale();
+    double window_time = (end - begin) * time_scale;
+    PowerResult total = leakage;
+    InstPowers inst_pwrs;
+    for (const auto &[inst, energy] : inst_energies) {
+      PowerResult inst_pwr = power_->leakagePower(inst, scene);
+      inst_pwr.incrInternal(energy.internal() / window_time);
+      inst_pwr.incrSwitching(energy.switching() / window_time);
+      total.incrInternal(energy.internal() / window_time);
+      total.incrSwitching(energy.switching() / window_time);
+      if (inst_count > 0)
+        inst_pwrs.emplace_back(inst, inst_pwr);
+    }
+    report_power.reportWindow(begin * time_scale, end * time_scale, total,
+                              digits);
+    if (inst_count > 0) {
+      sort(inst_pwrs, [] (const InstPower &pwr1,
+                          const InstPower &pwr2) {
+        return pwr1.second.total() > pwr2.second.total();
+      });
+      if (inst_pwrs.size() > inst_count)
+        inst_pwrs.resize(inst_count);
+      report_power.reportInsts(inst_pwrs, digits);
+    }
+    if (!have_peak || total.total() > peak.total()) {
+      peak_begin = begin;
+      peak_end = end;
+      peak = total;
+      have_peak = true;
+    }
+    debugPrint(debug_, "read_vcd", 1, "window {} - {}", begin, end);
+  });
+
+  VcdCount::setFilter(vcd_null_time, vcd_null_time);
+  vcd_parse_.read(filename_.c_str(), &vcd_reader_, vcd_null_time, vcd_null_time);
+  if (vcd_reader_.timeMax() > 0) {
+    vcd_reader_.finishWindows();
+    double time_scale = vcd_reader_.timeScale();
+    report_power.reportPeakWindow(peak_begin * time_scale,
+                                  peak_end * time_scale, peak, digits);
+    setActivities();
+  }
+  else
+    report_->warn(1450, "VCD max time is zero.");
+  report_->report("Annotated {} pin activities.", annotated_pins_.size());
+}
+
+// The energy of a transition of a vcd pin is the energy of the leaf
+// pins on its net that have no vcd var of their own.
+void
+ReadVcdActivities::findCountEnergies(const Scene *scene)
+{
+  PinSet energy_pins(network_);
+  for (const VcdCounts &vcd_counts : vcd_reader_.varCounts()) {
+    for (const VcdCount &vcd_count : vcd_counts) {
+      for (const Pin *pin : vcd_count.pins())
+        energy_pins.insert(pin);
+    }
+  }
+  for (const VcdCounts &vcd_counts : vcd_reader_.varCounts()) {
+    for (const VcdCount &vcd_count : vcd_counts) {
+      InstEnergyMap &energies = count_energies_[&vcd_count];
+      for (const Pin *pin : vcd_count.pins())
+        addCountEnergies(pin, scene, energy_pins, energies);
+    }
+  }
+}
+
+void
+ReadVcdActivities::addCountEnergies(const Pin *pin,
+                                    const Scene *scene,
+                                    PinSet &energy_pins,
+                                    InstEnergyMap &energies)
+{
+  if (network_->isLeaf(pin))
+    energies[network_->instance(pin)].incr(power_->pinEnergy(pin, scene));
+  PinConnectedPinIterator *pin_iter = network_->connectedPinIterator(pin);
+  while (pin_iter->hasNext()) {
+    const Pin *load_pin = pin_iter->next();
+    if (network_->isLeaf(load_pin)
+        && !energy_pins.contains(load_pin)) {
+      energy_pins.insert(load_pin);
+      energies[network_->instance(load_pin)].incr(power_->pinEnergy(load_pin,
+                                                                   scene));
+    }
+  }
+  delete pin_iter;
+  debugPrint(debug_, "read_vcd", 2, "energy pin {} instances {}",
+             network_->pathName(pin), energies.size());
+}
+
+void
+ReadVcdActivities::windowEnergies(VcdTime end,
+                                  // Return value.
+                                  InstEnergyMap &inst_energies)
+{
+  inst_energies.clear();
+  for (VcdCounts &vcd_counts : vcd_reader_.varCounts()) {
+    for (VcdCount &vcd_count : vcd_counts) {
+      double transition_count;
+      VcdTime high_time;
+      vcd_count.windowCounts(end, transition_count, high_time);
+      if (transition_count > 0) {
+        auto count_iter = count_energies_.find(&vcd_count);
+        if (count_iter != count_energies_.end()) {
+          for (const auto &[inst, energy] : count_iter->second) {
+            PowerResult &inst_energy = inst_energies[inst];
+            inst_energy.incrInternal(energy.internal() * transition_count);
+            inst_energy.incrSwitching(energy.switching() * transition_count);
+          }
+        }
+      }
+    }
+  }
+}
+
 void
 ReadVcdActivities::setActivities()
 {
@@ -462,7 +887,7 @@ ReadVcdActivities::setActivities()
   VcdTime time_max = vcd_reader_.timeMax();
   VcdTime time_delta = time_max - time_min;
   double time_scale = vcd_reader_.timeScale();
-  for (auto &[id, vcd_counts] : vcd_reader_.countMap()) {
+  for (const VcdCounts &vcd_counts : vcd_reader_.varCounts()) {
     for (const VcdCount &vcd_count : vcd_counts) {
       double transition_count = vcd_count.transitionCount();
       VcdTime high_time = vcd_count.highTime(time_max);
@@ -31,6 +31,7 @@
 namespace sta {
 
 class Sta;
+class Scene;
 
 void
 readVcdActivities(std::string_view filename,
@@ -39,5 +40,16 @@ readVcdActivities(std::string_view filename,
                   VcdTime begin_time,
                   VcdTime end_time,
                   Sta *sta);
+// Report the design power of each window of window seconds
+// of the vcd value changes and the inst_count highest power
+// instances of each window, and annotate the vcd activities.
+void
+reportVcdPowerWindows(std::string_view filename,
+                      std::string_view scope,
+                      double window,
+                      size_t inst_count,
+                      const Scene *scene,
+                      int digits,
+                      Sta *sta);
 
 } // namespace sta
@@ -655,13 +655,23 @@ TEST_F(PwrActivityTest, CheckViaSetDensity) {
 
 // Power design-level tests to exercise Power internal methods
 #include <tcl.h>
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <sstream>
+#include <vector>
 #include "Sta.hh"
 #include "Network.hh"
 #include "ReportTcl.hh"
 #include "Scene.hh"
 #include "PortDirection.hh"
 #include "Liberty.hh"
+#include "Mode.hh"
 #include "power/Power.hh"
+#include "power/SaifReader.hh"
+#include "power/VcdParse.hh"
+#include "power/VcdReader.hh"
 
 namespace sta {
 
@@ -1493,4 +1503,375 @@ TEST_F(PowerDesignTest, ReportActivityAnnotation) {
   pwr->reportActivityAnnotation(false, false);
 }
 
+// Records the value changes of each var index.
+class VcdRecordReader : public VcdReader
+{
+public:
+  void setDate(std::string_view) override {}
+  void setComment(std::string_view) override {}
+  void setVersion(std::string_view) override {}
+  void setTimeUnit(std::string_view, double, double) override {}
+  void setTimeMin(VcdTime) override {}
+  void setTimeMax(VcdTime time) override { time_max = time; }
+  void varMinDeltaTime(VcdTime) override {}
+  bool varIdValid(std::string_view) override { return true; }
+  void makeVar(const VcdScope &,
+               std::string_view name,
+               VcdVarType,
+               size_t,
+               std::string_view,
+               VcdVarIndex var_index) override
+  {
+    var_indices[std::string(name)] = var_index;
+  }
+  void varAppendValue(VcdVarIndex var_index,
+                      VcdTime,
+                      char value) override
+  {
+    values[var_index] += value;
+  }
+  void varAppendBusValue(VcdVarIndex var_index,
+                         VcdTime,
+                         std::string_view bus_value) override
+  {
+    values[var_index] += bus_value;
+  }
+
+  std::map<std::string, VcdVarIndex> var_indices;
+  std::map<VcdVarIndex, std::string> values;
+  VcdTime time_max = 0;
+};
+
+// Value changes split across tokenizer blocks are read intact and
+// short and long id codes map to the vars declared with them.
+TEST_F(PowerDesignTest, VcdParseBufferedTokens) {
+  const char *vcd_path = "/tmp/test_vcd_tokens.vcd";
+  FILE *fp = fopen(vcd_path, "w");
+  ASSERT_NE(fp, nullptr);
+  fprintf(fp, "$timescale 1ps $end\n");
+  fprintf(fp, "$scope module top $end\n");
+  const char *ids[] = {"!", "~", "!!", "~~~", "long_id_code"};
+  int var_count = sizeof(ids) / sizeof(ids[0]);
+  for (int i = 0; i < var_count; i++)
+    fprintf(fp, "$var wire 1 %s v%d $end\n", ids[i], i);
+  fprintf(fp, "$var wire 4 %% bus [3:0] $end\n");
+  fprintf(fp, "$upscope $end\n");
+  fprintf(fp, "$enddefinitions $end\n");
+  fprintf(fp, "$dumpvars\n");
+  std::map<std::string, std::string> expected;
+  int time_count = 60000;
+  for (int t = 0; t < time_count; t++) {
+    fprintf(fp, "#%d\n", t * 10);
+    for (int i = 0; i < var_count; i++) {
+      char value = ((t + i) % 3 == 0) ? 'x' : ('0' + (t + i) % 2);
+      fprintf(fp, "%c%s\n", value, ids[i]);
+      expected[std::string("v") + std::to_string(i)] += toupper(value);
+    }
+    fprintf(fp, "b%d%d01 %%\n", t % 2, (t + 1) % 2);
+    expected["bus[3:0]"] += std::string("10") + char('0' + (t + 1) % 2)
+      + char('0' + t % 2);
+  }
+  fprintf(fp, "#%d\n", time_count * 10);
+  fclose(fp);
+
+  VcdRecordReader reader;
+  VcdParse parse(sta_->report(), sta_->debug());
+  parse.read(vcd_path, &reader, vcd_null_time, vcd_null_time);
+  ASSERT_EQ(reader.var_indices.size(), size_t(var_count + 1));
+  for (auto &[name, var_index] : reader.var_indices)
+    EXPECT_EQ(reader.values[var_index], expected[name]) << name;
+  EXPECT_EQ(reader.time_max, time_count * 10);
+  std::remove(vcd_path);
+}
+
+// Reading the value changes in parallel chunks annotates the same
+// activities as reading them serially.
+TEST_F(PowerDesignTest, ReadVcdParallelMatchesSerial) {
+  ASSERT_TRUE(design_loaded_);
+  Network *network = sta_->network();
+  Instance *top = network->topInstance();
+  PinSet clk_pins(network);
+  clk_pins.insert(network->findPin(top, "clk1"));
+  clk_pins.insert(network->findPin(top, "clk2"));
+  clk_pins.insert(network->findPin(top, "clk3"));
+  FloatSeq waveform{0.0f, 0.5e-9f};
+  sta_->makeClock("clk", clk_pins, false, 1e-9f, waveform, "", sta_->cmdMode());
+
+  const char *vcd_path = "/tmp/test_vcd_parallel.vcd";
+  FILE *fp = fopen(vcd_path, "w");
+  ASSERT_NE(fp, nullptr);
+  fprintf(fp, "$timescale 1ps $end\n");
+  fprintf(fp, "$scope module top $end\n");
+  const char *port_names[] = {"in1", "in2", "clk1", "clk2", "clk3", "out"};
+  const char *ids[] = {"!", "\"", "#", "$", "%", "&"};
+  for (int i = 0; i < 6; i++)
+    fprintf(fp, "$var wire 1 %s %s $end\n", ids[i], port_names[i]);
+  fprintf(fp, "$scope module r1 $end\n");
+  fprintf(fp, "$var wire 1 ' Q $end\n");
+  fprintf(fp, "$upscope $end\n");
+  fprintf(fp, "$upscope $end\n");
+  fprintf(fp, "$enddefinitions $end\n");
+  fprintf(fp, "$dumpvars\n");
+  unsigned rand = 1;
+  for (int t = 0; t < 400000; t++) {
+    fprintf(fp, "#%d\n", t * 500);
+    char clk = (t % 2) ? '1' : '0';
+    fprintf(fp, "%c#\n%c$\n%c%%\n", clk, clk, clk);
+    for (int i : {0, 1, 5}) {
+      rand = rand * 1103515245 + 12345;
+      int r = (rand >> 16) % 8;
+      if (r < 3)
+        fprintf(fp, "%c%s\n", "01x"[r], ids[i]);
+    }
+    if (t % 7 == 0)
+      fprintf(fp, "%c'\n", (t % 14) ? '1' : '0');
+  }
+  fprintf(fp, "#%d\n", 400000 * 500);
+  fclose(fp);
+
+  Scene *corner = sta_->cmdScene();
+  const std::string &mode_name = sta_->cmdMode()->name();
+  std::vector<const Pin*> pins;
+  for (const char *port_name : port_names)
+    pins.push_back(network->findPin(top, port_name));
+  pins.push_back(network->findPin("r1/Q"));
+
+  sta_->setThreadCount(1);
+  readVcdActivities(vcd_path, "top", mode_name, vcd_null_time, vcd_null_time,
+                    sta_);
+  std::vector<PwrActivity> serial_activities;
+  for (const Pin *pin : pins)
+    serial_activities.push_back(sta_->power()->pinActivity(pin, corner));
+
+  sta_->setThreadCount(4);
+  readVcdActivities(vcd_path, "top", mode_name, vcd_null_time, vcd_null_time,
+                    sta_);
+  for (size_t i = 0; i < pins.size(); i++) {
+    PwrActivity activity = sta_->power()->pinActivity(pins[i], corner);
+    EXPECT_EQ(activity.origin(), PwrActivityOrigin::vcd);
+    EXPECT_EQ(activity.density(), serial_activities[i].density());
+    EXPECT_EQ(activity.duty(), serial_activities[i].duty());
+  }
+  std::remove(vcd_path);
+}
+
+// Nets are annotated inside the scope only, including escaped names
+// and repeated leaf cells that share a port lookup.
+TEST_F(PowerDesignTest, ReadSaifScopeNets) {
+  ASSERT_TRUE(design_loaded_);
+  const char *saif_path = "/tmp/test_read_saif.saif";
+  FILE *fp = fopen(saif_path, "w");
+  ASSERT_NE(fp, nullptr);
+  fprintf(fp, "(SAIFILE\n");
+  fprintf(fp, "(SAIFVERSION \"2.0\")\n");
+  fprintf(fp, "(DIRECTION \"backward\")\n");
+  fprintf(fp, "(DESIGN )\n");
+  fprintf(fp, "(VENDOR \"\")\n");
+  fprintf(fp, "/* (INSTANCE commented) */\n");
+  fprintf(fp, "(DIVIDER / )\n");
+  fprintf(fp, "(TIMESCALE 1ns)\n");
+  fprintf(fp, "(DURATION 1000)\n");
+  fprintf(fp, "(INSTANCE tb\n");
+  fprintf(fp, " (INSTANCE other (INSTANCE top (NET (in2 (T1 100) (TC 9)))))\n");
+  fprintf(fp, " (INSTANCE top\n");
+  fprintf(fp, "  (NET (in1 (T0 250) (T1 750) (TC 100)) (r1q (T1 1) (TC 1)))\n");
+  fprintf(fp, "  (INSTANCE r1 (NET (\\Q (T0 500) (T1 500) (TC 200)))) // escaped\n");
+  fprintf(fp, "  (INSTANCE r2 (NET (Q (T1 100) (TC 50))))\n");
+  fprintf(fp, "  (INSTANCE u1 (PORT (A (T1 1) (TC 1))))\n");
+  fprintf(fp, " )\n");
+  fprintf(fp, ")\n");
+  fprintf(fp, ")\n");
+  fclose(fp);
+
+  readSaif(saif_path, "tb/top", sta_);
+  Network *network = sta_->network();
+  Power *power = sta_->power();
+  Scene *corner = sta_->cmdScene();
+  PwrActivity in1 = power->pinActivity(network->findPin("in1"), corner);
+  EXPECT_EQ(in1.origin(), PwrActivityOrigin::saif);
+  EXPECT_FLOAT_EQ(in1.density(), 1e8f);
+  EXPECT_FLOAT_EQ(in1.duty(), 0.75f);
+  PwrActivity r1_q = power->pinActivity(network->findPin("r1/Q"), corner);
+  EXPECT_EQ(r1_q.origin(), PwrActivityOrigin::saif);
+  EXPECT_FLOAT_EQ(r1_q.density(), 2e8f);
+  EXPECT_FLOAT_EQ(r1_q.duty(), 0.5f);
+  PwrActivity r2_q = power->pinActivity(network->findPin("r2/Q"), corner);
+  EXPECT_EQ(r2_q.origin(), PwrActivityOrigin::saif);
+  EXPECT_FLOAT_EQ(r2_q.density(), 5e7f);
+  EXPECT_FLOAT_EQ(r2_q.duty(), 0.1f);
+  EXPECT_NE(power->pinActivity(network->findPin("in2"), corner).origin(),
+            PwrActivityOrigin::saif);
+  EXPECT_NE(power->pinActivity(network->findPin("u1/A"), corner).origin(),
+            PwrActivityOrigin::saif);
+  std::remove(saif_path);
+}
+
+// Each window reports the power of the energy of its own value changes
+// for the instances they reach and the activities of the whole vcd are
+// annotated at the end.
+TEST_F(PowerDesignTest, ReportVcdPowerWindows) {
+  ASSERT_TRUE(design_loaded_);
+  Network *network = sta_->network();
+  Instance *top = network->topInstance();
+  PinSet clk_pins(network);
+  clk_pins.insert(network->findPin(top, "clk1"));
+  FloatSeq waveform{0.0f, 0.5e-9f};
+  sta_->makeClock("clk", clk_pins, false, 1e-9f, waveform, "", sta_->cmdMode());
+
+  const char *vcd_path = "/tmp/test_vcd_windows.vcd";
+  FILE *fp = fopen(vcd_path, "w");
+  ASSERT_NE(fp, nullptr);
+  fprintf(fp, "$timescale 1ps $end\n");
+  fprintf(fp, "$scope module top $end\n");
+  fprintf(fp, "$var wire 1 ! in1 $end\n");
+  fprintf(fp, "$var wire 1 # clk1 $end\n");
+  fprintf(fp, "$upscope $end\n");
+  fprintf(fp, "$enddefinitions $end\n");
+  fprintf(fp, "$dumpvars\n");
+  // in1 only toggles in the second half.
+  for (int t = 0; t < 80; t++) {
+    fprintf(fp, "#%d\n", t * 500);
+    fprintf(fp, "%c#\n", (t % 2) ? '1' : '0');
+    if (t >= 40 && t % 2 == 0)
+      fprintf(fp, "%c!\n", (t % 4) ? '1' : '0');
+  }
+  fprintf(fp, "#%d\n", 80 * 500);
+  fclose(fp);
+
+  Scene *scene = sta_->cmdScene();
+  Power *power = sta_->power();
+  EXPECT_GT(power->pinEnergy(network->findPin("r1/CLK"), scene).total(), 0.0f);
+  EXPECT_GT(power->pinEnergy(network->findPin("r1/D"), scene).total(), 0.0f);
+
+  Report *report = sta_->report();
+  report->redirectStringBegin();
+  reportVcdPowerWindows(vcd_path, "top", 10e-9, 0, scene, 3, sta_);
+  std::string trace = report->redirectStringEnd();
+  size_t dashes = trace.find("---");
+  size_t peak = trace.find("Peak window");
+  ASSERT_NE(dashes, std::string::npos);
+  ASSERT_NE(peak, std::string::npos);
+  std::string rows = trace.substr(trace.find('\n', dashes) + 1,
+                                  peak - dashes);
+  std::istringstream row_stream(rows);
+  std::vector<double> totals;
+  std::string row;
+  while (std::getline(row_stream, row) && row.find("Peak") == std::string::npos) {
+    std::istringstream cols(row);
+    double begin, end, internal, switching, leakage, total;
+    cols >> begin >> end >> internal >> switching >> leakage >> total;
+    totals.push_back(total);
+  }
+  ASSERT_EQ(totals.size(), 4u);
+  // The in1 transitions of the second half add the r1/D energy.
+  EXPECT_GT(totals[2], totals[0]);
+  EXPECT_GT(totals[3], totals[1]);
+
+  // The only instance reached by the vcd pins is r1.
+  report->redirectStringBegin();
+  reportVcdPowerWindows(vcd_path, "top", 10e-9, 2, scene, 3, sta_);
+  std::string inst_trace = report->redirectStringEnd();
+  EXPECT_NE(inst_trace.find(" r1\n"), std::string::npos);
+  EXPECT_EQ(inst_trace.find(" u1\n"), std::string::npos);
+  EXPECT_EQ(inst_trace.find(" r2\n"), std::string::npos);
+
+  PwrActivity in1 = sta_->power()->pinActivity(network->findPin(top, "in1"),
+                                               sta_->cmdScene());
+  EXPECT_EQ(in1.origin(), PwrActivityOrigin::vcd);
+  EXPECT_NEAR(in1.density(), 19 / 40e-9, 1e6);
+  std::remove(vcd_path);
+}
+
+// Activity and cell edits update power incrementally to the same
+// result as recomputing everything.
+TEST_F(PowerDesignTest, IncrementalPowerMatchesFull) {
+  ASSERT_TRUE(design_loaded_);
+  sta_->ensureGraph();
+
+  Scene *corner = sta_->cmdScene();
+  sta_->readSpef("test/reg1_asap7.spef", "test/reg1_asap7.spef",
+                  sta_->network()->topInstance(), corner,
+                  MinMaxAll::all(), false, false, 1.0f, true);
+
+  Network *network = sta_->network();
+  Instance *top = network->topInstance();
+  PowerResult total, seq, comb, clk, macro, pad;
+  sta_->power(corner, total, seq, comb, clk, macro, pad);
+
+  Power *pwr = sta_->power();
+  pwr->setUserActivity(network->findPin(top, "in2"), 1e8f, 0.3f,
+                       PwrActivityOrigin::user);
+  Instance *u1 = network->findChild(top, "u1");
+  ASSERT_NE(u1, nullptr);
+  LibertyCell *buf4 = network->findLibertyCell("BUFx4_ASAP7_75t_R");
+  ASSERT_NE(buf4, nullptr);
+  sta_->replaceCell(u1, buf4);
+
+  PowerResult total_incr, seq_incr, comb_incr, clk_incr, macro_incr, pad_incr;
+  sta_->power(corner, total_incr, seq_incr, comb_incr, clk_incr,
+              macro_incr, pad_incr);
+  PowerResult u1_incr = sta_->power(u1, corner);
+  PwrActivity u1_a_incr = sta_->activity(network->findPin(u1, "A"), corner);
+
+  pwr->powerInvalid();
+  PowerResult total_full, seq_full, comb_full, clk_full, macro_full, pad_full;
+  sta_->power(corner, total_full, seq_full, comb_full, clk_full,
+              macro_full, pad_full);
+  PowerResult u1_full = sta_->power(u1, corner);
+  PwrActivity u1_a_full = sta_->activity(network->findPin(u1, "A"), corner);
+
+  EXPECT_NEAR(total_incr.total(), total_full.total(),
+              total_full.total() * 1e-4f);
+  EXPECT_NEAR(seq_incr.total(), seq_full.total(), seq_full.total() * 1e-4f);
+  EXPECT_NEAR(comb_incr.total(), comb_full.total(), comb_full.total() * 1e-4f);
+  EXPECT_NEAR(u1_incr.total(), u1_full.total(), u1_full.total() * 1e-4f);
+  EXPECT_FLOAT_EQ(u1_a_incr.density(), u1_a_full.density());
+  EXPECT_FLOAT_EQ(u1_a_incr.duty(), u1_a_full.duty());
+}
+
+// The loads of a disconnected driver lose its activity.
+TEST_F(PowerDesignTest, IncrementalPowerDisconnect) {
+  ASSERT_TRUE(design_loaded_);
+  sta_->ensureGraph();
+
+  Scene *corner = sta_->cmdScene();
+  Network *network = sta_->network();
+  Instance *top = network->topInstance();
+  Power *pwr = sta_->power();
+  pwr->setUserActivity(network->findPin(top, "in2"), 5e8f, 0.3f,
+                       PwrActivityOrigin::user);
+  PowerResult total, seq, comb, clk, macro, pad;
+  sta_->power(corner, total, seq, comb, clk, macro, pad);
+
+  Instance *u1 = network->findChild(top, "u1");
+  Instance *u2 = network->findChild(top, "u2");
+  ASSERT_NE(u1, nullptr);
+  ASSERT_NE(u2, nullptr);
+  const Pin *u2_b = network->findPin(u2, "B");
+  PwrActivity u2_b_before = sta_->activity(u2_b, corner);
+  sta_->disconnectPin(network->findPin(u1, "Y"));
+
+  PowerResult total_incr, seq_incr, comb_incr, clk_incr, macro_incr, pad_incr;
+  sta_->power(corner, total_incr, seq_incr, comb_incr, clk_incr,
+              macro_incr, pad_incr);
+  PowerResult u2_incr = sta_->power(u2, corner);
+  PwrActivity u2_b_incr = sta_->activity(u2_b, corner);
+
+  pwr->powerInvalid();
+  PowerResult total_full, seq_full, comb_full, clk_full, macro_full, pad_full;
+  sta_->power(corner, total_full, seq_full, comb_full, clk_full,
+              macro_full, pad_full);
+  PowerResult u2_full = sta_->power(u2, corner);
+  PwrActivity u2_b_full = sta_->activity(u2_b, corner);
+
+  EXPECT_EQ(u2_b_before.origin(), PwrActivityOrigin::propagated);
+  EXPECT_EQ(u2_b_full.origin(), PwrActivityOrigin::input);
+  EXPECT_EQ(u2_b_incr.origin(), PwrActivityOrigin::input);
+  EXPECT_FLOAT_EQ(u2_b_incr.density(), u2_b_full.density());
+  EXPECT_FLOAT_EQ(u2_b_incr.duty(), u2_b_full.duty());
+  EXPECT_NEAR(u2_incr.total(), u2_full.total(), u2_full.total() * 1e-4f);
+  EXPECT_NEAR(total_incr.total(), total_full.total(),
+              total_full.total() * 1e-4f);
+}
+
 } // namespace sta
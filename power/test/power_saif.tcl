@@ -1,5 +1,5 @@
 # Test SAIF reading for power analysis
-# Targets uncovered SaifReader.cc, SaifLex.ll, SaifParse.yy
+# Targets uncovered SaifReader.cc
 
 source ../../test/helpers.tcl
 
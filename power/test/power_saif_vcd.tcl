@@ -1,6 +1,6 @@
 # Test power VCD/SAIF reading and highest_power_instances
 # Targets uncovered Power.cc paths: highestPowerInstances, power with VCD,
-# SAIF reading (SaifReader.cc, SaifLex.ll, SaifParse.yy),
+# SAIF reading (SaifReader.cc),
 # VCD reading (VcdReader.cc, VcdParse.cc)
 
 source ../../test/helpers.tcl
@@ -24,6 +24,7 @@
 
 #include "sdf/SdfReader.hh"
 
+#include <algorithm>
 #include <cctype>
 #include <cstdarg>
 #include <string>
@@ -31,6 +32,7 @@
 
 #include "ContainerHelpers.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Error.hh"
 #include "Graph.hh"
 #include "MinMax.hh"
@@ -118,6 +120,27 @@ SdfReader::SdfReader(std::string_view filename,
     network_ = makeSdcNetwork(network_);
 }
 
+SdfReader::SdfReader(const SdfReader *reader,
+                     SdfSection *section) :
+  StaState(reader),
+  filename_(reader->filename_),
+  path_(reader->path_),
+  triple_min_index_(reader->triple_min_index_),
+  triple_max_index_(reader->triple_max_index_),
+  arc_delay_min_index_(reader->arc_delay_min_index_),
+  arc_delay_max_index_(reader->arc_delay_max_index_),
+  analysis_type_(reader->analysis_type_),
+  // network_ is owned by reader.
+  unescaped_dividers_(false),
+  is_incremental_only_(reader->is_incremental_only_),
+  cond_use_(reader->cond_use_),
+  divider_(reader->divider_),
+  escape_(reader->escape_),
+  timescale_(reader->timescale_),
+  section_(section)
+{
+}
+
 SdfReader::~SdfReader()
 {
   if (unescaped_dividers_)
@@ -133,7 +156,24 @@ SdfReader::read()
     SdfScanner scanner(&stream, filename_, this, report_);
     scanner_ = &scanner;
     SdfParse parser(&scanner, this);
-    bool success = (parser.parse() == 0);
+    SdfStmtSeq stmts;
+    if (thread_count_ > 1)
+      stmts_ = &stmts;
+    bool success;
+    try {
+      success = (parser.parse() == 0);
+    }
+    catch (...) {
+      // Annotate the cells before the error like the serial reader.
+      if (stmts_)
+        annotateStmts();
+      throw;
+    }
+    if (stmts_) {
+      annotateStmts();
+      stmts_ = nullptr;
+    }
+    scanner_ = nullptr;
     stats.report("Read sdf");
     return success;
   }
@@ -170,6 +210,14 @@ SdfReader::interconnect(std::string_view from_pin_name,
                         std::string_view to_pin_name,
                         SdfTripleSeq *triples)
 {
+  if (stmts_) {
+    deferStmt([from_pin_name = std::string(from_pin_name),
+               to_pin_name = std::string(to_pin_name),
+               triples](SdfReader *reader) {
+      reader->interconnect(from_pin_name, to_pin_name, triples);
+    });
+    return;
+  }
   // Ignore non-incremental annotations in incremental only mode.
   if (!(is_incremental_only_ && !in_incremental_)) {
     Pin *from_pin = findPin(from_pin_name);
@@ -207,6 +255,13 @@ void
 SdfReader::port(std::string_view to_pin_name,
                 SdfTripleSeq *triples)
 {
+  if (stmts_) {
+    deferStmt([to_pin_name = std::string(to_pin_name),
+               triples](SdfReader *reader) {
+      reader->port(to_pin_name, triples);
+    });
+    return;
+  }
   // Ignore non-incremental annotations in incremental only mode.
   if (!(is_incremental_only_ && !in_incremental_)) {
     Pin *to_pin = (instance_)
@@ -274,19 +329,31 @@ SdfReader::setEdgeDelays(Edge *edge,
 void
 SdfReader::setCell(std::string_view cell_name)
 {
-  cell_name_ = cell_name;
+  if (stmts_)
+    deferStmt([cell_name = std::string(cell_name)](SdfReader *reader) {
+      reader->setCell(cell_name);
+    });
+  else
+    cell_name_ = cell_name;
 }
 
 void
 SdfReader::setInstance()
 {
-  instance_ = nullptr;
+  if (stmts_)
+    deferStmt([](SdfReader *reader) { reader->setInstance(); });
+  else
+    instance_ = nullptr;
 }
 
 void
 SdfReader::setInstance(std::string_view instance_name)
 {
-  if (instance_name == "*") {
+  if (stmts_)
+    deferStmt([instance_name = std::string(instance_name)](SdfReader *reader) {
+      reader->setInstance(instance_name);
+    });
+  else if (instance_name == "*") {
     warn(193, "INSTANCE wildcards not supported.");
     instance_ = nullptr;
   }
@@ -307,15 +374,26 @@ SdfReader::setInstance(std::string_view instance_name)
 void
 SdfReader::setInstanceWildcard()
 {
-  warn(172, "INSTANCE wildcards not supported.");
-  instance_ = nullptr;
+  if (stmts_)
+    deferStmt([](SdfReader *reader) { reader->setInstanceWildcard(); });
+  else {
+    warn(172, "INSTANCE wildcards not supported.");
+    instance_ = nullptr;
+  }
 }
 
 void
 SdfReader::cellFinish()
 {
-  cell_name_.clear();
-  instance_ = nullptr;
+  if (stmts_) {
+    deferStmt([](SdfReader *reader) { reader->cellFinish(); }, true);
+    if (stmts_->size() >= stmt_batch_size_)
+      annotateStmts();
+  }
+  else {
+    cell_name_.clear();
+    instance_ = nullptr;
+  }
 }
 
 void
@@ -325,6 +403,13 @@ SdfReader::iopath(SdfPortSpec *from_edge,
                   std::string_view cond,
                   bool condelse)
 {
+  if (stmts_) {
+    deferStmt([from_edge, to_port_name = std::string(to_port_name), triples,
+               cond = std::string(cond), condelse](SdfReader *reader) {
+      reader->iopath(from_edge, to_port_name, triples, cond, condelse);
+    });
+    return;
+  }
   if (instance_) {
     std::string_view from_port_name = from_edge->port();
     Cell *cell = network_->cell(instance_);
@@ -409,6 +494,12 @@ SdfReader::timingCheck(const TimingRole *role,
                        SdfPortSpec *clk_edge,
                        SdfTriple *triple)
 {
+  if (stmts_) {
+    deferStmt([role, data_edge, clk_edge, triple](SdfReader *reader) {
+      reader->timingCheck(role, data_edge, clk_edge, triple);
+    });
+    return;
+  }
   if (instance_) {
     std::string_view data_port_name = data_edge->port();
     std::string_view clk_port_name = clk_edge->port();
@@ -521,6 +612,12 @@ void
 SdfReader::timingCheckWidth(SdfPortSpec *edge,
                             SdfTriple *triple)
 {
+  if (stmts_) {
+    deferStmt([edge, triple](SdfReader *reader) {
+      reader->timingCheckWidth(edge, triple);
+    });
+    return;
+  }
   // Ignore non-incremental annotations in incremental only mode.
   if (!(is_incremental_only_ && !in_incremental_) && instance_) {
     std::string_view port_name = edge->port();
@@ -570,6 +667,14 @@ SdfReader::timingCheckSetupHold1(SdfPortSpec *data_edge,
                                  const TimingRole *setup_role,
                                  const TimingRole *hold_role)
 {
+  if (stmts_) {
+    deferStmt([data_edge, clk_edge, setup_triple, hold_triple,
+               setup_role, hold_role](SdfReader *reader) {
+      reader->timingCheckSetupHold1(data_edge, clk_edge, setup_triple,
+                                    hold_triple, setup_role, hold_role);
+    });
+    return;
+  }
   std::string_view data_port_name = data_edge->port();
   std::string_view clk_port_name = clk_edge->port();
   Cell *cell = network_->cell(instance_);
@@ -589,6 +694,12 @@ void
 SdfReader::timingCheckPeriod(SdfPortSpec *edge,
                              SdfTriple *triple)
 {
+  if (stmts_) {
+    deferStmt([edge, triple](SdfReader *reader) {
+      reader->timingCheckPeriod(edge, triple);
+    });
+    return;
+  }
   // Ignore non-incremental annotations in incremental only mode.
   if (!(is_incremental_only_ && !in_incremental_) && instance_) {
     std::string_view port_name = edge->port();
@@ -602,13 +713,23 @@ SdfReader::timingCheckPeriod(SdfPortSpec *edge,
         float *value_ptr = values[triple_min_index_];
         if (value_ptr) {
           float value = *value_ptr;
-          graph_->setPeriodCheckAnnotation(pin, arc_delay_min_index_, value);
+          if (section_)
+            section_->annotations.push_back({SdfAnnotationType::period_check,
+                false, arc_delay_min_index_, value,
+                nullptr, nullptr, pin, nullptr});
+          else
+            graph_->setPeriodCheckAnnotation(pin, arc_delay_min_index_, value);
         }
         if (triple_max_index_ != null_index_) {
           value_ptr = values[triple_max_index_];
           if (value_ptr) {
             float value = *value_ptr;
-            graph_->setPeriodCheckAnnotation(pin, arc_delay_max_index_, value);
+            if (section_)
+              section_->annotations.push_back({SdfAnnotationType::period_check,
+                  false, arc_delay_max_index_, value,
+                  nullptr, nullptr, pin, nullptr});
+            else
+              graph_->setPeriodCheckAnnotation(pin, arc_delay_max_index_, value);
           }
         }
       }
@@ -624,6 +745,14 @@ SdfReader::timingCheckNochange(SdfPortSpec *data_edge,
                                SdfTriple *before_triple,
                                SdfTriple *after_triple)
 {
+  if (stmts_) {
+    deferStmt([data_edge, clk_edge, before_triple,
+               after_triple](SdfReader *reader) {
+      reader->timingCheckNochange(data_edge, clk_edge, before_triple,
+                                  after_triple);
+    });
+    return;
+  }
   warn(173, "NOCHANGE not supported.");
   delete data_edge;
   delete clk_edge;
@@ -634,6 +763,10 @@ SdfReader::timingCheckNochange(SdfPortSpec *data_edge,
 void
 SdfReader::device(SdfTripleSeq *triples)
 {
+  if (stmts_) {
+    deferStmt([triples](SdfReader *reader) { reader->device(triples); });
+    return;
+  }
   // Ignore non-incremental annotations in incremental only mode.
   if (!(is_incremental_only_ && !in_incremental_) && instance_) {
     InstancePinIterator *pin_iter = network_->pinIterator(instance_);
@@ -650,6 +783,13 @@ void
 SdfReader::device(std::string_view to_port_name,
                   SdfTripleSeq *triples)
 {
+  if (stmts_) {
+    deferStmt([to_port_name = std::string(to_port_name),
+               triples](SdfReader *reader) {
+      reader->device(to_port_name, triples);
+    });
+    return;
+  }
   // Ignore non-incremental annotations in incremental only mode.
   if (!(is_incremental_only_ && !in_incremental_) && instance_) {
     Cell *cell = network_->cell(instance_);
@@ -697,18 +837,34 @@ SdfReader::setEdgeArcDelays(Edge *edge,
     float **values = triple->values();
     float *value_ptr = values[triple_index];
     if (value_ptr) {
-      ArcDelay delay;
-      if (in_incremental_)
-        delay = delaySum(graph_->arcDelay(edge, arc, arc_delay_index), *value_ptr, this);
+      if (section_)
+        section_->annotations.push_back({SdfAnnotationType::arc_delay,
+            in_incremental_, arc_delay_index, *value_ptr,
+            edge, arc, nullptr, nullptr});
       else
-        delay = *value_ptr;
-      graph_->setArcDelay(edge, arc, arc_delay_index, delay);
-      graph_->setArcDelayAnnotated(edge, arc, arc_delay_index, true);
-      edge->setDelayAnnotationIsIncremental(is_incremental_only_);
+        annotateArcDelay(edge, arc, arc_delay_index, *value_ptr,
+                         in_incremental_);
     }
   }
 }
 
+void
+SdfReader::annotateArcDelay(Edge *edge,
+                            TimingArc *arc,
+                            int arc_delay_index,
+                            float value,
+                            bool in_incremental)
+{
+  ArcDelay delay;
+  if (in_incremental)
+    delay = delaySum(graph_->arcDelay(edge, arc, arc_delay_index), value, this);
+  else
+    delay = value;
+  graph_->setArcDelay(edge, arc, arc_delay_index, delay);
+  graph_->setArcDelayAnnotated(edge, arc, arc_delay_index, true);
+  edge->setDelayAnnotationIsIncremental(is_incremental_only_);
+}
+
 void
 SdfReader::setEdgeArcDelaysCondUse(Edge *edge,
                                    TimingArc *arc,
@@ -745,20 +901,37 @@ SdfReader::setEdgeArcDelaysCondUse(Edge *edge,
                                    const MinMax *min_max)
 {
   if (value && triple_index != null_index_) {
-    ArcDelay delay(*value);
-    if (!is_incremental_only_ && in_incremental_)
-      delay = delaySum(graph_->arcDelay(edge, arc, arc_delay_index), *value, this);
-    else if (graph_->arcDelayAnnotated(edge, arc, arc_delay_index)) {
-      ArcDelay prev_value = graph_->arcDelay(edge, arc, arc_delay_index);
-      if (delayGreater(prev_value, delay, min_max, this))
-        delay = prev_value;
-    }
-    graph_->setArcDelay(edge, arc, arc_delay_index, delay);
-    graph_->setArcDelayAnnotated(edge, arc, arc_delay_index, true);
-    edge->setDelayAnnotationIsIncremental(is_incremental_only_);
+    if (section_)
+      section_->annotations.push_back({SdfAnnotationType::arc_delay_cond_use,
+          in_incremental_, arc_delay_index, *value,
+          edge, arc, nullptr, min_max});
+    else
+      annotateArcDelayCondUse(edge, arc, arc_delay_index, *value,
+                              in_incremental_, min_max);
   }
 }
 
+void
+SdfReader::annotateArcDelayCondUse(Edge *edge,
+                                   TimingArc *arc,
+                                   int arc_delay_index,
+                                   float value,
+                                   bool in_incremental,
+                                   const MinMax *min_max)
+{
+  ArcDelay delay(value);
+  if (!is_incremental_only_ && in_incremental)
+    delay = delaySum(graph_->arcDelay(edge, arc, arc_delay_index), value, this);
+  else if (graph_->arcDelayAnnotated(edge, arc, arc_delay_index)) {
+    ArcDelay prev_value = graph_->arcDelay(edge, arc, arc_delay_index);
+    if (delayGreater(prev_value, delay, min_max, this))
+      delay = prev_value;
+  }
+  graph_->setArcDelay(edge, arc, arc_delay_index, delay);
+  graph_->setArcDelayAnnotated(edge, arc, arc_delay_index, true);
+  edge->setDelayAnnotationIsIncremental(is_incremental_only_);
+}
+
 bool
 SdfReader::condMatch(std::string_view sdf_cond,
                      std::string_view lib_cond)
@@ -944,7 +1117,114 @@ SdfReader::makeBusName(std::string_view base_name,
 int
 SdfReader::sdfLine() const
 {
-  return scanner_->lineno();
+  return scanner_ ? scanner_->lineno() : line_;
+}
+
+////////////////////////////////////////////////////////////////
+
+void
+SdfReader::deferStmt(std::function<void (SdfReader *reader)> annotate,
+                     bool cell_end)
+{
+  stmts_->push_back({sdfLine(), in_incremental_, cell_end,
+                     std::move(annotate)});
+}
+
+// Finding instances, pins and edges for the cells in a large sdf file
+// dominates the read time. Cells are read in batches. The statements in
+// a batch are split into sections at cell boundaries and annotated by
+// section readers in parallel. Section readers save graph annotations
+// and messages instead of applying them, so they only read the network
+// and graph. The annotations are applied in file order so incremental
+// and COND use annotations match the serial reader.
+void
+SdfReader::annotateStmts()
+{
+  size_t stmt_count = stmts_->size();
+  size_t section_count = thread_count_ * 4;
+  size_t section_min_size = 256;
+  section_count = std::max(std::min(section_count,
+                                    stmt_count / section_min_size),
+                           size_t(1));
+  std::vector<SdfSection> sections;
+  size_t section_begin = 0;
+  for (size_t i = 1; i <= section_count && section_begin < stmt_count; i++) {
+    size_t section_end = std::max(stmt_count * i / section_count,
+                                  section_begin + 1);
+    // Sections start at a cell so no instance is selected.
+    while (section_end < stmt_count
+           && !(*stmts_)[section_end - 1].cell_end)
+      section_end++;
+    sections.push_back({section_begin, section_end, {}, {}});
+    section_begin = section_end;
+  }
+  debugPrint(debug_, "sdf", 1, "annotate {} statements in {} sections",
+             stmt_count, sections.size());
+
+  for (SdfSection &section : sections)
+    dispatch_queue_->dispatch([this, &section](size_t) {
+      annotateSection(section);
+    });
+  dispatch_queue_->finishTasks();
+  stmts_->clear();
+
+  for (const SdfSection &section : sections)
+    applySection(section);
+}
+
+void
+SdfReader::annotateSection(SdfSection &section)
+{
+  SdfReader section_reader(this, &section);
+  for (size_t i = section.stmt_begin; i < section.stmt_end; i++) {
+    const SdfStmt &stmt = (*stmts_)[i];
+    section_reader.line_ = stmt.line;
+    section_reader.in_incremental_ = stmt.in_incremental;
+    stmt.annotate(&section_reader);
+  }
+}
+
+void
+SdfReader::applySection(const SdfSection &section)
+{
+  for (const SdfAnnotation &annotation : section.annotations) {
+    switch (annotation.type) {
+    case SdfAnnotationType::arc_delay:
+      annotateArcDelay(annotation.edge, annotation.arc, annotation.index,
+                       annotation.value, annotation.in_incremental);
+      break;
+    case SdfAnnotationType::arc_delay_cond_use:
+      annotateArcDelayCondUse(annotation.edge, annotation.arc, annotation.index,
+                              annotation.value, annotation.in_incremental,
+                              annotation.min_max);
+      break;
+    case SdfAnnotationType::period_check:
+      graph_->setPeriodCheckAnnotation(annotation.pin, annotation.index,
+                                       annotation.value);
+      break;
+    case SdfAnnotationType::warn: {
+      const SdfMessage &message = section.messages[annotation.index];
+      report_->fileWarn(message.id, filename_, message.line, "{}", message.msg);
+      break;
+    }
+    case SdfAnnotationType::error: {
+      const SdfMessage &message = section.messages[annotation.index];
+      report_->fileError(message.id, filename_, message.line, "{}", message.msg);
+      break;
+    }
+    }
+  }
+}
+
+void
+SdfReader::sectionMessage(SdfAnnotationType type,
+                          int id,
+                          std::string msg)
+{
+  int index = section_->messages.size();
+  section_->messages.push_back({id, line_, std::move(msg)});
+  section_->annotations.push_back({type, false, index, 0.0F,
+                                   nullptr, nullptr, nullptr, nullptr});
 }
 
 Pin *
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -40,12 +41,63 @@
 namespace sta {
 
 class Report;
+class SdfReader;
 class SdfTriple;
 class SdfPortSpec;
 class SdfScanner;
 
 using SdfTripleSeq = std::vector<SdfTriple*>;
 
+// Parsed statement in a CELL that is annotated after its batch of cells
+// has been read.
+class SdfStmt
+{
+public:
+  int line;
+  bool in_incremental;
+  // Last statement of a CELL.
+  bool cell_end;
+  std::function<void (SdfReader *reader)> annotate;
+};
+
+using SdfStmtSeq = std::vector<SdfStmt>;
+
+enum class SdfAnnotationType { arc_delay, arc_delay_cond_use, period_check,
+                               warn, error };
+
+// Graph annotation or message saved by a section reader to apply
+// in file order.
+class SdfAnnotation
+{
+public:
+  SdfAnnotationType type;
+  bool in_incremental;
+  // Arc delay index, or message index for warn/error.
+  int index;
+  float value;
+  Edge *edge;
+  TimingArc *arc;
+  const Pin *pin;
+  const MinMax *min_max;
+};
+
+class SdfMessage
+{
+public:
+  int id;
+  int line;
+  std::string msg;
+};
+
+class SdfSection
+{
+public:
+  size_t stmt_begin;
+  size_t stmt_end;
+  std::vector<SdfAnnotation> annotations;
+  std::vector<SdfMessage> messages;
+};
+
 class SdfReader : public StaState
 {
 public:
@@ -58,6 +110,9 @@ public:
             bool is_incremental_only,
             MinMaxAll *cond_use,
             StaState *sta);
+  // Reader that annotates a section of the statements read by reader.
+  SdfReader(const SdfReader *reader,
+            SdfSection *section);
   ~SdfReader() override;
   bool read();
 
@@ -160,19 +215,46 @@ public:
                std::string_view fmt,
                Args &&...args)
   {
-    report_->fileWarn(id, filename_, sdfLine(), fmt,
-                     std::forward<Args>(args)...);
+    if (section_)
+      sectionMessage(SdfAnnotationType::warn, id,
+                     sta::formatRuntime(fmt, std::forward<Args>(args)...));
+    else
+      report_->fileWarn(id, filename_, sdfLine(), fmt,
+                        std::forward<Args>(args)...);
   }
   template <typename... Args>
   void error(int id,
                 std::string_view fmt,
                 Args &&...args)
   {
-    report_->fileError(id, filename_, sdfLine(), fmt,
-                      std::forward<Args>(args)...);
+    if (section_)
+      sectionMessage(SdfAnnotationType::error, id,
+                     sta::formatRuntime(fmt, std::forward<Args>(args)...));
+    else
+      report_->fileError(id, filename_, sdfLine(), fmt,
+                         std::forward<Args>(args)...);
   }
 
 private:
+  void deferStmt(std::function<void (SdfReader *reader)> annotate,
+                 bool cell_end = false);
+  void annotateStmts();
+  void annotateSection(SdfSection &section);
+  void applySection(const SdfSection &section);
+  void sectionMessage(SdfAnnotationType type,
+                      int id,
+                      std::string msg);
+  void annotateArcDelay(Edge *edge,
+                        TimingArc *arc,
+                        int arc_delay_index,
+                        float value,
+                        bool in_incremental);
+  void annotateArcDelayCondUse(Edge *edge,
+                               TimingArc *arc,
+                               int arc_delay_index,
+                               float value,
+                               bool in_incremental,
+                               const MinMax *min_max);
   Edge *findCheckEdge(Pin *from_pin,
                       Pin *to_pin,
                       const TimingRole *sdf_role,
@@ -206,7 +288,7 @@ private:
                  std::string_view port_name);
 
   std::string_view filename_;
-  SdfScanner *scanner_;
+  SdfScanner *scanner_{nullptr};
   std::string_view path_;
   // Which values to pull out of the sdf triples.
   int triple_min_index_{0};
@@ -227,6 +309,16 @@ private:
   bool in_incremental_{false};
   float timescale_{1.0E-9F};  // default units of ns
 
+  // Statements of the cells read since the last batch was annotated
+  // when cells are annotated by parallel section readers.
+  SdfStmtSeq *stmts_{nullptr};
+  // Annotations and messages of a section reader.
+  SdfSection *section_{nullptr};
+  // Line of the statement being annotated by a section reader.
+  int line_{0};
+
+  // Statements read before a batch is annotated.
+  static constexpr size_t stmt_batch_size_ = 1 << 16;
   static const int null_index_ = -1;
 };
 
@@ -738,12 +738,18 @@ TEST_F(SdfSmokeTest, TransitionRiseFallToString) {
 } // namespace sta
 
 #include <tcl.h>
+#include <algorithm>
 #include <cstdio>
+#include <string>
+#include <vector>
 #include "Sta.hh"
 #include "Network.hh"
 #include "ReportTcl.hh"
 #include "Scene.hh"
 #include "Error.hh"
+#include "Delay.hh"
+#include "Graph.hh"
+#include "TimingArc.hh"
 #include "sdf/SdfReader.hh"
 
 namespace sta {
@@ -1695,4 +1701,109 @@ TEST_F(SdfDesignTest, WriteSdfWithVersion) {
   std::remove(tmpfile);
 }
 
+// Annotated arc delays as "from to arc index delay" strings.
+static std::vector<std::string>
+annotatedArcDelays(Sta *sta,
+                   const Scene *corner)
+{
+  std::vector<std::string> delays;
+  Graph *graph = sta->graph();
+  Network *network = sta->network();
+  VertexIterator vertex_iter(graph);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    VertexOutEdgeIterator edge_iter(vertex, graph);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      for (TimingArc *arc : edge->timingArcSet()->arcs()) {
+        for (const MinMax *min_max : MinMax::range()) {
+          int ap_index = corner->dcalcAnalysisPtIndex(min_max);
+          if (graph->arcDelayAnnotated(edge, arc, ap_index))
+            delays.push_back(network->pathName(edge->from(graph)->pin())
+                             + std::string(" ")
+                             + network->pathName(edge->to(graph)->pin())
+                             + " " + arc->to_string()
+                             + " " + std::to_string(ap_index)
+                             + " " + std::to_string(delayAsFloat(graph->arcDelay(edge, arc, ap_index))));
+        }
+      }
+    }
+  }
+  std::sort(delays.begin(), delays.end());
+  return delays;
+}
+
+// Reading an sdf with cells annotated by parallel section readers
+// matches the serial reader, including cells annotated more than once.
+TEST_F(SdfDesignTest, ReadSdfParallelMatchesSerial) {
+  ASSERT_TRUE(design_loaded_);
+  sta_->ensureGraph();
+
+  Scene *corner = sta_->cmdScene();
+  const char *sdf_path = "/tmp/test_sdf_parallel.sdf";
+  FILE *fp = fopen(sdf_path, "w");
+  ASSERT_NE(fp, nullptr);
+  fprintf(fp, "(DELAYFILE\n");
+  fprintf(fp, "  (SDFVERSION \"3.0\")\n");
+  fprintf(fp, "  (DESIGN \"top\")\n");
+  fprintf(fp, "  (TIMESCALE 1ns)\n");
+  for (int i = 0; i < 500; i++) {
+    float delay = 0.001F * (i + 1);
+    fprintf(fp, "  (CELL\n");
+    fprintf(fp, "    (CELLTYPE \"top\")\n");
+    fprintf(fp, "    (INSTANCE)\n");
+    fprintf(fp, "    (DELAY\n");
+    fprintf(fp, "      (ABSOLUTE\n");
+    fprintf(fp, "        (INTERCONNECT u1/Y u2/B (%.3f::%.3f))\n",
+            delay, delay * 2);
+    fprintf(fp, "      )\n");
+    fprintf(fp, "    )\n");
+    fprintf(fp, "  )\n");
+    fprintf(fp, "  (CELL\n");
+    fprintf(fp, "    (CELLTYPE \"DFFHQx4_ASAP7_75t_R\")\n");
+    fprintf(fp, "    (INSTANCE r%d)\n", i % 3 + 1);
+    fprintf(fp, "    (DELAY\n");
+    fprintf(fp, "      (ABSOLUTE\n");
+    fprintf(fp, "        (IOPATH CLK Q (%.3f::%.3f) (%.3f::%.3f))\n",
+            delay, delay * 2, delay * 3, delay * 4);
+    fprintf(fp, "      )\n");
+    fprintf(fp, "      (INCREMENT\n");
+    fprintf(fp, "        (IOPATH CLK Q (0.001::0.002) (0.001::0.002))\n");
+    fprintf(fp, "      )\n");
+    fprintf(fp, "    )\n");
+    fprintf(fp, "    (TIMINGCHECK\n");
+    fprintf(fp, "      (SETUP D (posedge CLK) (%.3f::%.3f))\n", delay, delay);
+    fprintf(fp, "      (HOLD D (posedge CLK) (%.3f::%.3f))\n", delay, delay);
+    fprintf(fp, "    )\n");
+    fprintf(fp, "  )\n");
+    fprintf(fp, "  (CELL\n");
+    fprintf(fp, "    (CELLTYPE \"AND2x2_ASAP7_75t_R\")\n");
+    fprintf(fp, "    (INSTANCE u2)\n");
+    fprintf(fp, "    (DELAY\n");
+    fprintf(fp, "      (ABSOLUTE\n");
+    fprintf(fp, "        (IOPATH A Y (%.3f::%.3f) (%.3f::%.3f))\n",
+            delay, delay, delay, delay);
+    fprintf(fp, "        (IOPATH B Y (%.3f::%.3f) (%.3f::%.3f))\n",
+            delay, delay, delay, delay);
+    fprintf(fp, "      )\n");
+    fprintf(fp, "    )\n");
+    fprintf(fp, "  )\n");
+  }
+  fprintf(fp, ")\n");
+  fclose(fp);
+
+  sta_->setThreadCount(1);
+  readSdf(sdf_path, "", corner, false, false, nullptr, sta_);
+  std::vector<std::string> serial_delays = annotatedArcDelays(sta_, corner);
+  EXPECT_FALSE(serial_delays.empty());
+
+  sta_->removeDelaySlewAnnotations();
+  sta_->setThreadCount(4);
+  readSdf(sdf_path, "", corner, false, false, nullptr, sta_);
+  std::vector<std::string> parallel_delays = annotatedArcDelays(sta_, corner);
+  EXPECT_EQ(parallel_delays, serial_delays);
+
+  std::remove(sdf_path);
+}
+
 } // namespace sta
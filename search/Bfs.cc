@@ -204,6 +204,7 @@ BfsIterator::visitParallel(Level to_level,
           }
           level_vertices.clear();
           visit_count += vertex_count;
+          visitor->levelFinished();
         }
       }
       for (VertexVisitor *visitor : visitors)
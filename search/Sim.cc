@@ -86,6 +86,29 @@ Sim::functionSense(const FuncExpr *expr,
 {
   debugPrint(debug_, "sim", 4, "find sense pin {} {}", network_->pathName(input_pin),
              expr->to_string());
+  TimingSense sense;
+  const FuncTruthTable *truth_table = expr->truthTable();
+  if (truth_table) {
+    unsigned care_vars, var_values;
+    simVarValues(truth_table, inst, care_vars, var_values);
+    int input_index = truth_table->varIndex(network_->libertyPort(input_pin));
+    if (input_index < 0 || (care_vars & (1U << input_index)))
+      sense = TimingSense::none;
+    else
+      sense = truth_table->sense(input_index,
+                                 truth_table->cube(care_vars, var_values));
+  }
+  else
+    sense = functionSenseBdd(expr, input_pin, inst);
+  debugPrint(debug_, "sim", 4, " {}", to_string(sense));
+  return sense;
+}
+
+TimingSense
+Sim::functionSenseBdd(const FuncExpr *expr,
+                      const Pin *input_pin,
+                      const Instance *inst)
+{
   bool increasing, decreasing;
   {
     LockGuard lock(bdd_lock_);
@@ -110,7 +133,6 @@ Sim::functionSense(const FuncExpr *expr,
     sense = TimingSense::negative_unate;
   else
     sense = TimingSense::non_unate;
-  debugPrint(debug_, "sim", 4, " {}", to_string(sense));
   return sense;
 }
 
@@ -118,6 +140,20 @@ LogicValue
 Sim::evalExpr(const FuncExpr *expr,
               const Instance *inst)
 {
+  const FuncTruthTable *truth_table = expr ? expr->truthTable() : nullptr;
+  if (truth_table) {
+    unsigned care_vars, var_values;
+    simVarValues(truth_table, inst, care_vars, var_values);
+    uint64_t cube = truth_table->cube(care_vars, var_values);
+    uint64_t ones = truth_table->ones() & cube;
+    if (ones == 0)
+      return LogicValue::zero;
+    else if (ones == cube)
+      return LogicValue::one;
+    else
+      return LogicValue::unknown;
+  }
+
   LockGuard lock(bdd_lock_);
   DdNode *bdd = funcBddSim(expr, inst);
   LogicValue value = LogicValue::unknown;
@@ -134,6 +170,39 @@ Sim::evalExpr(const FuncExpr *expr,
   return value;
 }
 
+// Truth table vars with constant instance pin values.
+void
+Sim::simVarValues(const FuncTruthTable *truth_table,
+                  const Instance *inst,
+                  // Return values.
+                  unsigned &care_vars,
+                  unsigned &var_values)
+{
+  care_vars = 0;
+  var_values = 0;
+  InstancePinIterator *pin_iter = network_->pinIterator(inst);
+  while (pin_iter->hasNext()) {
+    const Pin *pin = pin_iter->next();
+    const LibertyPort *port = network_->libertyPort(pin);
+    int var_index = truth_table->varIndex(port);
+    if (var_index >= 0) {
+      unsigned var_bit = 1U << var_index;
+      switch (simValue(pin)) {
+        case LogicValue::zero:
+          care_vars |= var_bit;
+          break;
+        case LogicValue::one:
+          care_vars |= var_bit;
+          var_values |= var_bit;
+          break;
+        default:
+          break;
+      }
+    }
+  }
+  delete pin_iter;
+}
+
 // BDD with instance pin values substituted.
 DdNode *
 Sim::funcBddSim(const FuncExpr *expr,
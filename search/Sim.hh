@@ -144,6 +144,14 @@ protected:
   TimingSense functionSense(const FuncExpr *expr,
                             const Pin *input_pin,
                             const Instance *inst);
+  TimingSense functionSenseBdd(const FuncExpr *expr,
+                               const Pin *input_pin,
+                               const Instance *inst);
+  void simVarValues(const FuncTruthTable *truth_table,
+                    const Instance *inst,
+                    // Return values.
+                    unsigned &care_vars,
+                    unsigned &var_values);
   void functionSense(const FuncExpr *expr,
                      const Pin *input_pin,
                      const Instance *inst,
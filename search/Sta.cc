@@ -67,12 +67,14 @@
 #include "LibertyClass.hh"
 #include "LibertyWriter.hh"
 #include "Machine.hh"
+#include "ConcreteNetwork.hh"
 #include "MakeConcreteNetwork.hh"
 #include "MakeTimingModel.hh"
 #include "MinMax.hh"
 #include "Mode.hh"
 #include "Network.hh"
 #include "NetworkClass.hh"
+#include "NetworkSnapshot.hh"
 #include "Parasitics.hh"
 #include "PathExpanded.hh"
 #include "PathGroup.hh"
@@ -103,6 +105,7 @@
 #include "Wireload.hh"
 #include "liberty/LibertyReader.hh"
 #include "parasitics/ConcreteParasitics.hh"
+#include "parasitics/ParasiticsCache.hh"
 #include "parasitics/ReportParasiticAnnotation.hh"
 #include "parasitics/SpefReader.hh"
 #include "power/Power.hh"
@@ -770,6 +773,26 @@ Sta::linkDesign(const char *top_cell_name,
   return status;
 }
 
+void
+Sta::writeNetlistSnapshot(std::string_view filename)
+{
+  ensureLinked();
+  ConcreteNetwork *network = dynamic_cast<ConcreteNetwork*>(network_);
+  if (network == nullptr)
+    report_->error(1564, "netlist snapshots require a concrete network.");
+  sta::writeNetlistSnapshot(filename, network);
+}
+
+bool
+Sta::readNetlistSnapshot(std::string_view filename)
+{
+  ConcreteNetwork *network = dynamic_cast<ConcreteNetwork*>(network_);
+  if (network == nullptr)
+    report_->error(1565, "netlist snapshots require a concrete network.");
+  readNetlistBefore();
+  return sta::readNetlistSnapshot(filename, network);
+}
+
 ////////////////////////////////////////////////////////////////
 
 bool 
@@ -3670,6 +3693,7 @@ Sta::reportDelayCalc(Edge *edge,
 void
 Sta::setArcDelayCalc(std::string_view delay_calc_name)
 {
+  graph_delay_calc_->keepProfileCounts();
   delete arc_delay_calc_;
   arc_delay_calc_ = makeDelayCalc(std::string(delay_calc_name), sta_);
   // Update pointers to arc_delay_calc.
@@ -3714,6 +3738,25 @@ Sta::setIncrementalDelayTolerance(float tol)
   graph_delay_calc_->setIncrementalDelayTolerance(tol);
 }
 
+void
+Sta::setDelayCalcCacheTolerance(float tol)
+{
+  graph_delay_calc_->setCacheTolerance(tol);
+  delaysInvalid();
+}
+
+void
+Sta::reportDelayCalcProfile(int top_count)
+{
+  graph_delay_calc_->reportProfile(top_count);
+}
+
+void
+Sta::clearDelayCalcProfile()
+{
+  graph_delay_calc_->clearProfile();
+}
+
 ArcDelay
 Sta::arcDelay(Edge *edge,
               TimingArc *arc,
@@ -4266,6 +4309,11 @@ Sta::readSpef(std::string_view name,
   bool success = readSpefFile(filename, instance, pin_cap_included,
                               keep_coupling_caps, coupling_cap_factor, reduce,
                               scene, min_max, parasitics, this);
+  // The spef hash is found when a parasitics cache is written.
+  if (success)
+    parasitics->setSpefFile(filename, 0);
+  else
+    parasitics->spefFileInvalid();
   delaysInvalid();
   return success;
 }
@@ -4276,6 +4324,46 @@ Sta::findParasitics(const std::string &name)
   return findKey(parasitics_name_map_, name);
 }
 
+void
+Sta::writeParasiticsCache(std::string_view name,
+                          std::string_view filename)
+{
+  ensureLibLinked();
+  Parasitics *parasitics = nullptr;
+  if (!name.empty()) {
+    parasitics = findParasitics(std::string(name));
+    if (parasitics == nullptr)
+      report_->error(1562, "spef {} not found.", name);
+  }
+  else
+    parasitics = cmd_scene_->parasitics(MinMax::max());
+  sta::writeParasiticsCache(filename, parasitics, this);
+}
+
+bool
+Sta::readParasiticsCache(std::string_view name,
+                         std::string_view filename,
+                         std::string_view spef_filename)
+{
+  ensureLibLinked();
+  Parasitics *parasitics = nullptr;
+  if (name.empty()) {
+    parasitics = findParasitics("default");
+    for (Scene *scene : scenes_)
+      scene->setParasitics(parasitics, MinMaxAll::minMax());
+  }
+  else {
+    parasitics = findParasitics(std::string(name));
+    if (parasitics == nullptr)
+      parasitics = makeConcreteParasitics(name, spef_filename);
+  }
+  bool success = sta::readParasiticsCache(filename, spef_filename,
+                                          parasitics, this);
+  if (success)
+    delaysInvalid();
+  return success;
+}
+
 void
 Sta::reportParasiticAnnotation(const std::string &spef_name,
                                bool report_unannotated)
@@ -4410,6 +4498,49 @@ Sta::makeParasiticNetwork(const Net *net,
   return parasitic;
 }
 
+Parasitic *
+Sta::beginParasiticEco(const Net *net,
+                       Parasitics *parasitics,
+                       bool includes_pin_caps,
+                       bool replace)
+{
+  parasitics->deleteReducedParasitics(net);
+  Parasitic *parasitic = replace ? nullptr : parasitics->findParasiticNetwork(net);
+  if (parasitic == nullptr)
+    parasitic = parasitics->makeParasiticNetwork(net, includes_pin_caps);
+  return parasitic;
+}
+
+void
+Sta::finishParasiticEco(const Net *net,
+                        Parasitics *parasitics,
+                        bool reduce)
+{
+  Parasitic *parasitic = parasitics->findParasiticNetwork(net);
+  bool reduced = false;
+  PinSet *drivers = network_->drivers(net);
+  if (drivers) {
+    for (const Pin *drvr_pin : *drivers) {
+      if (parasitic && reduce && arc_delay_calc_->reduceSupported()) {
+        for (const Scene *scene : scenes_) {
+          for (const MinMax *min_max : MinMax::range()) {
+            if (scene->parasitics(min_max) == parasitics) {
+              for (const RiseFall *rf : RiseFall::range())
+                arc_delay_calc_->reduceParasitic(parasitic, drvr_pin, rf,
+                                                 scene, min_max);
+              reduced = true;
+            }
+          }
+        }
+      }
+      arc_delay_calc_->parasiticsInvalid(drvr_pin);
+      delaysInvalidFrom(drvr_pin);
+    }
+  }
+  if (reduced)
+    parasitics->deleteParasiticNetwork(net);
+}
+
 ////////////////////////////////////////////////////////////////
 //
 // Network edit commands.
@@ -4582,7 +4713,7 @@ Sta::makeInstanceAfter(const Instance *inst)
         }
       }
       graph_->makeInstanceEdges(inst);
-      power_->powerInvalid();
+      power_->makeInstanceAfter(inst);
     }
   }
 }
@@ -4651,7 +4782,7 @@ Sta::replaceEquivCellAfter(const Instance *inst)
     }
     delete pin_iter;
     clk_skews_->clear();
-    power_->powerInvalid();
+    power_->replaceCellAfter(inst);
   }
 }
 
@@ -4742,6 +4873,7 @@ Sta::replaceCellAfter(const Instance *inst)
       }
     }
     delete pin_iter;
+    power_->replaceCellAfter(inst);
   }
 }
 
@@ -4793,7 +4925,7 @@ Sta::connectPinAfter(const Pin *pin)
     mode->sim()->connectPinAfter(pin);
   }
   clk_skews_->clear();
-  power_->powerInvalid();
+  power_->connectPinAfter(pin);
 }
 
 void
@@ -4855,6 +4987,8 @@ Sta::disconnectPinBefore(const Pin *pin)
 
   for (auto [name, parasitics] : parasitics_name_map_)
     parasitics->disconnectPinBefore(pin);
+  // Before the clock network forgets the pin.
+  power_->disconnectPinBefore(pin);
   bool is_hierarchical = network_->isHierarchical(pin);
   for (Mode *mode : modes_) {
     mode->sim()->disconnectPinBefore(pin);
@@ -4901,7 +5035,6 @@ Sta::disconnectPinBefore(const Pin *pin)
       }
     }
     clk_skews_->clear();
-    power_->powerInvalid();
   }
 }
 
@@ -4982,7 +5115,7 @@ Sta::deleteLeafInstanceBefore(const Instance *inst)
     mode->sdc()->deleteInstanceBefore(inst);
   }
   clk_skews_->clear();
-  power_->powerInvalid();
+  power_->deleteInstanceBefore(inst);
 }
 
 void
@@ -5063,6 +5196,7 @@ Sta::deletePinBefore(const Pin *pin)
     mode->sim()->deletePinBefore(pin);
     mode->clkNetwork()->deletePinBefore(pin);
   }
+  power_->deletePinBefore(pin);
 }
 
 void
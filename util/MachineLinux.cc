@@ -55,7 +55,7 @@ initElapsedTime()
 double
 elapsedRunTime()
 {
-  static struct timeval time;
+  struct timeval time;
   struct timezone tz;
   gettimeofday(&time, &tz);
   return time.tv_sec - elapsed_begin_time_.tv_sec
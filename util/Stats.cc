@@ -60,4 +60,12 @@ Stats::report(const char *step)
   }
 }
 
+void
+Stats::reportCount(const char *step,
+                   size_t count)
+{
+  if (debug_->statsLevel() > 0)
+    report_->report("stats: {} {}", step, count);
+}
+
 }  // namespace sta
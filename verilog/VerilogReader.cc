@@ -24,6 +24,7 @@
 
 #include "VerilogReader.hh"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <string>
@@ -31,6 +32,7 @@
 
 #include "ContainerHelpers.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Error.hh"
 #include "Liberty.hh"
 #include "Network.hh"
@@ -718,6 +720,14 @@ VerilogModuleInst::~VerilogModuleInst()
     deleteContents(pins_);
     delete pins_;
   }
+  delete link_;
+}
+
+void
+VerilogModuleInst::setLink(VerilogInstLink *link)
+{
+  delete link_;
+  link_ = link;
 }
 
 bool
@@ -743,6 +753,30 @@ VerilogLibertyInst::VerilogLibertyInst(LibertyCell *cell,
 {
 }
 
+void
+VerilogLibertyInst::setNetName(size_t pin_index,
+                               const std::string &net_name)
+{
+  net_names_[pin_index] = net_name;
+}
+
+VerilogInstLink::VerilogInstLink(Cell *cell) :
+  cell_(cell)
+{
+}
+
+VerilogInstLink::~VerilogInstLink()
+{
+  deleteContents(errors_);
+}
+
+void
+VerilogInstLink::addPin(Port *port,
+                        const std::string &net_name)
+{
+  pins_.push_back({port, net_name});
+}
+
 VerilogDcl::VerilogDcl(PortDirection *dir,
                        VerilogDclArgSeq *args,
                        VerilogAttrStmtSeq *attr_stmts,
@@ -1459,6 +1493,8 @@ VerilogReader::linkNetwork(std::string_view top_cell_name,
     Cell *top_cell = network_->findCell(library_, top_cell_str);
     VerilogModule *module = this->module(top_cell);
     if (module) {
+      Stats stats(debug_, report_);
+      resolveLinks();
       // Seed the recursion for expansion with the top level instance.
       Instance *top_instance =
           network_->makeInstance(top_cell, top_cell_str, nullptr);
@@ -1478,6 +1514,7 @@ VerilogReader::linkNetwork(std::string_view top_cell_name,
         delete net_name_iter;
       }
       makeModuleInstBody(module, top_instance, &bindings, make_black_boxes);
+      stats.report("Link verilog");
       bool errors = reportLinkErrors();
       if (delete_modules)
         deleteModules();
@@ -1499,6 +1536,106 @@ VerilogReader::linkNetwork(std::string_view top_cell_name,
   }
 }
 
+// Resolve the cells and port connections of instances in every module
+// before expanding the hierarchy. Statements only read the netlist and
+// their own module so they are resolved in parallel sections.
+void
+VerilogReader::resolveLinks()
+{
+  size_t thread_count = network_->threadCount();
+  DispatchQueue *dispatch_queue = network_->dispatchQueue();
+  if (thread_count > 1 && dispatch_queue) {
+    size_t stmt_count = 0;
+    for (const auto &[cell, module] : module_map_)
+      stmt_count += module->stmts()->size();
+    size_t section_size = std::max(stmt_count / (thread_count * 4),
+                                   size_t(1024));
+    size_t section_count = 0;
+    for (const auto &[cell, module] : module_map_) {
+      size_t module_stmt_count = module->stmts()->size();
+      for (size_t begin = 0; begin < module_stmt_count; begin += section_size) {
+        size_t end = std::min(begin + section_size, module_stmt_count);
+        dispatch_queue->dispatch([this, module, begin, end](size_t) {
+          resolveLinks(module, begin, end);
+        });
+        section_count++;
+      }
+    }
+    dispatch_queue->finishTasks();
+    debugPrint(debug_, "verilog", 1, "parallel link {} sections", section_count);
+  }
+  else {
+    for (const auto &[cell, module] : module_map_)
+      resolveLinks(module, 0, module->stmts()->size());
+  }
+}
+
+void
+VerilogReader::resolveLinks(VerilogModule *module,
+                            size_t stmt_begin,
+                            size_t stmt_end)
+{
+  VerilogStmtSeq *stmts = module->stmts();
+  for (size_t i = stmt_begin; i < stmt_end; i++) {
+    VerilogStmt *stmt = (*stmts)[i];
+    if (stmt->isModuleInst()) {
+      VerilogModuleInst *mod_inst = dynamic_cast<VerilogModuleInst *>(stmt);
+      Cell *cell = findInstCell(mod_inst);
+      // Instances of missing modules are resolved during expansion
+      // because making black boxes edits the library.
+      mod_inst->setLink(cell ? makeInstLink(mod_inst, module, cell) : nullptr);
+    }
+    else if (stmt->isLibertyInst())
+      resolveLibertyInst(dynamic_cast<VerilogLibertyInst *>(stmt), module);
+  }
+}
+
+Cell *
+VerilogReader::findInstCell(VerilogModuleInst *mod_inst)
+{
+  Cell *cell = network_->findAnyCell(mod_inst->moduleName());
+  if (cell) {
+    LibertyCell *lib_cell = network_->libertyCell(cell);
+    if (lib_cell)
+      cell = network_->cell(lib_cell);
+  }
+  return cell;
+}
+
+VerilogInstLink *
+VerilogReader::makeInstLink(VerilogModuleInst *mod_inst,
+                            VerilogModule *parent_module,
+                            Cell *cell)
+{
+  VerilogInstLink *link = new VerilogInstLink(cell);
+  if (mod_inst->hasPins()) {
+    if (mod_inst->namedPins())
+      makeNamedInstPins(cell, mod_inst, parent_module, link);
+    else
+      makeOrderedInstPins(cell, mod_inst, parent_module, link);
+  }
+  return link;
+}
+
+// Replace single bit bus references .A(BUS) with .A(BUS[LSB]).
+void
+VerilogReader::resolveLibertyInst(VerilogLibertyInst *lib_inst,
+                                  VerilogModule *parent_module)
+{
+  const StringSeq &net_names = lib_inst->netNames();
+  for (size_t i = 0; i < net_names.size(); i++) {
+    const std::string &net_name = net_names[i];
+    if (!net_name.empty()) {
+      VerilogDcl *dcl = parent_module->declaration(net_name);
+      if (dcl && dcl->isBus()) {
+        VerilogDclBus *dcl_bus = dynamic_cast<VerilogDclBus *>(dcl);
+        // Bus is only 1 bit wide.
+        lib_inst->setNetName(i, verilogBusBitName(net_name, dcl_bus->fromIndex()));
+      }
+    }
+  }
+}
+
 void
 VerilogReader::makeModuleInstBody(VerilogModule *module,
                                   Instance *inst,
@@ -1510,8 +1647,7 @@ VerilogReader::makeModuleInstBody(VerilogModule *module,
       makeModuleInstNetwork(dynamic_cast<VerilogModuleInst *>(stmt), inst, module,
                             bindings, make_black_boxes);
     else if (stmt->isLibertyInst())
-      makeLibertyInst(dynamic_cast<VerilogLibertyInst *>(stmt), inst, module,
-                      bindings);
+      makeLibertyInst(dynamic_cast<VerilogLibertyInst *>(stmt), inst, bindings);
     else if (stmt->isDeclaration()) {
       VerilogDcl *dcl = dynamic_cast<VerilogDcl *>(stmt);
       PortDirection *dir = dcl->direction();
@@ -1541,25 +1677,13 @@ VerilogReader::makeModuleInstNetwork(VerilogModuleInst *mod_inst,
                                      VerilogBindingTbl *parent_bindings,
                                      bool make_black_boxes)
 {
-  const std::string &module_name = mod_inst->moduleName();
-  Cell *cell = network_->findAnyCell(module_name);
-  if (cell == nullptr) {
-    std::string inst_vname = instanceVerilogName(mod_inst->instanceName());
-    if (make_black_boxes) {
-      cell = makeBlackBox(mod_inst, parent_module);
-      linkWarn(198, parent_module->filename(), mod_inst->line(),
-               "module {} not found. Creating black box for {}.",
-               mod_inst->moduleName(), inst_vname);
-    }
-    else
-      linkError(199, parent_module->filename(), mod_inst->line(),
-                "module {} not found for instance {}.",
-                mod_inst->moduleName(), inst_vname);
+  VerilogInstLink *link = mod_inst->link();
+  if (link == nullptr) {
+    link = makeModuleInstLink(mod_inst, parent_module, make_black_boxes);
+    mod_inst->setLink(link);
   }
-  if (cell) {
-    LibertyCell *lib_cell = network_->libertyCell(cell);
-    if (lib_cell)
-      cell = network_->cell(lib_cell);
+  if (link) {
+    Cell *cell = link->cell();
     Instance *inst =
         network_->makeInstance(cell, mod_inst->instanceName(), parent);
     VerilogAttrStmtSeq *attr_stmts = mod_inst->attrStmts();
@@ -1578,14 +1702,11 @@ VerilogReader::makeModuleInstNetwork(VerilogModuleInst *mod_inst,
     delete port_iter;
     bool is_leaf = network_->isLeaf(cell);
     VerilogBindingTbl bindings(zero_net_name_, one_net_name_);
-    if (mod_inst->hasPins()) {
-      if (mod_inst->namedPins())
-        makeNamedInstPins(cell, inst, mod_inst, &bindings, parent, parent_module,
-                          parent_bindings, is_leaf);
-      else
-        makeOrderedInstPins(cell, inst, mod_inst, &bindings, parent, parent_module,
-                            parent_bindings, is_leaf);
-    }
+    for (const VerilogInstPin &pin : link->pins())
+      makeInstPin(inst, pin.port, pin.net_name, &bindings, parent,
+                  parent_bindings, is_leaf);
+    for (VerilogError *error : link->errors())
+      link_errors_.push_back(new VerilogError(*error));
     if (!is_leaf) {
       VerilogModule *module = this->module(cell);
       if (module)
@@ -1594,15 +1715,37 @@ VerilogReader::makeModuleInstNetwork(VerilogModuleInst *mod_inst,
   }
 }
 
+// Link an instance whose module was not found when links were resolved.
+VerilogInstLink *
+VerilogReader::makeModuleInstLink(VerilogModuleInst *mod_inst,
+                                  VerilogModule *parent_module,
+                                  bool make_black_boxes)
+{
+  Cell *cell = findInstCell(mod_inst);
+  if (cell == nullptr) {
+    std::string inst_vname = instanceVerilogName(mod_inst->instanceName());
+    if (make_black_boxes) {
+      cell = makeBlackBox(mod_inst, parent_module);
+      linkWarn(198, parent_module->filename(), mod_inst->line(),
+               "module {} not found. Creating black box for {}.",
+               mod_inst->moduleName(), inst_vname);
+    }
+    else
+      linkError(199, parent_module->filename(), mod_inst->line(),
+                "module {} not found for instance {}.",
+                mod_inst->moduleName(), inst_vname);
+  }
+  if (cell)
+    return makeInstLink(mod_inst, parent_module, cell);
+  else
+    return nullptr;
+}
+
 void
 VerilogReader::makeNamedInstPins(Cell *cell,
-                                 Instance *inst,
                                  VerilogModuleInst *mod_inst,
-                                 VerilogBindingTbl *bindings,
-                                 Instance *parent,
                                  VerilogModule *parent_module,
-                                 VerilogBindingTbl *parent_bindings,
-                                 bool is_leaf)
+                                 VerilogInstLink *link)
 {
   std::string inst_vname = instanceVerilogName(mod_inst->instanceName());
   for (auto mpin : *mod_inst->pins()) {
@@ -1611,10 +1754,10 @@ VerilogReader::makeNamedInstPins(Cell *cell,
     Port *port = network_->findPort(cell, port_name);
     if (port) {
       if (vpin->hasNet() && network_->size(port) != vpin->size(parent_module)) {
-        linkWarn(200, parent_module->filename(), mod_inst->line(),
-                 "instance {} port {} size {} does not match net size {}.",
-                 inst_vname, network_->name(port), network_->size(port),
-                 vpin->size(parent_module));
+        link->warn(200, parent_module->filename(), mod_inst->line(),
+                   "instance {} port {} size {} does not match net size {}.",
+                   inst_vname, network_->name(port), network_->size(port),
+                   vpin->size(parent_module));
       }
       else {
         VerilogNetNameIterator *net_name_iter =
@@ -1623,33 +1766,28 @@ VerilogReader::makeNamedInstPins(Cell *cell,
           PortMemberIterator *port_iter = network_->memberIterator(port);
           while (port_iter->hasNext()) {
             Port *port = port_iter->next();
-            makeInstPin(inst, port, net_name_iter, bindings, parent, parent_bindings,
-                        is_leaf);
+            link->addPin(port, net_name_iter->hasNext()
+                         ? net_name_iter->next() : std::string());
           }
           delete port_iter;
         }
-        else {
-          makeInstPin(inst, port, net_name_iter, bindings, parent, parent_bindings,
-                      is_leaf);
-        }
+        else
+          link->addPin(port, net_name_iter->hasNext()
+                       ? net_name_iter->next() : std::string());
         delete net_name_iter;
       }
     }
     else
-      linkWarn(201, parent_module->filename(), mod_inst->line(),
-               "instance {} port {} not found.", inst_vname, port_name);
+      link->warn(201, parent_module->filename(), mod_inst->line(),
+                 "instance {} port {} not found.", inst_vname, port_name);
   }
 }
 
 void
 VerilogReader::makeOrderedInstPins(Cell *cell,
-                                   Instance *inst,
                                    VerilogModuleInst *mod_inst,
-                                   VerilogBindingTbl *bindings,
-                                   Instance *parent,
                                    VerilogModule *parent_module,
-                                   VerilogBindingTbl *parent_bindings,
-                                   bool is_leaf)
+                                   VerilogInstLink *link)
 {
   CellPortIterator *port_iter = network_->portIterator(cell);
   VerilogNetSeq *mod_pins = mod_inst->pins();
@@ -1659,10 +1797,10 @@ VerilogReader::makeOrderedInstPins(Cell *cell,
     Port *port = port_iter->next();
     if (network_->size(port) != net->size(parent_module)) {
       std::string inst_vname = instanceVerilogName(mod_inst->instanceName());
-      linkWarn(202, parent_module->filename(), mod_inst->line(),
-               "instance {} port {} size {} does not match net size {}.",
-               inst_vname, network_->name(port), network_->size(port),
-               net->size(parent_module));
+      link->warn(202, parent_module->filename(), mod_inst->line(),
+                 "instance {} port {} size {} does not match net size {}.",
+                 inst_vname, network_->name(port), network_->size(port),
+                 net->size(parent_module));
     }
     else {
       VerilogNetNameIterator *net_name_iter = net->nameIterator(parent_module, this);
@@ -1670,35 +1808,19 @@ VerilogReader::makeOrderedInstPins(Cell *cell,
         PortMemberIterator *member_iter = network_->memberIterator(port);
         while (member_iter->hasNext() && net_name_iter->hasNext()) {
           Port *port = member_iter->next();
-          makeInstPin(inst, port, net_name_iter, bindings, parent, parent_bindings,
-                      is_leaf);
+          link->addPin(port, net_name_iter->next());
         }
         delete member_iter;
       }
       else
-        makeInstPin(inst, port, net_name_iter, bindings, parent, parent_bindings,
-                    is_leaf);
+        link->addPin(port, net_name_iter->hasNext()
+                     ? net_name_iter->next() : std::string());
       delete net_name_iter;
     }
   }
   delete port_iter;
 }
 
-void
-VerilogReader::makeInstPin(Instance *inst,
-                           Port *port,
-                           VerilogNetNameIterator *net_name_iter,
-                           VerilogBindingTbl *bindings,
-                           Instance *parent,
-                           VerilogBindingTbl *parent_bindings,
-                           bool is_leaf)
-{
-  std::string net_name;
-  if (net_name_iter->hasNext())
-    net_name = net_name_iter->next();
-  makeInstPin(inst, port, net_name, bindings, parent, parent_bindings, is_leaf);
-}
-
 void
 VerilogReader::makeInstPin(Instance *inst,
                            Port *port,
@@ -1732,7 +1854,6 @@ VerilogReader::makeInstPin(Instance *inst,
 void
 VerilogReader::makeLibertyInst(VerilogLibertyInst *lib_inst,
                                Instance *parent,
-                               VerilogModule *parent_module,
                                VerilogBindingTbl *parent_bindings)
 {
   LibertyCell *lib_cell = lib_inst->cell();
@@ -1750,20 +1871,10 @@ VerilogReader::makeLibertyInst(VerilogLibertyInst *lib_inst,
   while (port_iter.hasNext()) {
     LibertyPort *port = port_iter.next();
     const std::string &net_name = net_names[port->pinIndex()];
-    // net_name may be the name of a single bit bus.
+    // Single bit bus references are replaced by resolveLibertyInst.
+    // If the pin is unconnected (ie, .A()) make the pin but not the net.
     if (!net_name.empty()) {
-      Net *net = nullptr;
-      // If the pin is unconnected (ie, .A()) make the pin but not the net.
-      VerilogDcl *dcl = parent_module->declaration(net_name);
-      // Check for single bit bus reference .A(BUS) -> .A(BUS[LSB]).
-      if (dcl && dcl->isBus()) {
-        VerilogDclBus *dcl_bus = dynamic_cast<VerilogDclBus *>(dcl);
-        // Bus is only 1 bit wide.
-        std::string bus_name = verilogBusBitName(net_name, dcl_bus->fromIndex());
-        net = parent_bindings->ensureNetBinding(bus_name, parent, network_);
-      }
-      else
-        net = parent_bindings->ensureNetBinding(net_name, parent, network_);
+      Net *net = parent_bindings->ensureNetBinding(net_name, parent, network_);
       network_->makePin(inst, reinterpret_cast<Port *>(port), net);
     }
     else
@@ -204,10 +204,52 @@ public:
   VerilogNetSeq *pins() const { return pins_; }
   bool namedPins();
   bool hasPins();
+  VerilogInstLink *link() const { return link_; }
+  void setLink(VerilogInstLink *link);
 
 private:
   std::string module_name_;
   VerilogNetSeq *pins_;
+  VerilogInstLink *link_{nullptr};
+};
+
+// Port bit of a module instance and the parent net name it connects to.
+struct VerilogInstPin
+{
+  Port *port;
+  std::string net_name;
+};
+
+using VerilogInstPinSeq = std::vector<VerilogInstPin>;
+
+// Cell and pin connections of a module instance resolved before the
+// hierarchy is expanded so each instantiation of the parent module
+// only has to bind nets.
+class VerilogInstLink
+{
+public:
+  VerilogInstLink(Cell *cell);
+  ~VerilogInstLink();
+  Cell *cell() const { return cell_; }
+  const VerilogInstPinSeq &pins() const { return pins_; }
+  const VerilogErrorSeq &errors() const { return errors_; }
+  void addPin(Port *port,
+              const std::string &net_name);
+  template <typename... Args>
+  void warn(int id,
+            std::string_view filename,
+            int line,
+            std::string_view msg,
+            Args &&...args)
+  {
+    std::string msg_str = sta::formatRuntime(msg, std::forward<Args>(args)...);
+    errors_.push_back(new VerilogError(id, filename, line, msg_str, true));
+  }
+
+private:
+  Cell *cell_;
+  VerilogInstPinSeq pins_;
+  VerilogErrorSeq errors_;
 };
 
 // Instance of liberty cell when all connections are single bit.
@@ -224,6 +266,8 @@ public:
   bool isLibertyInst() const override { return true; }
   LibertyCell *cell() const { return cell_; }
   const StringSeq &netNames() const { return net_names_; }
+  void setNetName(size_t pin_index,
+                  const std::string &net_name);
 
 private:
   LibertyCell *cell_;
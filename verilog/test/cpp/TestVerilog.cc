@@ -1930,6 +1930,8 @@ TEST_F(VerilogTest, DclBusDifferentRange) {
 
 #include <tcl.h>
 #include <cstdio>
+#include <fstream>
+#include <sstream>
 #include "Sta.hh"
 #include "Network.hh"
 #include "ReportTcl.hh"
@@ -2457,6 +2459,120 @@ TEST_F(VerilogDesignTest, ReadMultipleModules) {
   }
 }
 
+// Test linking a hierarchy with instance links resolved on multiple threads
+// Covers: VerilogReader::resolveLinks, resolveLibertyInst, makeInstLink
+TEST_F(VerilogDesignTest, ParallelLinkHierarchy) {
+  ASSERT_TRUE(design_loaded_);
+
+  const char *hier_file = "verilog/test/hier_parallel.v";
+  FILE *fp = fopen(hier_file, "w");
+  ASSERT_NE(fp, nullptr);
+  fprintf(fp, "module leaf_mod (input [0:0] a, output b);\n");
+  fprintf(fp, "  BUFx2_ASAP7_75t_R u1 (.A(a), .Y(b));\n");
+  fprintf(fp, "endmodule\n\n");
+  fprintf(fp, "module mid_mod (input [1:0] a, output [1:0] b);\n");
+  fprintf(fp, "  leaf_mod l0 (.a(a[0]), .b(b[0]));\n");
+  fprintf(fp, "  leaf_mod l1 (a[1], b[1]);\n");
+  fprintf(fp, "endmodule\n\n");
+  fprintf(fp, "module par_top (input [1:0] in1, output [1:0] out1, out2);\n");
+  fprintf(fp, "  wire [1:0] w;\n");
+  fprintf(fp, "  mid_mod m1 (.a(in1), .b(w));\n");
+  fprintf(fp, "  mid_mod m2 (.a(w), .b(out1));\n");
+  fprintf(fp, "  mid_mod m3 (.a(w), .b(out2), .c(w));\n");
+  fprintf(fp, "endmodule\n");
+  fclose(fp);
+
+  sta_->setThreadCount(4);
+  EXPECT_TRUE(sta_->readVerilog(hier_file));
+  EXPECT_TRUE(sta_->linkDesign("par_top", true));
+  remove(hier_file);
+
+  Network *network = sta_->network();
+  Instance *top = network->topInstance();
+  ASSERT_NE(top, nullptr);
+  for (const char *mid_name : {"m1", "m2", "m3"}) {
+    Instance *mid = network->findChild(top, mid_name);
+    ASSERT_NE(mid, nullptr);
+    for (const char *leaf_name : {"l0", "l1"}) {
+      Instance *leaf = network->findChild(mid, leaf_name);
+      ASSERT_NE(leaf, nullptr);
+      Instance *u1 = network->findChild(leaf, "u1");
+      ASSERT_NE(u1, nullptr);
+      // Single bit bus reference .A(a) binds to a[0].
+      Pin *a = network->findPin(u1, "A");
+      ASSERT_NE(a, nullptr);
+      EXPECT_NE(network->net(a), nullptr);
+    }
+  }
+  // m2 and m3 l0 inputs both connect to top level net w[0].
+  Pin *m2_a = network->findPin(network->findChild(top, "m2"), "a[0]");
+  Pin *m3_a = network->findPin(network->findChild(top, "m3"), "a[0]");
+  ASSERT_NE(m2_a, nullptr);
+  ASSERT_NE(m3_a, nullptr);
+  EXPECT_EQ(network->net(m2_a), network->net(m3_a));
+}
+
+static std::string
+readFileText(const char *filename)
+{
+  std::ifstream stream(filename);
+  std::stringstream text;
+  text << stream.rdbuf();
+  return text.str();
+}
+
+// Test that write_verilog of a reloaded netlist snapshot is identical
+// Covers: Sta::writeNetlistSnapshot, Sta::readNetlistSnapshot
+TEST_F(VerilogDesignTest, NetlistSnapshotRoundTrip) {
+  ASSERT_TRUE(design_loaded_);
+
+  const char *hier_file = "verilog/test/hier_snapshot.v";
+  FILE *fp = fopen(hier_file, "w");
+  ASSERT_NE(fp, nullptr);
+  fprintf(fp, "module snap_sub (input [1:0] a, output b, output c);\n");
+  fprintf(fp, "  wire n1;\n");
+  fprintf(fp, "  AND2x2_ASAP7_75t_R u1 (.A(a[0]), .B(a[1]), .Y(n1));\n");
+  fprintf(fp, "  BUFx2_ASAP7_75t_R u2 (.A(n1), .Y(b));\n");
+  fprintf(fp, "  assign c = b;\n");
+  fprintf(fp, "endmodule\n\n");
+  fprintf(fp, "module snap_top (input [1:0] in1, output out1, out2, out3);\n");
+  fprintf(fp, "  snap_sub s1 (.a(in1), .b(out1), .c(out2));\n");
+  fprintf(fp, "  snap_box b1 (.a(in1[0]), .y(out3));\n");
+  fprintf(fp, "  BUFx2_ASAP7_75t_R u3 (.A(1'b0), .Y());\n");
+  fprintf(fp, "endmodule\n");
+  fclose(fp);
+  EXPECT_TRUE(sta_->readVerilog(hier_file));
+  EXPECT_TRUE(sta_->linkDesign("snap_top", true));
+  remove(hier_file);
+
+  const char *verilog1 = "/tmp/test_snapshot1.v";
+  const char *verilog2 = "/tmp/test_snapshot2.v";
+  const char *snapshot = "/tmp/test_snapshot.bin";
+  writeVerilog(verilog1, true, nullptr, sta_->network());
+  sta_->writeNetlistSnapshot(snapshot);
+  EXPECT_TRUE(sta_->readNetlistSnapshot(snapshot));
+
+  Network *network = sta_->network();
+  Instance *top = network->topInstance();
+  ASSERT_NE(top, nullptr);
+  EXPECT_NE(network->findInstance("s1/u2"), nullptr);
+  // Merged net names are kept as aliases.
+  EXPECT_NE(network->findNet("s1/c"), nullptr);
+  writeVerilog(verilog2, true, nullptr, network);
+  EXPECT_EQ(readFileText(verilog1), readFileText(verilog2));
+
+  std::remove(verilog1);
+  std::remove(verilog2);
+  std::remove(snapshot);
+}
+
+// Test reading a file that is not a netlist snapshot
+// Covers: NetlistSnapshotReader::readHeader
+TEST_F(VerilogDesignTest, NetlistSnapshotNotSnapshot) {
+  ASSERT_TRUE(design_loaded_);
+  EXPECT_THROW(sta_->readNetlistSnapshot("test/reg1_asap7.v"), Exception);
+}
+
 // Test reading a non-existent file (error path)
 // Covers: VerilogReader file open error path
 TEST_F(VerilogDesignTest, ReadNonexistentFile) {